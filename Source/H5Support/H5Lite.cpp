@@ -35,6 +35,7 @@
 
 #include <H5Support/H5Lite.h>
 
+#include <algorithm>
 #include <cstring>
 
 #if defined(H5Support_NAMESPACE)
@@ -673,6 +674,71 @@ hsize_t H5Lite::getNumberOfElements(hid_t loc_id, const std::string& dsetName)
   return numElements;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+herr_t H5Lite::selectElementRange(hid_t spaceId, hsize_t start, hsize_t numElements)
+{
+  int32_t rank = H5Sget_simple_extent_ndims(spaceId);
+  if(rank <= 0)
+  {
+    return -1;
+  }
+  std::vector<hsize_t> dims(rank, 0);
+  herr_t err = H5Sget_simple_extent_dims(spaceId, dims.data(), nullptr);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  // strides[i] is the number of elements covered by a single step along dimension i
+  std::vector<hsize_t> strides(rank, 1);
+  for(int32_t i = rank - 2; i >= 0; i--)
+  {
+    strides[i] = strides[i + 1] * dims[i + 1];
+  }
+  hsize_t totalElements = strides[0] * dims[0];
+  if(start + numElements > totalElements)
+  {
+    return -1;
+  }
+
+  err = H5Sselect_none(spaceId);
+  std::vector<hsize_t> offset(rank, 0);
+  std::vector<hsize_t> count(rank, 1);
+  hsize_t position = start;
+  hsize_t remaining = numElements;
+  while(remaining > 0 && err >= 0)
+  {
+    // Use the slowest dimension where the current position sits on a boundary and at
+    // least one whole step still fits. All faster dimensions are then fully selected.
+    int32_t dim = rank - 1;
+    for(int32_t i = 0; i < rank; i++)
+    {
+      if(position % strides[i] == 0 && remaining >= strides[i])
+      {
+        dim = i;
+        break;
+      }
+    }
+
+    hsize_t index = position;
+    for(int32_t i = 0; i < rank; i++)
+    {
+      offset[i] = index / strides[i];
+      index = index % strides[i];
+      count[i] = (i > dim) ? dims[i] : 1;
+    }
+    hsize_t steps = std::min(remaining / strides[dim], dims[dim] - offset[dim]);
+    count[dim] = steps;
+
+    err = H5Sselect_hyperslab(spaceId, H5S_SELECT_OR, offset.data(), nullptr, count.data(), nullptr);
+    position += steps * strides[dim];
+    remaining -= steps * strides[dim];
+  }
+  return err;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
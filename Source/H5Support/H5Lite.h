@@ -255,12 +255,16 @@ namespace H5Support_NAMESPACE
        * Also when passing data BE SURE that the type of data and the data type match.
        * For example if I create some data in a std::vector<UInt8Type> I would need to
        * pass H5T_NATIVE_UINT8 as the dataType.
+       *
+       * The optional dcpl_id is a dataset creation property list (chunking,
+       * compression) that is used when the dataset is created.
        */
       template <typename T>
       static herr_t writeVectorDataset (hid_t loc_id,
                                         const std::string& dsetName,
                                         std::vector<hsize_t>& dims,
-                                        std::vector<T>& data)
+                                        std::vector<T>& data,
+                                        hid_t dcpl_id = H5P_DEFAULT)
       {
         H5SUPPORT_MUTEX_LOCK()
 
@@ -288,7 +292,7 @@ namespace H5Support_NAMESPACE
           return -101;
         }
         // Create the Dataset
-        did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
         if ( did >= 0 )
         {
           err = H5Dwrite( did, dataType, H5S_ALL, H5S_ALL, H5P_DEFAULT, &(data.front()) );
@@ -325,6 +329,8 @@ namespace H5Support_NAMESPACE
        * @param rank The number of dimensions
        * @param dims The sizes of each dimension
        * @param data The data to be written.
+       * @param dcpl_id The dataset creation property list to use. Defaults to H5P_DEFAULT
+       * which creates a contiguous, uncompressed dataset.
        * @return Standard hdf5 error condition.
        */
       template <typename T>
@@ -332,7 +338,8 @@ namespace H5Support_NAMESPACE
                                          const std::string& dsetName,
                                          int32_t   rank,
                                          hsize_t* dims,
-                                         T* data)
+                                         T* data,
+                                         hid_t dcpl_id = H5P_DEFAULT)
       {
         H5SUPPORT_MUTEX_LOCK()
 
@@ -363,7 +370,7 @@ namespace H5Support_NAMESPACE
         }
         // Create the Dataset
         // This will fail if dsetName contains a "/"!
-        did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
         if ( did >= 0 )
         {
           err = H5Dwrite( did, dataType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data );
@@ -410,6 +417,7 @@ namespace H5Support_NAMESPACE
        * @param rank
        * @param dims
        * @param data
+       * @param dcpl_id Creation property list used only if the dataset does not exist yet
        * @return
        */
       template <typename T>
@@ -417,7 +425,8 @@ namespace H5Support_NAMESPACE
                                            const std::string& dsetName,
                                            int32_t   rank,
                                            hsize_t* dims,
-                                           T* data)
+                                           T* data,
+                                           hid_t dcpl_id = H5P_DEFAULT)
       {
         H5SUPPORT_MUTEX_LOCK()
 
@@ -451,7 +460,7 @@ namespace H5Support_NAMESPACE
         HDF_ERROR_HANDLER_ON
         if ( did < 0 ) // dataset does not exist so create it
         {
-          did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+          did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
         }
         if ( did >= 0 )
         {
@@ -1118,6 +1127,181 @@ namespace H5Support_NAMESPACE
         return retErr;
       }
 
+      /**
+       * @brief Reads a rectangular block (hyperslab) of a dataset into a preallocated
+       * array. Only the selected elements are read from the file so the memory needed
+       * is proportional to the block and not to the whole dataset.
+       * @param loc_id The parent location that contains the dataset to read
+       * @param dsetName The name of the dataset to read
+       * @param offset The starting index along each dimension of the dataset
+       * @param count The number of elements to read along each dimension of the dataset
+       * @param data A Pointer to the PreAllocated Array of Data. It must hold at least
+       * the product of the values in count.
+       * @return Standard HDF error condition
+       */
+      template <typename T>
+      static herr_t readPointerDatasetHyperslab(hid_t loc_id,
+                                                const std::string& dsetName,
+                                                const std::vector<hsize_t>& offset,
+                                                const std::vector<hsize_t>& count,
+                                                T* data)
+      {
+        H5SUPPORT_MUTEX_LOCK()
+
+        herr_t err = 0;
+        herr_t retErr = 0;
+        T test = static_cast<T>(0x00);
+        hid_t dataType = H5Lite::HDFTypeForPrimitive(test);
+        if (dataType == -1)
+        {
+          std::cout  << "dataType was not supported." << std::endl;
+          return -10;
+        }
+        if (nullptr == data)
+        {
+          std::cout  << "The Pointer to hold the data is nullptr. This is NOT allowed." << std::endl;
+          return -3;
+        }
+        if (offset.size() != count.size() || offset.empty())
+        {
+          std::cout  << "The offset and count must have the same, non zero, number of dimensions." << std::endl;
+          return -4;
+        }
+        hid_t did = H5Dopen( loc_id, dsetName.c_str(), H5P_DEFAULT );
+        if ( did < 0 )
+        {
+          std::cout  << " Error opening Dataset: " << did << std::endl;
+          return -1;
+        }
+        hid_t fileSpaceId = H5Dget_space(did);
+        int32_t rank = H5Sget_simple_extent_ndims(fileSpaceId);
+        std::vector<hsize_t> dims(rank > 0 ? rank : 0, 0);
+        if (rank > 0)
+        {
+          H5Sget_simple_extent_dims(fileSpaceId, dims.data(), nullptr);
+        }
+        bool valid = (rank == static_cast<int32_t>(offset.size()));
+        for (size_t i = 0; valid && i < dims.size(); ++i)
+        {
+          valid = (count[i] > 0 && offset[i] + count[i] <= dims[i]);
+        }
+        if (!valid)
+        {
+          std::cout  << "The requested hyperslab does not fit inside Dataset '" << dsetName << "'" << std::endl;
+          H5Sclose(fileSpaceId);
+          H5Dclose(did);
+          return -5;
+        }
+
+        hid_t memSpaceId = H5Screate_simple(rank, count.data(), nullptr);
+        err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr);
+        if (err >= 0)
+        {
+          err = H5Dread(did, dataType, memSpaceId, fileSpaceId, H5P_DEFAULT, data);
+        }
+        if (err < 0)
+        {
+          std::cout  << "Error Reading Data." << std::endl;
+          retErr = err;
+        }
+        H5Sclose(memSpaceId);
+        H5Sclose(fileSpaceId);
+        err = H5Dclose( did );
+        if (err < 0 )
+        {
+          std::cout  << "Error Closing Dataset id" << std::endl;
+          retErr = err;
+        }
+        return retErr;
+      }
+
+      /**
+       * @brief Selects a contiguous range of elements from a dataspace. The range is
+       * given as positions in the flattened (row major) ordering of the dataspace and
+       * is broken up into the smallest number of rectangular blocks.
+       * @param spaceId The dataspace to modify
+       * @param start The first element to select
+       * @param numElements The number of elements to select
+       * @return Standard HDF error condition
+       */
+      static H5Support_EXPORT herr_t selectElementRange(hid_t spaceId, hsize_t start, hsize_t numElements);
+
+      /**
+       * @brief Reads a contiguous range of elements from a dataset into a preallocated
+       * array. The range is given as positions in the flattened (row major) ordering of
+       * the dataset regardless of how many dimensions the dataset has.
+       * @param loc_id The parent location that contains the dataset to read
+       * @param dsetName The name of the dataset to read
+       * @param start The first element to read
+       * @param numElements The number of elements to read
+       * @param data A Pointer to the PreAllocated Array of Data that can hold numElements values
+       * @return Standard HDF error condition
+       */
+      template <typename T>
+      static herr_t readPointerDatasetElementRange(hid_t loc_id,
+                                                   const std::string& dsetName,
+                                                   hsize_t start,
+                                                   hsize_t numElements,
+                                                   T* data)
+      {
+        H5SUPPORT_MUTEX_LOCK()
+
+        herr_t err = 0;
+        herr_t retErr = 0;
+        T test = static_cast<T>(0x00);
+        hid_t dataType = H5Lite::HDFTypeForPrimitive(test);
+        if (dataType == -1)
+        {
+          std::cout  << "dataType was not supported." << std::endl;
+          return -10;
+        }
+        if (nullptr == data)
+        {
+          std::cout  << "The Pointer to hold the data is nullptr. This is NOT allowed." << std::endl;
+          return -3;
+        }
+        if (numElements == 0)
+        {
+          return 0;
+        }
+        hid_t did = H5Dopen( loc_id, dsetName.c_str(), H5P_DEFAULT );
+        if ( did < 0 )
+        {
+          std::cout  << " Error opening Dataset: " << did << std::endl;
+          return -1;
+        }
+        hid_t fileSpaceId = H5Dget_space(did);
+        hssize_t totalElements = H5Sget_simple_extent_npoints(fileSpaceId);
+        if (totalElements < 0 || start + numElements > static_cast<hsize_t>(totalElements))
+        {
+          std::cout  << "The requested range does not fit inside Dataset '" << dsetName << "'" << std::endl;
+          H5Sclose(fileSpaceId);
+          H5Dclose(did);
+          return -5;
+        }
+
+        hid_t memSpaceId = H5Screate_simple(1, &numElements, nullptr);
+        err = selectElementRange(fileSpaceId, start, numElements);
+        if (err >= 0)
+        {
+          err = H5Dread(did, dataType, memSpaceId, fileSpaceId, H5P_DEFAULT, data);
+        }
+        if (err < 0)
+        {
+          std::cout  << "Error Reading Data." << std::endl;
+          retErr = err;
+        }
+        H5Sclose(memSpaceId);
+        H5Sclose(fileSpaceId);
+        err = H5Dclose( did );
+        if (err < 0 )
+        {
+          std::cout  << "Error Closing Dataset id" << std::endl;
+          retErr = err;
+        }
+        return retErr;
+      }
+
       /**
        * @brief Reads data from the HDF5 File into an std::vector<T> object. If the dataset
        * is very large this can be an expensive method to use. It is here for convenience
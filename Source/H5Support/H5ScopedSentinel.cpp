@@ -200,3 +200,21 @@ H5GroupAutoCloser::~H5GroupAutoCloser()
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5PropertyListAutoCloser::H5PropertyListAutoCloser(hid_t* plistId)
+: pid(plistId)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5PropertyListAutoCloser::~H5PropertyListAutoCloser()
+{
+  if(*pid > 0 && *pid != H5P_DEFAULT)
+  {
+    H5Pclose(*pid);
+  }
+}
@@ -111,6 +111,20 @@ private:
   hid_t* gid = nullptr;
 };
 
+/**
+ * @brief The H5PropertyListAutoCloser class closes a property list when the variable
+ * goes out of scope. H5P_DEFAULT is never closed.
+ */
+class H5Support_EXPORT H5PropertyListAutoCloser
+{
+public:
+  H5PropertyListAutoCloser(hid_t* plistId);
+
+  virtual ~H5PropertyListAutoCloser();
+private:
+  hid_t* pid = nullptr;
+};
+
 
 #if defined (H5Support_NAMESPACE)
 }
@@ -212,6 +212,7 @@ namespace H5Support_NAMESPACE
        * @param rank The number of dimensions
        * @param dims The sizes of each dimension
        * @param data The data to be written.
+       * @param dcpl_id The dataset creation property list (H5P_DEFAULT for contiguous storage)
        * @return Standard hdf5 error condition.
        */
       template <typename T>
@@ -219,9 +220,10 @@ namespace H5Support_NAMESPACE
                                          const QString& dsetName,
                                          int32_t   rank,
                                          hsize_t* dims,
-                                         T* data)
+                                         T* data,
+                                         hid_t dcpl_id = H5P_DEFAULT)
       {
-        return H5Lite::writePointerDataset(loc_id, dsetName.toStdString(), rank, dims, data);
+        return H5Lite::writePointerDataset(loc_id, dsetName.toStdString(), rank, dims, data, dcpl_id);
       }
 
       /**
@@ -231,6 +233,7 @@ namespace H5Support_NAMESPACE
        * @param rank
        * @param dims
        * @param data
+       * @param dcpl_id
        * @return
        */
       template <typename T>
@@ -238,9 +241,10 @@ namespace H5Support_NAMESPACE
                                            const QString& dsetName,
                                            int32_t   rank,
                                            hsize_t* dims,
-                                           T* data)
+                                           T* data,
+                                           hid_t dcpl_id = H5P_DEFAULT)
       {
-        return H5Lite::replacePointerDataset(loc_id, dsetName.toStdString(), rank, dims, data);
+        return H5Lite::replacePointerDataset(loc_id, dsetName.toStdString(), rank, dims, data, dcpl_id);
       }
 
 
@@ -460,6 +464,45 @@ namespace H5Support_NAMESPACE
         return H5Lite::readPointerDataset(loc_id, dsetName.toStdString(), data);
       }
 
+      /**
+       * @brief Reads a rectangular block (hyperslab) of a dataset into a preallocated array.
+       * @param loc_id The parent location that contains the dataset to read
+       * @param dsetName The name of the dataset to read
+       * @param offset The starting index along each dimension of the dataset
+       * @param count The number of elements to read along each dimension of the dataset
+       * @param data A Pointer to the PreAllocated Array of Data
+       * @return Standard HDF error condition
+       */
+      template <typename T>
+      static herr_t readPointerDatasetHyperslab(hid_t loc_id,
+                                                const QString& dsetName,
+                                                const QVector<hsize_t>& offset,
+                                                const QVector<hsize_t>& count,
+                                                T* data)
+      {
+        return H5Lite::readPointerDatasetHyperslab(loc_id, dsetName.toStdString(), offset.toStdVector(), count.toStdVector(), data);
+      }
+
+      /**
+       * @brief Reads a contiguous range of elements, in flattened row major order, from a
+       * dataset into a preallocated array.
+       * @param loc_id The parent location that contains the dataset to read
+       * @param dsetName The name of the dataset to read
+       * @param start The first element to read
+       * @param numElements The number of elements to read
+       * @param data A Pointer to the PreAllocated Array of Data
+       * @return Standard HDF error condition
+       */
+      template <typename T>
+      static herr_t readPointerDatasetElementRange(hid_t loc_id,
+                                                   const QString& dsetName,
+                                                   hsize_t start,
+                                                   hsize_t numElements,
+                                                   T* data)
+      {
+        return H5Lite::readPointerDatasetElementRange(loc_id, dsetName.toStdString(), start, numElements, data);
+      }
+
 
       /**
        * @brief Reads data from the HDF5 File into an QVector<T> object. If the dataset
@@ -53,11 +53,13 @@
 
 // DREAM3DLib includes
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArrayStorage.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
 #include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineProfiler.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
@@ -92,10 +94,47 @@ int main(int argc, char* argv[])
                                      "Pipeline File as a JSON file.", "file");
   parser.addOption(pipelineFileArg);
 
+  // Optional per filter timing report
+  QCommandLineOption profileFileArg(QStringList() << "profile", "Write per filter timing and memory statistics to a JSON file.", "file");
+  parser.addOption(profileFileArg);
+
+  // Optional out of order execution of filters that do not depend on each other
+  QCommandLineOption dataflowArg(QStringList() << "dataflow", "Run filters that do not share any data or files concurrently. Ignored when --profile is given.");
+  parser.addOption(dataflowArg);
+
+  // Optional memory mapped scratch files for large arrays
+  QCommandLineOption mappedThresholdArg(QStringList() << "mapped-threshold", "Keep arrays of at least this many megabytes in memory mapped scratch files instead of on the heap.", "megabytes");
+  parser.addOption(mappedThresholdArg);
+  QCommandLineOption scratchDirArg(QStringList() << "scratch-dir", "Directory the scratch files are created in. Defaults to the system temporary directory.", "directory");
+  parser.addOption(scratchDirArg);
+
   // Process the actual command line arguments given by the user
   parser.process(*app);
 
   QString pipelineFile = parser.value(pipelineFileArg);
+  QString profileFile = parser.value(profileFileArg);
+
+  if(parser.isSet(mappedThresholdArg))
+  {
+    bool ok = false;
+    qulonglong megabytes = parser.value(mappedThresholdArg).toULongLong(&ok);
+    if(!ok)
+    {
+      std::cout << "The scratch file threshold '" << parser.value(mappedThresholdArg).toStdString() << "' is not a number of megabytes" << std::endl;
+      return EXIT_FAILURE;
+    }
+    DataArrayStorage::SetMappedFileThreshold(static_cast<size_t>(megabytes) * 1024 * 1024);
+  }
+  if(parser.isSet(scratchDirArg))
+  {
+    QString scratchDir = parser.value(scratchDirArg);
+    if(!QDir(scratchDir).exists())
+    {
+      std::cout << "The scratch directory '" << scratchDir.toStdString() << "' does not exist" << std::endl;
+      return EXIT_FAILURE;
+    }
+    DataArrayStorage::SetScratchDirectory(scratchDir);
+  }
 
   std::cout << "PipelineRunner Starting. " << std::endl;
   std::cout << "   " << SIMPLib::Version::PackageComplete().toStdString() << std::endl;
@@ -152,8 +191,25 @@ int main(int argc, char* argv[])
     std::cout << "Errors preflighting the pipeline. Exiting Now." << std::endl;
     return EXIT_FAILURE;
   }
+  PipelineProfiler::Pointer profiler;
+  if(!profileFile.isEmpty())
+  {
+    profiler = PipelineProfiler::New();
+    pipeline->setProfiler(profiler);
+  }
+  pipeline->setDataflowExecution(parser.isSet(dataflowArg));
   // Now actually execute the pipeline
   pipeline->execute();
+  if(nullptr != profiler.get())
+  {
+    QTextStream out(stdout);
+    profiler->printTable(out);
+    out.flush();
+    if(!profiler->writeJson(profileFile))
+    {
+      std::cout << "Could not write the profile to '" << profileFile.toStdString() << "'" << std::endl;
+    }
+  }
   err = pipeline->getErrorCondition();
   if(err < 0)
   {
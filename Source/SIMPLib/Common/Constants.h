@@ -539,6 +539,8 @@ namespace SIMPL
     const QString ComponentDimensions("ComponentDimensions");
     const QString AxisDimensions("Tuple Axis Dimensions");
     const QString DataArrayVersion("DataArrayVersion");
+    const QString LinkedNumNeighbors("Linked NumNeighbors Dataset");
+    const QString ContainsObjectIds("ContainsObjectIds");
   }
 
   namespace StringConstants
@@ -836,6 +838,7 @@ namespace Geometry
   const QString NumberOfTuples("NumberOfTuples");
   const QString UnitDimensionality("UnitDimensionality");
   const QString SpatialDimensionality("SpatialDimensionality");
+  const QString GeneratedElementSizes("GeneratedElementSizes");
 
   const QString AnyGeometry("AnyGeometry");
   const QString UnknownGeometry("UnkownGeometry");
@@ -35,18 +35,40 @@
 
 #include "Observable.h"
 
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+const int k_DefaultProgressUpdateRate = 10;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t SteadyClockNanoseconds()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 Observable::Observable()
 : QObject(nullptr)
+, m_ProgressUpdateInterval(1000000000LL / k_DefaultProgressUpdateRate)
+, m_NextProgressUpdate(0)
+, m_ProgressCount(0)
 {
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-Observable::Observable(const Observable&)
+Observable::Observable(const Observable& rhs)
+: m_ProgressUpdateInterval(rhs.m_ProgressUpdateInterval.load())
+, m_NextProgressUpdate(0)
+, m_ProgressCount(0)
 {
 }
 
@@ -127,3 +149,136 @@ void Observable::notifyProgressMessage(const QString& prefix, const QString& hum
   pm.setType(PipelineMessage::MessageType::StatusMessageAndProgressValue);
   emit filterGeneratedMessage(pm);
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Observable::setProgressUpdateRate(int updatesPerSecond)
+{
+  m_ProgressUpdateInterval = (updatesPerSecond > 0) ? 1000000000LL / updatesPerSecond : 0;
+  m_NextProgressUpdate = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int Observable::getProgressUpdateRate() const
+{
+  int64_t interval = m_ProgressUpdateInterval;
+  return (interval > 0) ? static_cast<int>(1000000000LL / interval) : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool Observable::isProgressUpdateDue()
+{
+  int64_t interval = m_ProgressUpdateInterval.load(std::memory_order_relaxed);
+  if(interval <= 0)
+  {
+    return true;
+  }
+  int64_t now = SteadyClockNanoseconds();
+  int64_t next = m_NextProgressUpdate.load(std::memory_order_relaxed);
+  if(now < next)
+  {
+    return false;
+  }
+  // Only one of several racing threads gets the slot
+  return m_NextProgressUpdate.compare_exchange_strong(next, now + interval, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Observable::notifyCoalescedProgressMessage(const QString& prefix, const QString& humanLabel, const QString& str, int progress)
+{
+  // The atomic check keeps the hot path free of the lock and of any string copies
+  if(!isProgressUpdateDue())
+  {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(m_ProgressMutex);
+  notifyProgressMessage(prefix, humanLabel, str, progress);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Observable::initializeProgress(const QString& prefix, const QString& humanLabel, const QString& str, uint64_t total)
+{
+  std::lock_guard<std::mutex> lock(m_ProgressMutex);
+  m_ProgressPrefix = prefix;
+  m_ProgressHumanLabel = humanLabel;
+  m_ProgressText = str;
+  m_ProgressTotal = total;
+  m_ProgressCount = 0;
+  m_ReportedProgressCount = 0;
+  m_NextProgressUpdate = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Observable::incrementProgress(uint64_t amount)
+{
+  uint64_t count = m_ProgressCount.fetch_add(amount, std::memory_order_relaxed) + amount;
+  if(count >= m_ProgressTotal)
+  {
+    // Only the increment that crosses the total reports completion
+    if(count - amount >= m_ProgressTotal)
+    {
+      return;
+    }
+  }
+  else if(!isProgressUpdateDue())
+  {
+    // Nothing to store; the counter itself is the held back update
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_ProgressMutex);
+  emitProgressCount();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Observable::emitProgressCount()
+{
+  // Report the newest count, and never a count older than one that already went out
+  uint64_t count = m_ProgressCount.load(std::memory_order_relaxed);
+  if(count <= m_ReportedProgressCount)
+  {
+    return;
+  }
+  m_ReportedProgressCount = count;
+
+  int progress = 100;
+  if(m_ProgressTotal > 0)
+  {
+    progress = static_cast<int>(std::min(count, m_ProgressTotal) * 100 / m_ProgressTotal);
+  }
+  QString ss = QObject::tr("%1 || %2% Complete").arg(m_ProgressText).arg(progress);
+  notifyProgressMessage(m_ProgressPrefix, m_ProgressHumanLabel, ss, progress);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Observable::flushProgressMessage()
+{
+  std::lock_guard<std::mutex> lock(m_ProgressMutex);
+  if(m_ProgressTotal > 0)
+  {
+    emitProgressCount();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t Observable::getProgressCount() const
+{
+  return m_ProgressCount;
+}
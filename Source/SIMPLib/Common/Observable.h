@@ -36,6 +36,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
 #include <QtCore/QString>
 
 #include "SIMPLib/SIMPLib.h"
@@ -83,6 +87,72 @@ class SIMPLib_EXPORT Observable : public QObject
 
     virtual void notifyProgressMessage(const QString& prefix, const QString& humanLabel, const QString& str, int progress);
 
+    // ------------------------------
+    // Coalesced progress channel. Intermediate updates from hot loops are rate limited per object. A
+    // message that arrives inside an interval is dropped before anything is locked or copied. The
+    // progress counter is never lost: its newest value goes out on the next due update or when
+    // flushProgressMessage() is called at the end of the filter.
+    // ------------------------------
+
+    /**
+     * @brief Sets the maximum number of coalesced progress updates emitted per second. A value of zero
+     * or less lets every update through.
+     * @param updatesPerSecond
+     */
+    void setProgressUpdateRate(int updatesPerSecond);
+
+    /**
+     * @brief Returns the maximum number of coalesced progress updates emitted per second
+     * @return
+     */
+    int getProgressUpdateRate() const;
+
+    /**
+     * @brief Returns true, and claims the current slot, when a coalesced update may be emitted now.
+     * This is a single atomic check so hot loops can call it before building any message text.
+     * @return
+     */
+    bool isProgressUpdateDue();
+
+    /**
+     * @brief Emits the same message as notifyProgressMessage() if a coalesced update is due and drops it
+     * otherwise. Loops that build their text per iteration should check isProgressUpdateDue() themselves,
+     * or use incrementProgress(), so no text is formatted for dropped updates.
+     * @param prefix
+     * @param humanLabel
+     * @param str
+     * @param progress
+     */
+    void notifyCoalescedProgressMessage(const QString& prefix, const QString& humanLabel, const QString& str, int progress);
+
+    /**
+     * @brief Resets the integer progress counter driven by incrementProgress().
+     * @param prefix Message prefix used for the generated updates
+     * @param humanLabel Human label used for the generated updates
+     * @param str Text of the generated updates; the percentage is appended
+     * @param total Count that corresponds to 100%
+     */
+    void initializeProgress(const QString& prefix, const QString& humanLabel, const QString& str, uint64_t total);
+
+    /**
+     * @brief Atomically adds to the progress counter and emits a coalesced update when one is due. The
+     * update for reaching the total is always emitted. Safe to call from several threads at once.
+     * @param amount
+     */
+    void incrementProgress(uint64_t amount = 1);
+
+    /**
+     * @brief Returns the current value of the progress counter
+     * @return
+     */
+    uint64_t getProgressCount() const;
+
+    /**
+     * @brief Emits the current value of the progress counter if it was never reported. The pipeline
+     * calls this after each filter executes.
+     */
+    void flushProgressMessage();
+
   public slots:
 
     /**
@@ -101,6 +171,25 @@ class SIMPLib_EXPORT Observable : public QObject
      * @param msg
      */
     void filterGeneratedMessage(const PipelineMessage& msg);
+
+  private:
+    std::atomic<int64_t> m_ProgressUpdateInterval;
+    std::atomic<int64_t> m_NextProgressUpdate;
+    std::atomic<uint64_t> m_ProgressCount;
+    uint64_t m_ProgressTotal = 0;
+    QString m_ProgressPrefix;
+    QString m_ProgressHumanLabel;
+    QString m_ProgressText;
+
+    // Serializes the coalesced updates so they arrive in order and the newest count is never lost
+    std::mutex m_ProgressMutex;
+    uint64_t m_ReportedProgressCount = 0;
+
+    /**
+     * @brief Emits the progress counter update unless a newer one was already emitted.
+     * Must be called with m_ProgressMutex held.
+     */
+    void emitProgressCount();
 };
 
 
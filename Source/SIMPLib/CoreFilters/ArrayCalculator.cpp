@@ -54,6 +54,7 @@
 #include "util/ATanOperator.h"
 #include "util/AdditionOperator.h"
 #include "util/CalculatorArray.hpp"
+#include "util/CalculatorKernel.h"
 #include "util/CeilOperator.h"
 #include "util/CommaSeparator.h"
 #include "util/CosOperator.h"
@@ -279,7 +280,7 @@ void ArrayCalculator::dataCheck()
       ICalculatorArray::Pointer array1 = std::dynamic_pointer_cast<ICalculatorArray>(item1);
       if (item1->isArray())
       {
-        if (cDims.isEmpty() == false && resultType == ICalculatorArray::ValueType::Array && cDims != array1->getArray()->getComponentDimensions())
+        if (cDims.isEmpty() == false && resultType == ICalculatorArray::ValueType::Array && cDims != array1->getComponentDimensions())
         {
           QString ss = QObject::tr("Attribute Array symbols in the infix expression have mismatching component dimensions");
           setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::INCONSISTENT_COMP_DIMS));
@@ -288,12 +289,12 @@ void ArrayCalculator::dataCheck()
         }
 
         resultType = ICalculatorArray::ValueType::Array;
-        cDims = array1->getArray()->getComponentDimensions();
+        cDims = array1->getComponentDimensions();
       }
       else if (resultType == ICalculatorArray::ValueType::Unknown)
       {
         resultType = ICalculatorArray::ValueType::Number;
-        cDims = array1->getArray()->getComponentDimensions();
+        cDims = array1->getComponentDimensions();
       }
     }
   }
@@ -414,11 +415,27 @@ void ArrayCalculator::execute()
   // Convert the parsed infix expression into RPN
   QVector<CalculatorItem::Pointer> rpn = toRPN(parsedInfix);
 
+  // Evaluate the whole expression in one fused pass directly into the output array when possible
+  IDataArray::Pointer outputArray = getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, m_CalculatedArray);
+  CalculatorKernel::Pointer kernel = CalculatorKernel::Compile(rpn, m_Units == Degrees);
+  if(nullptr != kernel && kernel->canWriteTo(outputArray))
+  {
+    notifyStatusMessage(getMessagePrefix(), getHumanLabel(), "Computing Expression");
+    if(kernel->execute(outputArray, this) == false)
+    {
+      return;
+    }
+
+    notifyStatusMessage(getHumanLabel(), "Complete");
+    return;
+  }
+
   // Execute the RPN expression
   int totalItems = rpn.size();
+  initializeProgress(getMessagePrefix(), getHumanLabel(), "Computing Operators", static_cast<uint64_t>(totalItems));
   for(int rpnCount = 0; rpnCount < totalItems; rpnCount++)
   {
-    notifyStatusMessage(getMessagePrefix(), getHumanLabel(), "Computing Operator " + QString::number(rpnCount + 1) + "/" + QString::number(totalItems));
+    incrementProgress();
 
     CalculatorItem::Pointer rpnItem = rpn[rpnCount];
     ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(rpnItem);
@@ -853,9 +870,9 @@ bool ArrayCalculator::parseIndexOperator(QString token, QVector<CalculatorItem::
   }
 
   ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(parsedInfix.back());
-  if(nullptr != calcArray && index >= calcArray->getArray()->getNumberOfComponents())
+  if(nullptr != calcArray && index >= calcArray->getNumberOfComponents())
   {
-    QString ss = QObject::tr("'%1' has an component index that is out of range").arg(calcArray->getArray()->getName());
+    QString ss = QObject::tr("'%1' has an component index that is out of range").arg(calcArray->getSourceArray()->getName());
     setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::COMPONENT_OUT_OF_RANGE));
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
     return false;
@@ -863,10 +880,8 @@ bool ArrayCalculator::parseIndexOperator(QString token, QVector<CalculatorItem::
 
   parsedInfix.pop_back();
 
-  DoubleArrayType::Pointer reducedArray = calcArray->reduceToOneComponent(index, !getInPreflight());
-  CalculatorItem::Pointer itemPtr;
-
-  CREATE_CALCULATOR_ARRAY(itemPtr, reducedArray)
+  // The selected component is read straight from the source array when the expression is evaluated
+  CalculatorItem::Pointer itemPtr = calcArray->selectComponent(index);
   parsedInfix.push_back(itemPtr);
 
   QString ss = QObject::tr("Item '%1' in the infix expression is the name of an array in the selected Attribute Matrix, but it is currently being used as an indexing operator").arg(token);
@@ -925,6 +940,13 @@ bool ArrayCalculator::parseArray(QString token, QVector<CalculatorItem::Pointer>
   }
 
   IDataArray::Pointer dataArray = selectedAM->getAttributeArray(token);
+  if(dataArray->loadData() == false)
+  {
+    QString ss = QObject::tr("The values of the array '%1' could not be read from the file they were loaded from").arg(token);
+    setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::ARRAY_NOT_LOADED));
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return false;
+  }
   if(firstArray_NumTuples < 0 && firstArray_Name.isEmpty() == true)
   {
     firstArray_NumTuples = dataArray->getNumberOfTuples();
@@ -354,6 +354,13 @@ void ConvertData::execute()
     setErrorCondition(-90002);
     return;
   }
+  if (iArray->loadData() == false)
+  {
+    QString ss = QObject::tr("The values of the array '%1' could not be read from the file they were loaded from").arg(iArray->getName());
+    setErrorCondition(-90003);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
 
   bool completed = false;
   CHECK_AND_CONVERT(Int8ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
@@ -35,8 +35,15 @@
 
 #include "CropVertexGeometry.h"
 
+#include <algorithm>
 #include <cassert>
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -46,6 +53,97 @@
 #include "SIMPLib/Geometry/VertexGeom.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
+/**
+ * @brief The FindCroppedVerticesImpl class tests the vertices of a range of blocks against the crop
+ * box. Each block collects its own kept vertex Ids so the blocks can be scanned in any order and
+ * joined afterwards without sorting.
+ */
+class FindCroppedVerticesImpl
+{
+public:
+  FindCroppedVerticesImpl(const float* verts, int64_t numVerts, int64_t blockSize, const float ll[3], const float ur[3], std::vector<std::vector<int64_t>>& blockPoints)
+  : m_Verts(verts)
+  , m_NumVerts(numVerts)
+  , m_BlockSize(blockSize)
+  , m_LL(ll)
+  , m_UR(ur)
+  , m_BlockPoints(blockPoints)
+  {
+  }
+  virtual ~FindCroppedVerticesImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t b = start; b < end; b++)
+    {
+      std::vector<int64_t>& points = m_BlockPoints[b];
+      int64_t first = static_cast<int64_t>(b) * m_BlockSize;
+      int64_t last = std::min(first + m_BlockSize, m_NumVerts);
+      for(int64_t i = first; i < last; i++)
+      {
+        const float* v = m_Verts + 3 * i;
+        if(v[0] >= m_LL[0] && v[0] <= m_UR[0] && v[1] >= m_LL[1] && v[1] <= m_UR[1] && v[2] >= m_LL[2] && v[2] <= m_UR[2])
+        {
+          points.push_back(i);
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const float* m_Verts;
+  int64_t m_NumVerts;
+  int64_t m_BlockSize;
+  const float* m_LL;
+  const float* m_UR;
+  std::vector<std::vector<int64_t>>& m_BlockPoints;
+};
+
+/**
+ * @brief The CopyCroppedVerticesImpl class copies the coordinates of the kept vertices into the cropped geometry
+ */
+class CopyCroppedVerticesImpl
+{
+public:
+  CopyCroppedVerticesImpl(const float* srcVerts, float* destVerts, const std::vector<int64_t>& croppedPoints)
+  : m_SrcVerts(srcVerts)
+  , m_DestVerts(destVerts)
+  , m_CroppedPoints(croppedPoints)
+  {
+  }
+  virtual ~CopyCroppedVerticesImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      const float* src = m_SrcVerts + 3 * m_CroppedPoints[i];
+      m_DestVerts[3 * i + 0] = src[0];
+      m_DestVerts[3 * i + 1] = src[1];
+      m_DestVerts[3 * i + 2] = src[2];
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const float* m_SrcVerts;
+  float* m_DestVerts;
+  const std::vector<int64_t>& m_CroppedPoints;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -251,38 +349,58 @@ void CropVertexGeometry::execute()
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
   DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getCroppedDataContainerName());
   VertexGeom::Pointer vertices = getDataContainerArray()->getDataContainer(getDataContainerName())->getGeometryAs<VertexGeom>();
-  int64_t numVerts = vertices->getNumberOfVertices();
-  float* allVerts = vertices->getVertexPointer(0);
-  std::vector<int64_t> croppedPoints;
-  croppedPoints.reserve(numVerts);
 
-  for(int64_t i = 0; i < numVerts; i++)
+  float ll[3] = {m_XMin, m_YMin, m_ZMin};
+  float ur[3] = {m_XMax, m_YMax, m_ZMax};
+  int64_t numVerts = vertices->getNumberOfVertices();
+  int64_t blockSize = 65536;
+  size_t numBlocks = static_cast<size_t>((numVerts + blockSize - 1) / blockSize);
+  std::vector<std::vector<int64_t>> blockPoints(numBlocks);
+  FindCroppedVerticesImpl findImpl(vertices->getVertices()->getConstPointer(0), numVerts, blockSize, ll, ur, blockPoints);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel == true)
   {
-    if(getCancel())
-    {
-      return;
-    }
-    if(allVerts[3 * i + 0] >= m_XMin && allVerts[3 * i + 0] <= m_XMax && allVerts[3 * i + 1] >= m_YMin && allVerts[3 * i + 1] <= m_YMax && allVerts[3 * i + 2] >= m_ZMin &&
-       allVerts[3 * i + 2] <= m_ZMax)
-    {
-      croppedPoints.push_back(i);
-    }
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numBlocks), findImpl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    findImpl.compute(0, numBlocks);
+  }
+  if(getCancel())
+  {
+    return;
   }
 
-  croppedPoints.shrink_to_fit();
+  // Joining the blocks in order keeps the vertices in their original order
+  size_t numCropped = 0;
+  for(const std::vector<int64_t>& points : blockPoints)
+  {
+    numCropped += points.size();
+  }
+  std::vector<int64_t> croppedPoints;
+  croppedPoints.reserve(numCropped);
+  for(std::vector<int64_t>& points : blockPoints)
+  {
+    croppedPoints.insert(croppedPoints.end(), points.begin(), points.end());
+    std::vector<int64_t>().swap(points);
+  }
 
   VertexGeom::Pointer crop = dc->getGeometryAs<VertexGeom>();
   crop->resizeVertexList(croppedPoints.size());
-  float coords[3] = {0.0f, 0.0f, 0.0f};
+  CopyCroppedVerticesImpl impl(vertices->getVertices()->getConstPointer(0), crop->getVertexPointer(0), croppedPoints);
 
-  for(std::list<int64_t>::size_type i = 0; i < croppedPoints.size(); i++)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
   {
-    if(getCancel())
-    {
-      return;
-    }
-    vertices->getCoords(croppedPoints[i], coords);
-    crop->setCoords(i, coords);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, croppedPoints.size()), impl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    impl.compute(0, croppedPoints.size());
   }
 
   QVector<size_t> tDims(1, croppedPoints.size());
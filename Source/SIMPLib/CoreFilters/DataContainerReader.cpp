@@ -58,6 +58,7 @@
 DataContainerReader::DataContainerReader()
 : m_InputFile("")
 , m_OverwriteExistingDataContainers(false)
+, m_LoadArraysOnDemand(false)
 , m_LastFileRead("")
 , m_LastRead(QDateTime::currentDateTime())
 , m_InputFileDataContainerArrayProxy()
@@ -78,6 +79,7 @@ void DataContainerReader::setupFilterParameters()
   FilterParameterVector parameters;
 
   parameters.push_back(SIMPL_NEW_BOOL_FP("Overwrite Existing Data Containers", OverwriteExistingDataContainers, FilterParameter::Parameter, DataContainerReader));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Load Arrays On Demand", LoadArraysOnDemand, FilterParameter::Parameter, DataContainerReader));
   {
     DataContainerReaderFilterParameter::Pointer parameter = DataContainerReaderFilterParameter::New();
     parameter->setHumanLabel("Select Arrays from Input File");
@@ -102,6 +104,7 @@ void DataContainerReader::readFilterParameters(AbstractFilterParametersReader* r
   setInputFileDataContainerArrayProxy(reader->readDataContainerArrayProxy("InputFileDataContainerArrayProxy", getInputFileDataContainerArrayProxy()));
   syncProxies(); // Sync the file proxy and currently cached proxy together into one proxy
   setOverwriteExistingDataContainers(reader->readValue("OverwriteExistingDataContainers", getOverwriteExistingDataContainers()));
+  setLoadArraysOnDemand(reader->readValue("LoadArraysOnDemand", getLoadArraysOnDemand()));
   reader->closeFilterGroup();
 }
 
@@ -265,6 +268,7 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
   {
     return DataContainerArray::New();
   }
+  simplReader->setLoadArraysOnDemand(getLoadArraysOnDemand());
 
   DataContainerArray::Pointer dca = simplReader->readSIMPLDataUsingProxy(proxy, getInPreflight());
   if(dca == DataContainerArray::NullPointer())
@@ -58,6 +58,7 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
     PYB11_CREATE_BINDINGS(DataContainerReader SUPERCLASS AbstractFilter)
     PYB11_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
     PYB11_PROPERTY(bool OverwriteExistingDataContainers READ getOverwriteExistingDataContainers WRITE setOverwriteExistingDataContainers)
+    PYB11_PROPERTY(bool LoadArraysOnDemand READ getLoadArraysOnDemand WRITE setLoadArraysOnDemand)
     PYB11_PROPERTY(QString LastFileRead READ getLastFileRead WRITE setLastFileRead)
     PYB11_PROPERTY(QDateTime LastRead READ getLastRead WRITE setLastRead)
     PYB11_PROPERTY(DataContainerArrayProxy InputFileDataContainerArrayProxy READ getInputFileDataContainerArrayProxy WRITE setInputFileDataContainerArrayProxy)
@@ -77,6 +78,9 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
     SIMPL_FILTER_PARAMETER(bool, OverwriteExistingDataContainers)
     Q_PROPERTY(bool OverwriteExistingDataContainers READ getOverwriteExistingDataContainers WRITE setOverwriteExistingDataContainers)
 
+    SIMPL_FILTER_PARAMETER(bool, LoadArraysOnDemand)
+    Q_PROPERTY(bool LoadArraysOnDemand READ getLoadArraysOnDemand WRITE setLoadArraysOnDemand)
+
     SIMPL_FILTER_PARAMETER(QString, LastFileRead)
     Q_PROPERTY(QString LastFileRead READ getLastFileRead WRITE setLastFileRead)
 
@@ -45,6 +45,7 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersWriter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/SIMPLibVersion.h"
@@ -66,6 +67,7 @@ DataContainerWriter::DataContainerWriter()
 , m_WriteXdmfFile(true)
 , m_WriteTimeSeries(false)
 , m_AppendToExisting(false)
+, m_CompressionLevel(0)
 , m_FileId(-1)
 {
 }
@@ -88,6 +90,7 @@ void DataContainerWriter::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output File", OutputFile, FilterParameter::Parameter, DataContainerWriter, "*.dream3d", ""));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Write Xdmf File", WriteXdmfFile, FilterParameter::Parameter, DataContainerWriter));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Include Xdmf Time Markers", WriteTimeSeries, FilterParameter::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Compression Level (0-9)", CompressionLevel, FilterParameter::Parameter, DataContainerWriter));
 
   setFilterParameters(parameters);
 }
@@ -100,6 +103,7 @@ void DataContainerWriter::readFilterParameters(AbstractFilterParametersReader* r
   reader->openFilterGroup(this, index);
   setOutputFile(reader->readString("OutputFile", getOutputFile()));
   setWriteXdmfFile(reader->readValue("WriteXdmfFile", getWriteXdmfFile()));
+  setCompressionLevel(reader->readValue("CompressionLevel", getCompressionLevel()));
   reader->closeFilterGroup();
 }
 
@@ -146,6 +150,13 @@ void DataContainerWriter::dataCheck()
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
   }
 
+  if(m_CompressionLevel < 0 || m_CompressionLevel > 9)
+  {
+    setErrorCondition(-10004);
+    ss = QObject::tr("The compression level must be between 0 (no compression) and 9 (maximum compression)");
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
+
 #ifdef _WIN32
   // Turn file permission checking on, if requested
 #ifdef SIMPL_NTFS_FILE_CHECK
@@ -262,6 +273,17 @@ void DataContainerWriter::execute()
   hid_t dcaGid = H5Gopen(m_FileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
   scopedFileSentinel.addGroupId(&dcaGid);
 
+  // Large arrays are chunked and deflated when a compression level is requested. Arrays
+  // that have their own override in the policy keep those settings.
+  H5DatasetCreationPolicy policy = m_DatasetCreationPolicy;
+  if(m_CompressionLevel > 0)
+  {
+    H5DatasetCreationPolicy::Settings settings = policy.getDefaults();
+    settings.chunked = true;
+    settings.deflateLevel = m_CompressionLevel;
+    policy.setDefaults(settings);
+  }
+
   QList<QString> dcNames = getDataContainerArray()->getDataContainerNames();
   for(int iter = 0; iter < getDataContainerArray()->getNumDataContainers(); iter++)
   {
@@ -281,13 +303,13 @@ void DataContainerWriter::execute()
     // QString ss = QObject::tr("%1 |--> Writing %2 DataContainer ").arg(getMessagePrefix()).arg(dcNames[iter]);
 
     // Have the DataContainer write all of its Attribute Matrices and its Mesh
-    err = dc->writeAttributeMatricesToHDF5(dcGid);
+    err = dc->writeAttributeMatricesToHDF5(dcGid, policy);
     if(err < 0)
     {
       notifyErrorMessage(getHumanLabel(), "Error writing DataContainer AttributeMatrices", -803);
       return;
     }
-    err = dc->writeMeshToHDF5(dcGid, m_WriteXdmfFile);
+    err = dc->writeMeshToHDF5(dcGid, m_WriteXdmfFile, policy);
     if(err < 0)
     {
       notifyErrorMessage(getHumanLabel(), "Error writing DataContainer Geometry", -804);
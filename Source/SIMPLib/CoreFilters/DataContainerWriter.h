@@ -38,6 +38,7 @@
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/HDF5/H5DatasetCreationPolicy.h"
 #include "SIMPLib/SIMPLib.h"
 
 /**
@@ -52,6 +53,7 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
     PYB11_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
     PYB11_PROPERTY(bool WriteXdmfFile READ getWriteXdmfFile WRITE setWriteXdmfFile)
     PYB11_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
+    PYB11_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
 
   public:
     SIMPL_SHARED_POINTERS(DataContainerWriter)
@@ -73,6 +75,16 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
 
     SIMPL_INSTANCE_PROPERTY(bool, AppendToExisting)
 
+    SIMPL_FILTER_PARAMETER(int, CompressionLevel)
+    Q_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+
+    /**
+     * @brief The dataset creation policy used for every array and geometry list that
+     * is written. Per array overrides can be added to it programmatically. A non zero
+     * CompressionLevel replaces the default settings of this policy.
+     */
+    SIMPL_INSTANCE_PROPERTY(H5DatasetCreationPolicy, DatasetCreationPolicy)
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
@@ -46,6 +46,7 @@
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Utilities/BulkTextWriter.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -259,32 +260,57 @@ void FeatureDataCSVWriter::execute()
     numTuples = data[0]->getNumberOfTuples();
   }
 
-  float threshold = 0.0f;
-
-  // Skip feature 0
-  for(size_t i = 1; i < numTuples; ++i)
+  // Float and double columns keep the precision used by IDataArray::printTuple()
+  std::vector<BulkTextWriter::TupleFunction> formatters;
+  bool parallel = true;
+  for(std::vector<IDataArray::Pointer>::iterator p = data.begin(); p != data.end(); ++p)
   {
-    float percentIncrement = static_cast<float>(i) / static_cast<float>(numTuples) * 100.0f;
-    if(percentIncrement > threshold)
+    BulkTextWriter::TupleFunction formatter = BulkTextWriter::CreateTupleFormatter(*p, 8, 16);
+    if(!formatter)
     {
-      QString ss = QObject::tr("Writing Feature Data || %1% Complete").arg(static_cast<double>(percentIncrement));
-      notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
-      threshold = threshold + 5.0f;
-      if(threshold < percentIncrement)
-      {
-        threshold = percentIncrement;
-      }
+      // Any other array type prints itself, which is only safe from one thread
+      IDataArray* array = (*p).get();
+      formatter = [array](QByteArray& buffer, size_t tuple, char delimiter) {
+        QString text;
+        QTextStream stream(&text);
+        array->printTuple(stream, tuple, delimiter);
+        stream.flush();
+        buffer.append(text.toUtf8());
+      };
+      parallel = false;
     }
+    formatters.push_back(formatter);
+  }
 
-    // Print the feature id
-    outFile << i;
-    // Print a row of data
-    for(std::vector<IDataArray::Pointer>::iterator p = data.begin(); p != data.end(); ++p)
+  char delimiter = m_Delimiter;
+  BulkTextWriter::FormatFunction format = [&formatters, delimiter](size_t start, size_t end, QByteArray& buffer) {
+    for(size_t row = start; row < end; row++)
     {
-      outFile << m_Delimiter;
-      (*p)->printTuple(outFile, i, m_Delimiter);
+      // Skip feature 0
+      size_t featureId = row + 1;
+      BulkTextWriter::AppendValue(buffer, featureId);
+      for(const BulkTextWriter::TupleFunction& formatter : formatters)
+      {
+        buffer.append(delimiter);
+        formatter(buffer, featureId, delimiter);
+      }
+      buffer.append('\n');
     }
-    outFile << "\n";
+  };
+  BulkTextWriter::ProgressFunction progress = [this, numTuples](size_t rowsWritten) {
+    QString ss = QObject::tr("Writing Feature Data || %1% Complete").arg(static_cast<double>(rowsWritten + 1) / static_cast<double>(numTuples) * 100.0);
+    notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
+  };
+
+  // The rows bypass the text stream, so everything it buffered has to reach the file first
+  outFile.flush();
+  size_t numRows = (numTuples > 1) ? numTuples - 1 : 0;
+  if(!BulkTextWriter::WriteChunks(file, numRows, format, parallel, progress))
+  {
+    QString ss = QObject::tr("Output file could not be written: %1").arg(getFeatureDataFile());
+    setErrorCondition(-101);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
   }
 
   if(m_WriteNeighborListData == true)
@@ -35,6 +35,10 @@
 
 #include "MultiThresholdObjects2.h"
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/ComparisonSelectionAdvancedFilterParameter.h"
@@ -43,6 +47,268 @@
 #include "SIMPLib/Filtering/ThresholdFilterHelper.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+namespace
+{
+// Number of tuples evaluated at a time. The intermediate masks for one tile stay in cache.
+const size_t k_ThresholdTileSize = 4096;
+
+typedef void (*CompareTileFunction)(const void* data, double value, size_t start, size_t count, uint8_t* out);
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void LessThanTile(const void* data, double value, size_t start, size_t count, uint8_t* out)
+{
+  const T* ptr = static_cast<const T*>(data) + start;
+  const T v = static_cast<T>(value);
+  for(size_t i = 0; i < count; i++)
+  {
+    out[i] = static_cast<uint8_t>(ptr[i] < v);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void GreaterThanTile(const void* data, double value, size_t start, size_t count, uint8_t* out)
+{
+  const T* ptr = static_cast<const T*>(data) + start;
+  const T v = static_cast<T>(value);
+  for(size_t i = 0; i < count; i++)
+  {
+    out[i] = static_cast<uint8_t>(ptr[i] > v);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void EqualToTile(const void* data, double value, size_t start, size_t count, uint8_t* out)
+{
+  const T* ptr = static_cast<const T*>(data) + start;
+  const T v = static_cast<T>(value);
+  for(size_t i = 0; i < count; i++)
+  {
+    out[i] = static_cast<uint8_t>(ptr[i] == v);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void NotEqualToTile(const void* data, double value, size_t start, size_t count, uint8_t* out)
+{
+  const T* ptr = static_cast<const T*>(data) + start;
+  const T v = static_cast<T>(value);
+  for(size_t i = 0; i < count; i++)
+  {
+    out[i] = static_cast<uint8_t>(ptr[i] != v);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// An unknown operator leaves the mask false, matching ThresholdFilterHelper
+// -----------------------------------------------------------------------------
+void FalseTile(const void* data, double value, size_t start, size_t count, uint8_t* out)
+{
+  ::memset(out, 0, count);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> bool ResolveCompareFunction(const IDataArray::Pointer& input, int compOperator, CompareTileFunction& compare, const void*& data)
+{
+  typename DataArray<T>::Pointer array = std::dynamic_pointer_cast<DataArray<T>>(input);
+  if(nullptr == array)
+  {
+    return false;
+  }
+  data = array->getVoidPointer(0);
+  switch(compOperator)
+  {
+  case SIMPL::Comparison::Operator_LessThan:
+    compare = LessThanTile<T>;
+    break;
+  case SIMPL::Comparison::Operator_GreaterThan:
+    compare = GreaterThanTile<T>;
+    break;
+  case SIMPL::Comparison::Operator_Equal:
+    compare = EqualToTile<T>;
+    break;
+  case SIMPL::Comparison::Operator_NotEqual:
+    compare = NotEqualToTile<T>;
+    break;
+  default:
+    compare = FalseTile;
+    break;
+  }
+  return true;
+}
+
+/**
+ * @brief The ThresholdNode struct is one entry of a compiled comparison tree. A set node combines
+ * its children in order with their union operators; a value node compares one array against a constant.
+ */
+struct ThresholdNode
+{
+  bool isSet = false;
+  int unionOperator = SIMPL::Union::Operator_And;
+  bool invert = false;
+  CompareTileFunction compare = nullptr;
+  const void* data = nullptr;
+  double value = 0.0;
+  std::vector<size_t> children;
+};
+
+/**
+ * @brief The FusedThresholdImpl class evaluates a compiled comparison tree one tile at a time and writes
+ * the final mask directly. Each level of the tree only needs a single tile sized scratch mask, so no full
+ * size temporary arrays are created no matter how many comparisons there are.
+ */
+class FusedThresholdImpl
+{
+public:
+  FusedThresholdImpl(const std::vector<ThresholdNode>& nodes, size_t depth, bool* destination)
+  : m_Nodes(nodes)
+  , m_Depth(depth)
+  , m_Destination(destination)
+  {
+  }
+  virtual ~FusedThresholdImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    std::vector<uint8_t> scratch((m_Depth + 1) * k_ThresholdTileSize);
+    for(size_t tileStart = start; tileStart < end; tileStart += k_ThresholdTileSize)
+    {
+      size_t count = std::min(k_ThresholdTileSize, end - tileStart);
+      uint8_t* mask = scratch.data();
+      evaluate(0, tileStart, count, mask, scratch.data() + k_ThresholdTileSize);
+      bool* dest = m_Destination + tileStart;
+      for(size_t i = 0; i < count; i++)
+      {
+        dest[i] = (mask[i] != 0);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const std::vector<ThresholdNode>& m_Nodes;
+  size_t m_Depth;
+  bool* m_Destination;
+
+  void evaluate(size_t nodeIndex, size_t start, size_t count, uint8_t* out, uint8_t* scratch) const
+  {
+    const ThresholdNode& node = m_Nodes[nodeIndex];
+    if(!node.isSet)
+    {
+      node.compare(node.data, node.value, start, count, out);
+      return;
+    }
+
+    if(node.children.empty())
+    {
+      ::memset(out, 0, count);
+    }
+    for(size_t c = 0; c < node.children.size(); c++)
+    {
+      if(c == 0)
+      {
+        evaluate(node.children[c], start, count, out, scratch);
+        continue;
+      }
+      evaluate(node.children[c], start, count, scratch, scratch + k_ThresholdTileSize);
+      if(SIMPL::Union::Operator_Or == m_Nodes[node.children[c]].unionOperator)
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          out[i] |= scratch[i];
+        }
+      }
+      else
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          out[i] &= scratch[i];
+        }
+      }
+    }
+    if(node.invert)
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        out[i] ^= 1;
+      }
+    }
+  }
+};
+
+// -----------------------------------------------------------------------------
+// Appends a comparison, and for a ComparisonSet all of its children, to the node list
+// -----------------------------------------------------------------------------
+bool CompileThresholdNode(const AttributeMatrix::Pointer& am, const AbstractComparison::Pointer& comparison, std::vector<ThresholdNode>& nodes, size_t depth, size_t& maxDepth)
+{
+  size_t totalTuples = am->getNumberOfTuples();
+  maxDepth = std::max(maxDepth, depth);
+
+  size_t index = nodes.size();
+  nodes.push_back(ThresholdNode());
+  nodes[index].unionOperator = comparison->getUnionOperator();
+
+  if(ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(comparison))
+  {
+    nodes[index].isSet = true;
+    nodes[index].invert = comparisonSet->getInvertComparison();
+    QVector<AbstractComparison::Pointer> comparisons = comparisonSet->getComparisons();
+    for(int i = 0; i < comparisons.size(); i++)
+    {
+      if(nullptr == std::dynamic_pointer_cast<ComparisonSet>(comparisons[i]) && nullptr == std::dynamic_pointer_cast<ComparisonValue>(comparisons[i]))
+      {
+        continue;
+      }
+      size_t child = nodes.size();
+      if(!CompileThresholdNode(am, comparisons[i], nodes, depth + 1, maxDepth))
+      {
+        return false;
+      }
+      nodes[index].children.push_back(child);
+    }
+    return true;
+  }
+
+  ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(comparison);
+  IDataArray::Pointer input = am->getAttributeArray(comparisonValue->getAttributeArrayName());
+  if(nullptr == input || input->getNumberOfTuples() != totalTuples || input->getNumberOfComponents() != 1)
+  {
+    return false;
+  }
+  ThresholdNode& node = nodes[index];
+  node.value = comparisonValue->getCompValue();
+  int op = comparisonValue->getCompOperator();
+  return ResolveCompareFunction<float>(input, op, node.compare, node.data) || ResolveCompareFunction<double>(input, op, node.compare, node.data) ||
+         ResolveCompareFunction<int8_t>(input, op, node.compare, node.data) || ResolveCompareFunction<uint8_t>(input, op, node.compare, node.data) ||
+         ResolveCompareFunction<int16_t>(input, op, node.compare, node.data) || ResolveCompareFunction<uint16_t>(input, op, node.compare, node.data) ||
+         ResolveCompareFunction<int32_t>(input, op, node.compare, node.data) || ResolveCompareFunction<uint32_t>(input, op, node.compare, node.data) ||
+         ResolveCompareFunction<int64_t>(input, op, node.compare, node.data) || ResolveCompareFunction<uint64_t>(input, op, node.compare, node.data) ||
+         ResolveCompareFunction<bool>(input, op, node.compare, node.data);
+}
+
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -214,6 +480,10 @@ void MultiThresholdObjects2::execute()
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
     return;
   }
+  else if(executeFusedThreshold())
+  {
+    // The whole comparison tree was evaluated in a single pass
+  }
   else
   {
     bool invert = m_SelectedThresholds.shouldInvert();
@@ -258,6 +528,50 @@ void MultiThresholdObjects2::execute()
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MultiThresholdObjects2::executeFusedThreshold()
+{
+  // The top level list of comparisons behaves exactly like a ComparisonSet whose
+  // inversion is the global invert flag
+  std::vector<ThresholdNode> nodes(1);
+  nodes[0].isSet = true;
+  nodes[0].invert = m_SelectedThresholds.shouldInvert();
+  AttributeMatrix::Pointer am = getDataContainerArray()->getDataContainer(m_SelectedThresholds.getDataContainerName())->getAttributeMatrix(m_SelectedThresholds.getAttributeMatrixName());
+  size_t maxDepth = 0;
+  for(int32_t i = 0; i < m_SelectedThresholds.size(); ++i)
+  {
+    AbstractComparison::Pointer comparison = m_SelectedThresholds[i];
+    if(nullptr == std::dynamic_pointer_cast<ComparisonSet>(comparison) && nullptr == std::dynamic_pointer_cast<ComparisonValue>(comparison))
+    {
+      continue;
+    }
+    size_t child = nodes.size();
+    if(!CompileThresholdNode(am, comparison, nodes, 1, maxDepth))
+    {
+      return false;
+    }
+    nodes[0].children.push_back(child);
+  }
+
+  size_t totalTuples = m_DestinationPtr.lock()->getNumberOfTuples();
+  FusedThresholdImpl impl(nodes, maxDepth + 1, m_Destination);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, totalTuples, k_ThresholdTileSize), impl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    impl.compute(0, totalTuples);
+  }
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
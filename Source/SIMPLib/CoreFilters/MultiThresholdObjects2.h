@@ -208,6 +208,13 @@ class  SIMPLib_EXPORT MultiThresholdObjects2 : public AbstractFilter
     */
     void thresholdValue(ComparisonValue::Pointer comparisonValue, BoolArrayType::Pointer& inputThreshold, int32_t& err, bool replaceInput = false, bool inverse = false);
 
+    /**
+    * @brief Compiles the comparison tree and evaluates it in a single tiled, parallel pass that writes the
+    * destination mask directly. Returns false without touching the output when an input array cannot be
+    * handled, in which case the per comparison path is used instead.
+    * @return Whether the fused pass ran
+    */
+    bool executeFusedThreshold();
 
   private:
     DEFINE_DATAARRAY_VARIABLE(bool, Destination)
@@ -4,12 +4,24 @@
 
 #include "ReadASCIIData.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
 #include <QtCore/QFileInfo>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
+#include "SIMPLib/Filtering/PipelineProfiler.h"
 #include "SIMPLib/Utilities/StringOperations.h"
 
 #include "SIMPLib/FilterParameters/ReadASCIIDataFilterParameter.h"
@@ -20,8 +32,193 @@
 
 namespace {
    const QString k_Skip("Skip");
+
+   // Mapped files are handed to the threads in line aligned chunks of about this many bytes
+   const size_t k_ChunkSize = 1 << 20;
 }
 
+/**
+ * @brief The ASCIIDataChunk struct describes a line aligned block of a memory mapped file along with the
+ * tuple index of its first line and the first error found while parsing it.
+ */
+struct ASCIIDataChunk
+{
+  const char* begin = nullptr;
+  const char* end = nullptr;
+  size_t firstTuple = 0;
+  size_t numLines = 0;
+  int errorCondition = 0;
+  QString errorMessage;
+};
+
+/**
+ * @brief The CountASCIILinesImpl class counts the lines in each chunk so every chunk knows where its
+ * values go in the arrays before any of them is parsed.
+ */
+class CountASCIILinesImpl
+{
+  ASCIIDataChunk* m_Chunks;
+
+public:
+  CountASCIILinesImpl(ASCIIDataChunk* chunks)
+  : m_Chunks(chunks)
+  {
+  }
+
+  virtual ~CountASCIILinesImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      ASCIIDataChunk& chunk = m_Chunks[i];
+      chunk.numLines = static_cast<size_t>(std::count(chunk.begin, chunk.end, '\n'));
+      // The last line of the file does not need a line ending
+      if(chunk.end[-1] != '\n')
+      {
+        chunk.numLines++;
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+};
+
+/**
+ * @brief The ParseASCIIChunksImpl class tokenizes the lines of each chunk in place and lets the column
+ * parsers write the values straight into the arrays. A chunk stops at its first error.
+ */
+class ParseASCIIChunksImpl
+{
+  ReadASCIIData* m_Filter;
+  ASCIIDataChunk* m_Chunks;
+  const QList<AbstractDataParser::Pointer>& m_DataParsers;
+  const std::array<bool, 256>& m_Delimiters;
+  int m_NumColumns;
+  size_t m_NumTuples;
+  int m_BeginIndex;
+
+public:
+  ParseASCIIChunksImpl(ReadASCIIData* filter, ASCIIDataChunk* chunks, const QList<AbstractDataParser::Pointer>& dataParsers, const std::array<bool, 256>& delimiters, int numColumns,
+                       size_t numTuples, int beginIndex)
+  : m_Filter(filter)
+  , m_Chunks(chunks)
+  , m_DataParsers(dataParsers)
+  , m_Delimiters(delimiters)
+  , m_NumColumns(numColumns)
+  , m_NumTuples(numTuples)
+  , m_BeginIndex(beginIndex)
+  {
+  }
+
+  virtual ~ParseASCIIChunksImpl() = default;
+
+  void parseChunk(ASCIIDataChunk& chunk) const
+  {
+    if(m_Filter->getCancel())
+    {
+      return;
+    }
+
+    // Skipped columns have no parser but still count as columns
+    int numColumns = m_NumColumns;
+    std::vector<const char*> tokens(2 * numColumns);
+    size_t lastTuple = std::min(chunk.firstTuple + chunk.numLines, m_NumTuples);
+    const char* lineBegin = chunk.begin;
+    for(size_t tuple = chunk.firstTuple; tuple < lastTuple; tuple++)
+    {
+      const char* lineEnd = static_cast<const char*>(std::memchr(lineBegin, '\n', chunk.end - lineBegin));
+      if(nullptr == lineEnd)
+      {
+        lineEnd = chunk.end;
+      }
+      const char* nextLine = (lineEnd == chunk.end) ? chunk.end : lineEnd + 1;
+      if(lineEnd > lineBegin && lineEnd[-1] == '\r')
+      {
+        lineEnd--;
+      }
+
+      // Split on any delimiter and drop empty tokens, the same as StringOperations::TokenizeString()
+      int numTokens = 0;
+      const char* ptr = lineBegin;
+      while(ptr < lineEnd)
+      {
+        while(ptr < lineEnd && m_Delimiters[static_cast<unsigned char>(*ptr)])
+        {
+          ptr++;
+        }
+        if(ptr == lineEnd)
+        {
+          break;
+        }
+        const char* tokenBegin = ptr;
+        while(ptr < lineEnd && !m_Delimiters[static_cast<unsigned char>(*ptr)])
+        {
+          ptr++;
+        }
+        if(numTokens < numColumns)
+        {
+          tokens[2 * numTokens] = tokenBegin;
+          tokens[2 * numTokens + 1] = ptr;
+        }
+        numTokens++;
+      }
+
+      size_t lineNum = m_BeginIndex + tuple;
+      if(numTokens != numColumns)
+      {
+        QString ss = "Line " + QString::number(lineNum) + " has an inconsistent number of columns.\n";
+        QTextStream out(&ss);
+        out << "Expecting " << numColumns << " but found " << numTokens << "\n";
+        out << "Input line was:\n";
+        out << QString::fromUtf8(lineBegin, static_cast<int>(lineEnd - lineBegin));
+        chunk.errorCondition = ReadASCIIData::INCONSISTENT_COLS;
+        chunk.errorMessage = ss;
+        return;
+      }
+
+      for(const AbstractDataParser::Pointer& parser : m_DataParsers)
+      {
+        int index = parser->getColumnIndex();
+        ParserFunctor::ErrorObject obj = parser->parse(tokens[2 * index], tokens[2 * index + 1], tuple);
+        if(!obj.ok)
+        {
+          chunk.errorCondition = ReadASCIIData::CONVERSION_FAILURE;
+          chunk.errorMessage = obj.errorMessage + "(line " + QString::number(lineNum) + ", column " + QString::number(index) + ").";
+          return;
+        }
+      }
+
+      lineBegin = nextLine;
+    }
+
+    if(lastTuple > chunk.firstTuple)
+    {
+      m_Filter->incrementProgress(lastTuple - chunk.firstTuple);
+    }
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      parseChunk(m_Chunks[i]);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -443,7 +640,6 @@ void ReadASCIIData::execute()
   QStringList headers = wizardData.dataHeaders;
   QStringList dataTypes = wizardData.dataTypes;
   QList<char> delimiters = wizardData.delimiters;
-  bool consecutiveDelimiters = wizardData.consecutiveDelimiters;
   int numLines = wizardData.numberOfLines;
   int beginIndex = wizardData.beginIndex;
 
@@ -521,80 +717,229 @@ void ReadASCIIData::execute()
     }
   }
 
-  int insertIndex = 0;
-
   QFile inputFile(inputFilePath);
   if(inputFile.open(QIODevice::ReadOnly))
   {
-    QTextStream in(&inputFile);
-
-    for(int i = 1; i < beginIndex; i++)
-    {
-      // Skip to the first data line
-      in.readLine();
-    }
+    PipelineProfiler::Scope profileScope("Parse Lines");
 
-    float threshold = 0.0f;
     size_t numTuples = numLines - beginIndex + 1;
+    initializeProgress(getMessagePrefix(), getHumanLabel(), "Importing ASCII Data", numTuples);
 
-    for(int lineNum = beginIndex; lineNum <= numLines; lineNum++)
+    // Parse the file in place when it can be memory mapped. Files in a 16 bit encoding and
+    // delimiters that are not plain ASCII need the decoding done by QTextStream.
+    bool canMap = !delimiters.isEmpty();
+    for(char delimiter : delimiters)
     {
-      QString line = in.readLine();
-      QStringList tokens = StringOperations::TokenizeString(line, delimiters, consecutiveDelimiters);
+      canMap = canMap && static_cast<unsigned char>(delimiter) < 0x80;
+    }
+    qint64 fileSize = inputFile.size();
+    uchar* mappedFile = (canMap && fileSize > 0) ? inputFile.map(0, fileSize) : nullptr;
+    if(nullptr != mappedFile && fileSize >= 2 && ((mappedFile[0] == 0xFF && mappedFile[1] == 0xFE) || (mappedFile[0] == 0xFE && mappedFile[1] == 0xFF)))
+    {
+      inputFile.unmap(mappedFile);
+      mappedFile = nullptr;
+    }
 
-      if(dataTypes.size() != tokens.size())
+    if(nullptr != mappedFile)
+    {
+      const char* begin = reinterpret_cast<const char*>(mappedFile);
+      const char* end = begin + fileSize;
+      // QTextStream skips a UTF-8 byte order mark
+      if(fileSize >= 3 && mappedFile[0] == 0xEF && mappedFile[1] == 0xBB && mappedFile[2] == 0xBF)
       {
-        QString ss = "Line " + QString::number(lineNum) + " has an inconsistent number of columns.\n";
-        QTextStream out(&ss);
-        out << "Expecting " << dataTypes.size() << " but found " << tokens.size() << "\n";
-        out << "Input line was:\n";
-        out << line;
-        setErrorCondition(INCONSISTENT_COLS);
-        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-        return;
+        begin += 3;
       }
-
-      for(int i = 0; i < dataParsers.size(); i++)
+      for(int i = 1; i < beginIndex && begin < end; i++)
       {
-        AbstractDataParser::Pointer parser = dataParsers[i];
-        int index = parser->getColumnIndex();
-
-        ParserFunctor::ErrorObject obj = parser->parse(tokens[index], insertIndex);
-        if(!obj.ok)
-        {
-          QString errorMessage = obj.errorMessage;
-          QString ss = errorMessage + "(line " + QString::number(lineNum) + ", column " + QString::number(index) + ").";
-          setErrorCondition(CONVERSION_FAILURE);
-          notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-          return;
-        }
+        // Skip to the first data line
+        const char* lineEnd = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+        begin = (nullptr == lineEnd) ? end : lineEnd + 1;
       }
 
-      if((static_cast<float>(lineNum) / numTuples) * 100.0f > threshold)
-      {
-        // Print the status of the import
-        QString ss = QObject::tr("Importing ASCII Data || %1% Complete").arg((static_cast<float>(lineNum) / numTuples) * 100.0f, 0, 'f', 0);
-        notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
-        threshold = threshold + 5.0f;
-        if(threshold < (static_cast<float>(lineNum) / numTuples) * 100.0f)
-        {
-          threshold = (static_cast<float>(lineNum) / numTuples) * 100.0f;
-        }
-      }
+      parseMappedLines(begin, end, dataParsers);
+      inputFile.unmap(mappedFile);
+    }
+    else
+    {
+      QTextStream in(&inputFile);
 
-      if(getCancel())
+      for(int i = 1; i < beginIndex; i++)
       {
-        return;
+        // Skip to the first data line
+        in.readLine();
       }
 
-      insertIndex++;
+      parseStreamLines(in, dataParsers);
     }
     inputFile.close();
+
+    if(getErrorCondition() < 0 || getCancel())
+    {
+      return;
+    }
   }
 
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadASCIIData::parseMappedLines(const char* begin, const char* end, const QList<AbstractDataParser::Pointer>& dataParsers)
+{
+  ASCIIWizardData wizardData = getWizardData();
+  int numColumns = wizardData.dataTypes.size();
+  int beginIndex = wizardData.beginIndex;
+  size_t numTuples = wizardData.numberOfLines - beginIndex + 1;
+
+  std::array<bool, 256> delimiters;
+  delimiters.fill(false);
+  for(char delimiter : wizardData.delimiters)
+  {
+    delimiters[static_cast<unsigned char>(delimiter)] = true;
+  }
+
+  // Split the data into chunks that each end right after a line ending
+  std::vector<ASCIIDataChunk> chunks;
+  const char* chunkBegin = begin;
+  while(chunkBegin < end)
+  {
+    const char* chunkEnd = chunkBegin + std::min<size_t>(k_ChunkSize, end - chunkBegin);
+    const char* lineEnd = static_cast<const char*>(std::memchr(chunkEnd - 1, '\n', end - (chunkEnd - 1)));
+    chunkEnd = (nullptr == lineEnd) ? end : lineEnd + 1;
+
+    ASCIIDataChunk chunk;
+    chunk.begin = chunkBegin;
+    chunk.end = chunkEnd;
+    chunks.push_back(chunk);
+    chunkBegin = chunkEnd;
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, chunks.size()), CountASCIILinesImpl(chunks.data()), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    CountASCIILinesImpl serial(chunks.data());
+    serial.compute(0, chunks.size());
+  }
+
+  // Assign every chunk its first tuple and drop the ones past the last requested line
+  size_t numAvailableLines = 0;
+  size_t numUsedChunks = 0;
+  for(ASCIIDataChunk& chunk : chunks)
+  {
+    if(numAvailableLines >= numTuples)
+    {
+      break;
+    }
+    chunk.firstTuple = numAvailableLines;
+    numAvailableLines += chunk.numLines;
+    numUsedChunks++;
+  }
+  chunks.resize(numUsedChunks);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, chunks.size()), ParseASCIIChunksImpl(this, chunks.data(), dataParsers, delimiters, numColumns, numTuples, beginIndex), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    ParseASCIIChunksImpl serial(this, chunks.data(), dataParsers, delimiters, numColumns, numTuples, beginIndex);
+    serial.compute(0, chunks.size());
+  }
+
+  if(getCancel())
+  {
+    return;
+  }
+
+  // Report the error closest to the top of the file, as a line by line read would
+  for(const ASCIIDataChunk& chunk : chunks)
+  {
+    if(chunk.errorCondition < 0)
+    {
+      setErrorCondition(chunk.errorCondition);
+      notifyErrorMessage(getHumanLabel(), chunk.errorMessage, getErrorCondition());
+      return;
+    }
+  }
+
+  if(numAvailableLines < numTuples)
+  {
+    QString ss = "Line " + QString::number(beginIndex + numAvailableLines) + " has an inconsistent number of columns.\n";
+    QTextStream out(&ss);
+    out << "Expecting " << numColumns << " but found " << 0 << "\n";
+    out << "Input line was:\n";
+    setErrorCondition(INCONSISTENT_COLS);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadASCIIData::parseStreamLines(QTextStream& in, const QList<AbstractDataParser::Pointer>& dataParsers)
+{
+  ASCIIWizardData wizardData = getWizardData();
+  QStringList dataTypes = wizardData.dataTypes;
+  QList<char> delimiters = wizardData.delimiters;
+  bool consecutiveDelimiters = wizardData.consecutiveDelimiters;
+  int numLines = wizardData.numberOfLines;
+  int beginIndex = wizardData.beginIndex;
+
+  int insertIndex = 0;
+  for(int lineNum = beginIndex; lineNum <= numLines; lineNum++)
+  {
+    QString line = in.readLine();
+    QStringList tokens = StringOperations::TokenizeString(line, delimiters, consecutiveDelimiters);
+
+    if(dataTypes.size() != tokens.size())
+    {
+      QString ss = "Line " + QString::number(lineNum) + " has an inconsistent number of columns.\n";
+      QTextStream out(&ss);
+      out << "Expecting " << dataTypes.size() << " but found " << tokens.size() << "\n";
+      out << "Input line was:\n";
+      out << line;
+      setErrorCondition(INCONSISTENT_COLS);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+
+    for(int i = 0; i < dataParsers.size(); i++)
+    {
+      AbstractDataParser::Pointer parser = dataParsers[i];
+      int index = parser->getColumnIndex();
+
+      ParserFunctor::ErrorObject obj = parser->parse(tokens[index], insertIndex);
+      if(!obj.ok)
+      {
+        QString errorMessage = obj.errorMessage;
+        QString ss = errorMessage + "(line " + QString::number(lineNum) + ", column " + QString::number(index) + ").";
+        setErrorCondition(CONVERSION_FAILURE);
+        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+        return;
+      }
+    }
+
+    // Print the status of the import
+    incrementProgress();
+
+    if(getCancel())
+    {
+      return;
+    }
+
+    insertIndex++;
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -4,12 +4,18 @@
 
 #pragma once
 
+#include <memory>
+
+#include <QtCore/QTextStream>
+
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/SIMPLib.h"
 
 #include "SIMPLib/CoreFilters/util/ASCIIWizardData.hpp"
 
+class AbstractDataParser;
+
 /**
  * @brief The ReadASCIIData class. See [Filter documentation](@ref ReadASCIIData) for details.
  */
@@ -163,6 +169,22 @@ class SIMPLib_EXPORT ReadASCIIData : public AbstractFilter
   private:
     QMap<int, IDataArray::Pointer>        m_ASCIIArrayMap;
 
+    /**
+     * @brief Parses the data lines of a memory mapped file. The lines are split into chunks that are
+     * tokenized in place on several threads and converted directly into the arrays.
+     * @param begin First byte of the first data line
+     * @param end One past the last byte of the file
+     * @param dataParsers One parser per column
+     */
+    void parseMappedLines(const char* begin, const char* end, const QList<std::shared_ptr<AbstractDataParser>>& dataParsers);
+
+    /**
+     * @brief Parses the data lines one at a time from a text stream. Used for files that cannot be memory mapped.
+     * @param in Stream positioned at the first data line
+     * @param dataParsers One parser per column
+     */
+    void parseStreamLines(QTextStream& in, const QList<std::shared_ptr<AbstractDataParser>>& dataParsers);
+
   public:
     ReadASCIIData(const ReadASCIIData&) = delete;  // Copy Constructor Not Implemented
     ReadASCIIData(ReadASCIIData&&) = delete;       // Move Constructor Not Implemented
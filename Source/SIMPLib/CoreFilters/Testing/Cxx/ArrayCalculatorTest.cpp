@@ -53,6 +53,7 @@
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
 
+#include "SIMPLib/CoreFilters/util/CalculatorKernel.h"
 #include "SIMPLib/CoreFilters/util/CalculatorOperator.h"
 
 class DummyObserver : public Observer
@@ -919,6 +920,72 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void FusedExpressionArrayCalculatorTest()
+  {
+    // Use enough tuples that the expression is evaluated over several tiles, including a partial one
+    size_t numTuples = 3 * CalculatorKernel::TileSize + 17;
+    DataArrayPath arrayPath("DataContainer", "AttributeMatrix", "NewArray");
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    AttributeMatrix::Pointer am = AttributeMatrix::New(QVector<size_t>(1, numTuples), "AttributeMatrix", AttributeMatrix::Type::Cell);
+    Int16ArrayType::Pointer angles = Int16ArrayType::CreateArray(numTuples, "Angles");
+    FloatArrayType::Pointer vectors = FloatArrayType::CreateArray(QVector<size_t>(1, numTuples), QVector<size_t>(1, 3), "Vectors");
+    for(size_t t = 0; t < numTuples; t++)
+    {
+      angles->setValue(t, static_cast<int16_t>(t % 360));
+      vectors->setComponent(t, 0, static_cast<float>(t) * 0.5f);
+      vectors->setComponent(t, 1, 1.0f);
+      vectors->setComponent(t, 2, static_cast<float>(t % 7) - 3.0f);
+    }
+    am->addAttributeArray("Angles", angles);
+    am->addAttributeArray("Vectors", vectors);
+    dc->addAttributeMatrix("AttributeMatrix", am);
+    dca->addDataContainer(dc);
+
+    AbstractFilter::Pointer filter = createArrayCalculatorFilter(arrayPath);
+    filter->setDataContainerArray(dca);
+
+    bool propWasSet = filter->setProperty("InfixEquation", "sin(Angles) * Vectors[2] + sqrt(abs(Vectors[0] - 4)) / 2 - root(8, 3)");
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    propWasSet = filter->setProperty("Units", ArrayCalculator::Degrees);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), static_cast<int>(CalculatorItem::ErrorCode::SUCCESS));
+
+    DoubleArrayType::Pointer arrayPtr = filter->getDataContainerArray()->getPrereqIDataArrayFromPath<DoubleArrayType, AbstractFilter>(filter.get(), arrayPath);
+    DREAM3D_REQUIRE_VALID_POINTER(arrayPtr.get());
+    DREAM3D_REQUIRE_EQUAL(arrayPtr->getNumberOfTuples(), numTuples);
+    DREAM3D_REQUIRE_EQUAL(arrayPtr->getNumberOfComponents(), 1);
+    for(size_t t = 0; t < numTuples; t++)
+    {
+      double angle = CalculatorOperator::toRadians(angles->getValue(t));
+      double expected = sin(angle) * vectors->getComponent(t, 2) + sqrt(fabs(vectors->getComponent(t, 0) - 4.0)) / 2.0 - 2.0;
+      DREAM3D_REQUIRE(SIMPLibMath::closeEnough<double>(arrayPtr->getValue(t), expected, 0.0001) == true);
+    }
+
+    // The result is converted to the requested output type as it is written
+    filter = createArrayCalculatorFilter(arrayPath);
+    filter->setDataContainerArray(dca);
+    am->removeAttributeArray("NewArray");
+    std::dynamic_pointer_cast<ArrayCalculator>(filter)->setScalarType(SIMPL::ScalarTypes::Type::Int32);
+    propWasSet = filter->setProperty("InfixEquation", "Vectors * -2 + 1");
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), static_cast<int>(CalculatorItem::ErrorCode::SUCCESS));
+
+    Int32ArrayType::Pointer intArrayPtr = filter->getDataContainerArray()->getPrereqIDataArrayFromPath<Int32ArrayType, AbstractFilter>(filter.get(), arrayPath);
+    DREAM3D_REQUIRE_VALID_POINTER(intArrayPtr.get());
+    DREAM3D_REQUIRE_EQUAL(intArrayPtr->getNumberOfComponents(), 3);
+    for(size_t i = 0; i < vectors->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(intArrayPtr->getValue(i), static_cast<int32_t>(vectors->getValue(i) * -2.0 + 1.0));
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -928,6 +995,7 @@ public:
     int err = EXIT_SUCCESS;
     DREAM3D_REGISTER_TEST(SingleComponentArrayCalculatorTest())
     DREAM3D_REGISTER_TEST(MultiComponentArrayCalculatorTest())
+    DREAM3D_REGISTER_TEST(FusedExpressionArrayCalculatorTest())
   }
 
 private:
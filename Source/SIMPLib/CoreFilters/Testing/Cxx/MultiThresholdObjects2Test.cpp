@@ -334,6 +334,30 @@ public:
     compSet->setInvertComparison(true);
     ComparisonSetTest(filter, compSet, SIMPL::GeneralData::ThresholdArray + QString::number(3), expectedOutput);
 
+    // Nested, inverted ComparisonSet combined with a value from another array: (float > 0.155) OR !(int > 3)
+    ComparisonSet::Pointer outerSet = ComparisonSet::New();
+    ComparisonValue::Pointer comp3 = ComparisonValue::New();
+    comp3->setCompOperator(SIMPL::Comparison::Operator_GreaterThan);
+    comp3->setCompValue(0.155);
+    comp3->setAttributeArrayName("TestArrayFloat");
+    outerSet->addComparison(comp3);
+
+    ComparisonSet::Pointer innerSet = ComparisonSet::New();
+    innerSet->setUnionOperator(SIMPL::Union::Operator_Or);
+    innerSet->setInvertComparison(true);
+    ComparisonValue::Pointer comp4 = ComparisonValue::New();
+    comp4->setCompOperator(SIMPL::Comparison::Operator_GreaterThan);
+    comp4->setCompValue(3);
+    comp4->setAttributeArrayName(path.getDataArrayName());
+    innerSet->addComparison(comp4);
+    outerSet->addComparison(innerSet);
+
+    for(int i = 0; i < 20; i++)
+    {
+      expectedOutput[i] = (i >= 15 || i <= 3);
+    }
+    ComparisonSetTest(filter, outerSet, SIMPL::GeneralData::ThresholdArray + QString::number(4), expectedOutput);
+
     return 1;
   }
 
@@ -41,6 +41,7 @@
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
@@ -410,6 +411,111 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CreateMultiColumnFile(const QString& filePath, int numRows, int badColumnRow, int badValueRow)
+  {
+    QFile data(filePath);
+    if(data.open(QFile::WriteOnly))
+    {
+      QTextStream out(&data);
+      out << "Index,Ignored,Value,Name\r\n";
+      for(int row = 0; row < numRows; row++)
+      {
+        QString value = (row == badValueRow) ? QString("abc") : QString::number(row * 0.25, 'f', 2);
+        out << row << ",x," << value << ",Name_" << row;
+        if(row == badColumnRow)
+        {
+          out << ",Extra";
+        }
+        out << "\r\n";
+      }
+      data.close();
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestMultiChunkFile()
+  {
+    // Large enough to be split into several chunks that are parsed in parallel
+    const int numRows = 100000;
+
+    ASCIIWizardData data;
+    data.automaticAM = false;
+    data.beginIndex = 2;
+    data.consecutiveDelimiters = false;
+    data.dataHeaders << "Index"
+                     << "Ignored"
+                     << "Value"
+                     << "Name";
+    data.dataTypes << SIMPL::TypeNames::Int32 << "Skip" << SIMPL::TypeNames::Double << SIMPL::TypeNames::String;
+    data.delimiters.push_back(',');
+    data.inputFilePath = UnitTest::ReadASCIIDataTest::TestFile2;
+    data.numberOfLines = numRows + 1;
+    data.selectedPath = DataArrayPath(DataContainerName, AttributeMatrixName, "");
+    data.tupleDims = QVector<size_t>(1, numRows + 1);
+
+    {
+      CreateMultiColumnFile(UnitTest::ReadASCIIDataTest::TestFile2, numRows, -1, -1);
+
+      AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+      DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+      importASCIIData->execute();
+      int err = importASCIIData->getErrorCondition();
+      DREAM3D_REQUIRE_EQUAL(err, 0)
+
+      AttributeMatrix::Pointer am = importASCIIData->getDataContainerArray()->getAttributeMatrix(DataArrayPath(DataContainerName, AttributeMatrixName, ""));
+      Int32ArrayType::Pointer indices = std::dynamic_pointer_cast<Int32ArrayType>(am->getAttributeArray("Index"));
+      DoubleArrayType::Pointer values = std::dynamic_pointer_cast<DoubleArrayType>(am->getAttributeArray("Value"));
+      StringDataArray::Pointer names = std::dynamic_pointer_cast<StringDataArray>(am->getAttributeArray("Name"));
+      DREAM3D_REQUIRE_VALID_POINTER(indices.get())
+      DREAM3D_REQUIRE_VALID_POINTER(values.get())
+      DREAM3D_REQUIRE_VALID_POINTER(names.get())
+      DREAM3D_REQUIRE(am->getAttributeArray("Ignored").get() == nullptr)
+
+      for(int i = 0; i < numRows; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(indices->getValue(i), i)
+        DREAM3D_REQUIRE_EQUAL(values->getValue(i), i * 0.25)
+        DREAM3D_REQUIRE_EQUAL(names->getValue(i), QString("Name_%1").arg(i))
+      }
+    }
+
+    RemoveTestFiles();
+
+    // The error nearest the top of the file is the one reported
+    {
+      CreateMultiColumnFile(UnitTest::ReadASCIIDataTest::TestFile2, numRows, 70000, 90000);
+
+      AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+      DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+      importASCIIData->execute();
+      int err = importASCIIData->getErrorCondition();
+      DREAM3D_REQUIRE_EQUAL(err, ReadASCIIData::INCONSISTENT_COLS)
+    }
+
+    RemoveTestFiles();
+
+    // Fewer lines in the file than requested
+    {
+      CreateMultiColumnFile(UnitTest::ReadASCIIDataTest::TestFile2, numRows - 1, -1, -1);
+
+      AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+      DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+      importASCIIData->execute();
+      int err = importASCIIData->getErrorCondition();
+      DREAM3D_REQUIRE_EQUAL(err, ReadASCIIData::INCONSISTENT_COLS)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -442,6 +548,7 @@ public:
     DREAM3D_REGISTER_TEST(RemoveTestFiles()) // In case the previous test asserted or stopped prematurely
 
     DREAM3D_REGISTER_TEST(RunTest())
+    DREAM3D_REGISTER_TEST(TestMultiChunkFile())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
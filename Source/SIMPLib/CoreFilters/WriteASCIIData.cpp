@@ -35,18 +35,26 @@
 
 #include "WriteASCIIData.h"
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
 #include <QtCore/QDir>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
 #include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/MultiDataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputPathFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Utilities/BulkTextWriter.h"
 
 /**
  * @brief The ExportDataPrivate class is a templated class that implements a method to generically
@@ -71,50 +79,125 @@ public:
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
-  void static Execute(WriteASCIIData* filter, IDataArray::Pointer inputData, char delimiter, QString outputFile, int32_t MaxValPerLine)
+  void static Execute(QString* errorMessage, IDataArray::Pointer inputData, char delimiter, QString outputFile, int32_t MaxValPerLine)
   {
     typename DataArrayType::Pointer inputArray = std::dynamic_pointer_cast<DataArrayType>(inputData);
 
     QFile file(outputFile);
     if(!file.open(QIODevice::WriteOnly | QIODevice::Text))
     {
-      QString ss = QObject::tr("The output file could not be opened: '%1'").arg(outputFile);
-      filter->setErrorCondition(-11008);
-      filter->notifyErrorMessage(filter->getHumanLabel(), ss, filter->getErrorCondition());
+      *errorMessage = QObject::tr("The output file could not be opened: '%1'").arg(outputFile);
       return;
     }
 
-    QTextStream out(&file);
-
     int32_t nComp = inputArray->getNumberOfComponents();
 
-    TInputType* inputArrayPtr = inputArray->getPointer(0);
+    const TInputType* inputArrayPtr = inputArray->getPointer(0);
     size_t nTuples = inputArray->getNumberOfTuples();
+    size_t valPerLine = static_cast<size_t>(MaxValPerLine);
 
-    int32_t recCount = 0;
-    for(size_t i = 0; i < nTuples; i++)
-    {
-      for(int32_t j = 0; j < nComp; j++)
+    BulkTextWriter::FormatFunction format = [=](size_t start, size_t end, QByteArray& buffer) {
+      for(size_t i = start; i < end; i++)
       {
-        out << inputArrayPtr[i * nComp + j];
-        if(j < nComp - 1)
-        {
-          out << delimiter;
-        }
+        BulkTextWriter::AppendTuple(buffer, inputArrayPtr + i * nComp, nComp, delimiter);
+        buffer.append(((i + 1) % valPerLine == 0) ? '\n' : delimiter);
       }
-      recCount++;
+    };
+    if(!BulkTextWriter::WriteChunks(file, nTuples, format))
+    {
+      *errorMessage = QObject::tr("The output file could not be written: '%1'").arg(outputFile);
+    }
+  }
+};
 
-      if(recCount >= MaxValPerLine)
-      {
-        out << '\n';
-        recCount = 0;
-      }
-      else
-      {
-        out << delimiter;
-      }
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString WriteStringArray(IDataArray::Pointer inputData, QString outputFile, char delimiter, int32_t MaxValPerLine)
+{
+  StringDataArray::Pointer inputArray = std::dynamic_pointer_cast<StringDataArray>(inputData);
+
+  QFile file(outputFile);
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Text))
+  {
+    return QObject::tr("The output file could not be opened: '%1'").arg(outputFile);
+  }
+
+  StringDataArray* strings = inputArray.get();
+  size_t nTuples = inputArray->getNumberOfTuples();
+  size_t valPerLine = static_cast<size_t>(MaxValPerLine);
+
+  BulkTextWriter::FormatFunction format = [=](size_t start, size_t end, QByteArray& buffer) {
+    for(size_t i = start; i < end; i++)
+    {
+      BulkTextWriter::AppendValue(buffer, strings->getValue(i));
+      buffer.append(((i + 1) % valPerLine == 0) ? '\n' : delimiter);
+    }
+  };
+  if(!BulkTextWriter::WriteChunks(file, nTuples, format))
+  {
+    return QObject::tr("The output file could not be written: '%1'").arg(outputFile);
+  }
+  return QString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString WriteArray(AbstractFilter* filter, IDataArray::Pointer inputData, QString outputFile, char delimiter, int32_t MaxValPerLine)
+{
+  QString errorMessage;
+  if(std::dynamic_pointer_cast<StringDataArray>(inputData).get() != nullptr)
+  {
+    errorMessage = WriteStringArray(inputData, outputFile, delimiter, MaxValPerLine);
+  }
+  else
+  {
+    EXECUTE_TEMPLATE(filter, WriteASCIIDataPrivate, inputData, &errorMessage, inputData, delimiter, outputFile, MaxValPerLine)
+  }
+  return errorMessage;
+}
+} // namespace
+
+/**
+ * @brief The WriteASCIIArraysImpl class writes several arrays to their own files at the same time
+ */
+class WriteASCIIArraysImpl
+{
+  WriteASCIIData* m_Filter;
+  const QVector<IDataArray::Pointer>& m_Arrays;
+  const QVector<QString>& m_OutputFiles;
+  QString* m_ErrorMessages;
+  char m_Delimiter;
+
+public:
+  WriteASCIIArraysImpl(WriteASCIIData* filter, const QVector<IDataArray::Pointer>& arrays, const QVector<QString>& outputFiles, QString* errorMessages, char delimiter)
+  : m_Filter(filter)
+  , m_Arrays(arrays)
+  , m_OutputFiles(outputFiles)
+  , m_ErrorMessages(errorMessages)
+  , m_Delimiter(delimiter)
+  {
+  }
+
+  virtual ~WriteASCIIArraysImpl() = default;
+
+  void compute(int start, int end) const
+  {
+    for(int i = start; i < end; i++)
+    {
+      m_ErrorMessages[i] = WriteArray(m_Filter, m_Arrays[i], m_OutputFiles[i], m_Delimiter, m_Filter->getMaxValPerLine());
     }
   }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<int>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
 };
 
 // -----------------------------------------------------------------------------
@@ -126,6 +209,7 @@ WriteASCIIData::WriteASCIIData()
 , m_Delimiter(0)
 , m_FileExtension(".txt")
 , m_MaxValPerLine(-1)
+, m_ExportArraysConcurrently(false)
 {
 }
 
@@ -143,6 +227,7 @@ void WriteASCIIData::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_OUTPUT_PATH_FP("Output Path", OutputPath, FilterParameter::Parameter, WriteASCIIData));
   parameters.push_back(SIMPL_NEW_STRING_FP("File Extension", FileExtension, FilterParameter::Parameter, WriteASCIIData));
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Maximum Tuples Per Line", MaxValPerLine, FilterParameter::Parameter, WriteASCIIData));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Export Arrays Concurrently", ExportArraysConcurrently, FilterParameter::Parameter, WriteASCIIData));
   {
     ChoiceFilterParameter::Pointer parameter = ChoiceFilterParameter::New(); // Delimiter choice
     parameter->setHumanLabel("Delimiter");
@@ -178,6 +263,7 @@ void WriteASCIIData::readFilterParameters(AbstractFilterParametersReader* reader
   setDelimiter(reader->readValue("Delimiter", getDelimiter()));
   setFileExtension(reader->readString("FileExtension", getFileExtension()));
   setMaxValPerLine(reader->readValue("MaxValPerLine", getMaxValPerLine()));
+  setExportArraysConcurrently(reader->readValue("ExportArraysConcurrently", getExportArraysConcurrently()));
   reader->closeFilterGroup();
 }
 
@@ -317,87 +403,63 @@ void WriteASCIIData::execute()
     m_FileExtension = "." + m_FileExtension;
   }
 
+  char delimiter = lookupDelimiter();
+
+  // Unsupported array types were already rejected by dataCheck()
+  QVector<IDataArray::Pointer> arrays;
+  QVector<QString> outputFiles;
   for(int32_t i = 0; i < m_SelectedWeakPtrVector.count(); i++)
   {
     IDataArray::Pointer selectedArrayPtr = m_SelectedWeakPtrVector.at(i).lock();
+    arrays.push_back(selectedArrayPtr);
+    outputFiles.push_back(m_OutputPath + QDir::separator() + selectedArrayPtr->getName() + m_FileExtension); // the complete output file path, name and extension
+  }
+  QVector<QString> errorMessages(arrays.size());
 
-    QString message = QObject::tr("|| Exporting Dataset '%1'").arg(selectedArrayPtr->getName());
+  if(m_ExportArraysConcurrently && arrays.size() > 1)
+  {
+    QString message = QObject::tr("|| Exporting %1 Datasets").arg(arrays.size());
     notifyStatusMessage(getMessagePrefix(), getHumanLabel(), message);
 
-    QString exportArrayFile = m_OutputPath + QDir::separator() + selectedArrayPtr->getName() + m_FileExtension; // the complete output file path, name and extension
-
-    char delimiter = lookupDelimiter();
-
-
-    if( std::dynamic_pointer_cast<StringDataArray>(selectedArrayPtr).get() != nullptr)
+    WriteASCIIArraysImpl impl(this, arrays, outputFiles, errorMessages.data(), delimiter);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+    if(doParallel == true)
     {
-       writeStringArray(selectedArrayPtr, exportArrayFile, delimiter);
-    }
-    else if( selectedArrayPtr->getTypeAsString().compare("NeighborList<T>") == 0)
-    {
-      setErrorCondition(TemplateHelpers::Errors::UnsupportedType);
-      notifyErrorMessage(getHumanLabel(), "NeighborList is unsupported when writing ASCII Data.", getErrorCondition());
-    }
-    else if( selectedArrayPtr->getTypeAsString().compare("struct") == 0)
-    {
-      setErrorCondition(TemplateHelpers::Errors::UnsupportedType);
-      notifyErrorMessage(getHumanLabel(), "StructArray is unsupported when writing ASCII Data.", getErrorCondition());
-    }
-    else if( selectedArrayPtr->getTypeAsString().compare("StatsDataArray") == 0)
-    {
-      setErrorCondition(TemplateHelpers::Errors::UnsupportedType);
-      notifyErrorMessage(getHumanLabel(), "StatsDataArray is unsupported when writing ASCII Data.", getErrorCondition());
+      tbb::parallel_for(tbb::blocked_range<int>(0, arrays.size(), 1), impl, tbb::auto_partitioner());
     }
     else
-      EXECUTE_TEMPLATE(this, WriteASCIIDataPrivate, selectedArrayPtr, this, selectedArrayPtr, delimiter, exportArrayFile, m_MaxValPerLine)
-
-
-    if(getErrorCondition() < 0)
+#endif
     {
-      break;
+      impl.compute(0, arrays.size());
     }
   }
-
-  notifyStatusMessage(getHumanLabel(), "Complete");
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void WriteASCIIData::writeStringArray(IDataArray::Pointer inputData, QString outputFile, char delimiter)
-{
-  StringDataArray::Pointer inputArray = std::dynamic_pointer_cast<StringDataArray>(inputData);
-
-  QFile file(outputFile);
-  if(!file.open(QIODevice::WriteOnly | QIODevice::Text))
+  else
   {
-    QString ss = QObject::tr("The output file could not be opened: '%1'").arg(outputFile);
-    setErrorCondition(-11008);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
-
-  QTextStream out(&file);
+    for(int32_t i = 0; i < arrays.size(); i++)
+    {
+      QString message = QObject::tr("|| Exporting Dataset '%1'").arg(arrays[i]->getName());
+      notifyStatusMessage(getMessagePrefix(), getHumanLabel(), message);
 
-  size_t nTuples = inputArray->getNumberOfTuples();
+      errorMessages[i] = WriteArray(this, arrays[i], outputFiles[i], delimiter, m_MaxValPerLine);
+      if(!errorMessages[i].isEmpty())
+      {
+        break;
+      }
+    }
+  }
 
-  int32_t recCount = 0;
-  for(size_t i = 0; i < nTuples; i++)
+  for(const QString& errorMessage : errorMessages)
   {
-    out << inputArray->getValue(i);
-
-    recCount++;
-
-    if(recCount >= getMaxValPerLine())
+    if(!errorMessage.isEmpty())
     {
-      out << '\n';
-      recCount = 0;
-    }
-    else
-    {
-      out << delimiter;
+      setErrorCondition(-11008);
+      notifyErrorMessage(getHumanLabel(), errorMessage, getErrorCondition());
+      break;
     }
   }
+
+  notifyStatusMessage(getHumanLabel(), "Complete");
 }
 
 // -----------------------------------------------------------------------------
@@ -52,6 +52,7 @@ class SIMPLib_EXPORT WriteASCIIData : public AbstractFilter
     PYB11_PROPERTY(int Delimiter READ getDelimiter WRITE setDelimiter)
     PYB11_PROPERTY(QString FileExtension READ getFileExtension WRITE setFileExtension)
     PYB11_PROPERTY(int MaxValPerLine READ getMaxValPerLine WRITE setMaxValPerLine)
+    PYB11_PROPERTY(bool ExportArraysConcurrently READ getExportArraysConcurrently WRITE setExportArraysConcurrently)
 
   public:
     SIMPL_SHARED_POINTERS(WriteASCIIData)
@@ -75,6 +76,9 @@ class SIMPLib_EXPORT WriteASCIIData : public AbstractFilter
     SIMPL_FILTER_PARAMETER(int, MaxValPerLine)
     Q_PROPERTY(int MaxValPerLine READ getMaxValPerLine WRITE setMaxValPerLine)
 
+    SIMPL_FILTER_PARAMETER(bool, ExportArraysConcurrently)
+    Q_PROPERTY(bool ExportArraysConcurrently READ getExportArraysConcurrently WRITE setExportArraysConcurrently)
+
     enum DelimiterType
     {
       Comma = 0,
@@ -193,12 +197,6 @@ class SIMPLib_EXPORT WriteASCIIData : public AbstractFilter
      */
     char lookupDelimiter();
 
-    /**
-     * @brief Specific function to write string arrays to a text file
-     * @param inputData
-     */
-    void writeStringArray(IDataArray::Pointer inputData, QString outputFile, char delimiter);
-
     QVector<IDataArray::WeakPointer> m_SelectedWeakPtrVector;
 
   public:
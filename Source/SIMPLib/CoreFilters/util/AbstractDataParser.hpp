@@ -29,6 +29,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <utility>
+
 #include <QtCore/QString>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
@@ -66,6 +68,19 @@ public:
 
   virtual ParserFunctor::ErrorObject parse(const QString& token, size_t index) = 0;
 
+  /**
+   * @brief Parses a token given as a range of UTF-8 bytes and stores it at the given index.
+   * Different indices may be parsed from several threads at the same time.
+   * @param begin First byte of the token
+   * @param end One past the last byte of the token
+   * @param index Tuple index to store the value at
+   * @return
+   */
+  virtual ParserFunctor::ErrorObject parse(const char* begin, const char* end, size_t index)
+  {
+    return parse(QString::fromUtf8(begin, static_cast<int>(end - begin)), index);
+  }
+
 protected:
   AbstractDataParser() :
   m_ColumnIndex(0)
@@ -122,6 +137,20 @@ public:
     return obj;
   }
 
+  ParserFunctor::ErrorObject parse(const char* begin, const char* end, size_t index) override
+  {
+    using ValueType = decltype(F()(QString(), std::declval<ParserFunctor::ErrorObject&>()));
+    ValueType value = ValueType();
+    if(F::FastConvert(begin, end, value))
+    {
+      ParserFunctor::ErrorObject obj;
+      obj.ok = true;
+      (*m_Ptr).setValue(index, value);
+      return obj;
+    }
+    return parse(QString::fromUtf8(begin, static_cast<int>(end - begin)), index);
+  }
+
 protected:
   Parser(typename ArrayType::Pointer ptr, const QString& name, int index)
   {
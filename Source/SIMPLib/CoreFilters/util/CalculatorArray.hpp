@@ -50,27 +50,28 @@ class SIMPLib_EXPORT CalculatorArray : public ICalculatorArray
 
     static Pointer New(typename DataArray<T>::Pointer dataArray, ValueType type, bool allocate)
     {
-      return Pointer(new CalculatorArray(dataArray, type, allocate));
+      return Pointer(new CalculatorArray(dataArray, -1, type, allocate));
     }
 
     ~CalculatorArray() override = default;
 
-    IDataArray::Pointer getArray() override { return m_Array; }
+    IDataArray::Pointer getArray() override { return getDoubleArray(); }
 
     void setValue(int i, double val) override
     {
-      m_Array->setValue(i, val);
+      getDoubleArray()->setValue(i, val);
     }
 
     double getValue(int i) override
     {
-      if (m_Array->getNumberOfTuples() > 1)
+      DoubleArrayType::Pointer array = getDoubleArray();
+      if (array->getNumberOfTuples() > 1)
       {
-        return static_cast<double>(m_Array->getValue(i));
+        return array->getValue(i);
       }
-      else if (m_Array->getNumberOfTuples() == 1)
+      else if (array->getNumberOfTuples() == 1)
       {
-        return static_cast<double>(m_Array->getValue(0));
+        return array->getValue(0);
       }
       else
       {
@@ -86,16 +87,17 @@ class SIMPLib_EXPORT CalculatorArray : public ICalculatorArray
 
     DoubleArrayType::Pointer reduceToOneComponent(int c, bool allocate = true) override
     {
-      if(c >= 0 && c <= m_Array->getNumberOfComponents())
+      DoubleArrayType::Pointer array = getDoubleArray();
+      if(c >= 0 && c <= array->getNumberOfComponents())
       {
-        if(m_Array->getNumberOfComponents() > 1)
+        if(array->getNumberOfComponents() > 1)
         {
-          DoubleArrayType::Pointer newArray = DoubleArrayType::CreateArray(m_Array->getNumberOfTuples(), QVector<size_t>(1, 1), m_Array->getName(), allocate);
+          DoubleArrayType::Pointer newArray = DoubleArrayType::CreateArray(array->getNumberOfTuples(), QVector<size_t>(1, 1), array->getName(), allocate);
           if(allocate)
           {
-            for(int i = 0; i < m_Array->getNumberOfTuples(); i++)
+            for(int i = 0; i < array->getNumberOfTuples(); i++)
             {
-              newArray->setComponent(i, 0, m_Array->getComponent(i, c));
+              newArray->setComponent(i, 0, array->getComponent(i, c));
             }
           }
 
@@ -106,6 +108,51 @@ class SIMPLib_EXPORT CalculatorArray : public ICalculatorArray
       return DoubleArrayType::NullPointer();
     }
 
+    size_t getNumberOfTuples() override
+    {
+      return m_SourceArray->getNumberOfTuples();
+    }
+
+    QVector<size_t> getComponentDimensions() override
+    {
+      if(m_SourceComponent >= 0)
+      {
+        return QVector<size_t>(1, 1);
+      }
+      return m_SourceArray->getComponentDimensions();
+    }
+
+    int getNumberOfComponents() override
+    {
+      if(m_SourceComponent >= 0)
+      {
+        return 1;
+      }
+      return m_SourceArray->getNumberOfComponents();
+    }
+
+    IDataArray::Pointer getSourceArray() override
+    {
+      return m_SourceArray;
+    }
+
+    int getSourceComponent() override
+    {
+      return m_SourceComponent;
+    }
+
+    ICalculatorArray::Pointer selectComponent(int c) override
+    {
+      if(c < 0 || c >= getNumberOfComponents())
+      {
+        return ICalculatorArray::NullPointer();
+      }
+
+      // Selecting the only component of an already reduced array is a no-op
+      int sourceComponent = (m_SourceComponent >= 0) ? m_SourceComponent : c;
+      return Pointer(new CalculatorArray(m_SourceArray, sourceComponent, m_Type, m_Allocate));
+    }
+
     CalculatorItem::ErrorCode checkValidity(QVector<CalculatorItem::Pointer> infixVector, int currentIndex, QString& msg) override
     {
       Q_UNUSED(infixVector)
@@ -117,25 +164,58 @@ class SIMPLib_EXPORT CalculatorArray : public ICalculatorArray
   protected:
     CalculatorArray() = default;
 
-    CalculatorArray(typename DataArray<T>::Pointer dataArray, ValueType type, bool allocate) :
+    CalculatorArray(typename DataArray<T>::Pointer dataArray, int sourceComponent, ValueType type, bool allocate) :
       ICalculatorArray(),
-      m_Type(type)
+      m_SourceArray(dataArray),
+      m_SourceComponent(sourceComponent),
+      m_Type(type),
+      m_Allocate(allocate)
+    {
+    }
+
+    /**
+     * @brief Returns the values as a double precision array. The conversion is deferred until the values
+     * are first requested so that the compiled expression kernel can read the source array directly.
+     * @return
+     */
+    DoubleArrayType::Pointer getDoubleArray()
     {
-      m_Array = DoubleArrayType::CreateArray(dataArray->getNumberOfTuples(), dataArray->getComponentDimensions(), dataArray->getName(), allocate);
-      if (allocate == true)
+      if(nullptr != m_Array)
       {
-        for (int i = 0; i < dataArray->getSize(); i++)
+        return m_Array;
+      }
+
+      // Double arrays that are read in full can be used as they are
+      if(m_SourceComponent < 0)
+      {
+        m_Array = std::dynamic_pointer_cast<DoubleArrayType>(m_SourceArray);
+        if(nullptr != m_Array)
         {
-          m_Array->setValue(i, static_cast<double>(dataArray->getValue(i)));
+          return m_Array;
         }
       }
+
+      m_Array = DoubleArrayType::CreateArray(getNumberOfTuples(), getComponentDimensions(), m_SourceArray->getName(), m_Allocate);
+      if (m_Allocate == true)
+      {
+        size_t sourceComps = static_cast<size_t>(m_SourceArray->getNumberOfComponents());
+        size_t count = m_Array->getSize();
+        for (size_t i = 0; i < count; i++)
+        {
+          size_t sourceIndex = (m_SourceComponent < 0) ? i : i * sourceComps + static_cast<size_t>(m_SourceComponent);
+          m_Array->setValue(i, static_cast<double>(m_SourceArray->getValue(sourceIndex)));
+        }
+      }
+      return m_Array;
     }
 
   private:
+    typename DataArray<T>::Pointer                            m_SourceArray;
+    int                                                       m_SourceComponent = -1;
     DoubleArrayType::Pointer                                  m_Array;
     ValueType                                                 m_Type;
+    bool                                                      m_Allocate = true;
 
     CalculatorArray(const CalculatorArray&); // Copy Constructor Not Implemented
     void operator=(const CalculatorArray&);  // Move assignment Not Implemented
 };
-
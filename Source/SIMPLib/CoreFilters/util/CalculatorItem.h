@@ -79,7 +79,8 @@ class SIMPLib_EXPORT CalculatorItem
       TOO_MANY_ARGUMENTS = -4034,
       INVALID_SYMBOL = -4035,
       NO_PRECEDING_UNARY_OPERATOR = -4036,
-      InvalidOutputArrayType = -4037
+      InvalidOutputArrayType = -4037,
+      ARRAY_NOT_LOADED = -4038
     };
 
     enum class WarningCode : EnumType
@@ -0,0 +1,709 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "CalculatorKernel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+#include "ABSOperator.h"
+#include "ACosOperator.h"
+#include "ASinOperator.h"
+#include "ATanOperator.h"
+#include "AdditionOperator.h"
+#include "CeilOperator.h"
+#include "CosOperator.h"
+#include "DivisionOperator.h"
+#include "ExpOperator.h"
+#include "FloorOperator.h"
+#include "ICalculatorArray.h"
+#include "LnOperator.h"
+#include "Log10Operator.h"
+#include "LogOperator.h"
+#include "MultiplicationOperator.h"
+#include "NegativeOperator.h"
+#include "PowOperator.h"
+#include "RootOperator.h"
+#include "SinOperator.h"
+#include "SqrtOperator.h"
+#include "SubtractionOperator.h"
+#include "TanOperator.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void LoadTile(const void* data, size_t stride, size_t offset, size_t start, size_t count, double* out)
+{
+  const T* src = static_cast<const T*>(data);
+  if(stride == 1)
+  {
+    src = src + start + offset;
+    for(size_t i = 0; i < count; i++)
+    {
+      out[i] = static_cast<double>(src[i]);
+    }
+  }
+  else
+  {
+    src = src + start * stride + offset;
+    for(size_t i = 0; i < count; i++)
+    {
+      out[i] = static_cast<double>(src[i * stride]);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void StoreTile(const double* in, void* data, size_t start, size_t count)
+{
+  T* dst = static_cast<T*>(data) + start;
+  for(size_t i = 0; i < count; i++)
+  {
+    dst[i] = static_cast<T>(in[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> bool ResolveTypedFunctions(const IDataArray::Pointer& array, CalculatorKernel::LoadFunction& load, CalculatorKernel::StoreFunction& store)
+{
+  if(nullptr == std::dynamic_pointer_cast<DataArray<T>>(array))
+  {
+    return false;
+  }
+  load = &LoadTile<T>;
+  store = &StoreTile<T>;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ResolveFunctions(const IDataArray::Pointer& array, CalculatorKernel::LoadFunction& load, CalculatorKernel::StoreFunction& store)
+{
+  return ResolveTypedFunctions<float>(array, load, store) || ResolveTypedFunctions<double>(array, load, store) || ResolveTypedFunctions<int8_t>(array, load, store) ||
+         ResolveTypedFunctions<uint8_t>(array, load, store) || ResolveTypedFunctions<int16_t>(array, load, store) || ResolveTypedFunctions<uint16_t>(array, load, store) ||
+         ResolveTypedFunctions<int32_t>(array, load, store) || ResolveTypedFunctions<uint32_t>(array, load, store) || ResolveTypedFunctions<int64_t>(array, load, store) ||
+         ResolveTypedFunctions<uint64_t>(array, load, store) || ResolveTypedFunctions<bool>(array, load, store);
+}
+
+/**
+ * @brief The shape that an item on the execution stack would have if the expression was evaluated operator by operator
+ */
+struct StackShape
+{
+  size_t numTuples;
+  QVector<size_t> cDims;
+  bool isArray;
+};
+} // namespace
+
+/**
+ * @brief The EvaluateCalculatorKernelImpl class evaluates a range of tiles of a compiled expression
+ */
+class EvaluateCalculatorKernelImpl
+{
+public:
+  EvaluateCalculatorKernelImpl(const CalculatorKernel* kernel, CalculatorKernel::StoreFunction store, void* output, size_t numElements, AbstractFilter* filter)
+  : m_Kernel(kernel)
+  , m_Store(store)
+  , m_Output(output)
+  , m_NumElements(numElements)
+  , m_Filter(filter)
+  {
+  }
+
+  void evaluate(size_t firstTile, size_t lastTile) const
+  {
+    std::vector<double> stack(m_Kernel->getStackDepth() * CalculatorKernel::TileSize);
+    for(size_t tile = firstTile; tile < lastTile; tile++)
+    {
+      if(nullptr != m_Filter && m_Filter->getCancel())
+      {
+        return;
+      }
+
+      size_t start = tile * CalculatorKernel::TileSize;
+      size_t count = std::min(CalculatorKernel::TileSize, m_NumElements - start);
+      m_Kernel->evaluateTile(start, count, stack.data(), m_Store, m_Output);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    evaluate(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const CalculatorKernel* m_Kernel;
+  CalculatorKernel::StoreFunction m_Store;
+  void* m_Output;
+  size_t m_NumElements;
+  AbstractFilter* m_Filter;
+};
+
+const size_t CalculatorKernel::TileSize;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorKernel::CalculatorKernel() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorKernel::~CalculatorKernel() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorKernel::Pointer CalculatorKernel::Compile(const QVector<CalculatorItem::Pointer>& rpn, bool useDegrees)
+{
+  if(rpn.isEmpty())
+  {
+    return NullPointer();
+  }
+
+  Pointer kernel = Pointer(new CalculatorKernel());
+  kernel->m_UseDegrees = useDegrees;
+
+  QVector<StackShape> shapes;
+  for(const CalculatorItem::Pointer& item : rpn)
+  {
+    ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(item);
+    if(nullptr != calcArray)
+    {
+      Operand operand;
+      operand.array = calcArray->getSourceArray();
+      StoreFunction unusedStore = nullptr;
+      if(nullptr == operand.array || !ResolveFunctions(operand.array, operand.load, unusedStore))
+      {
+        return NullPointer();
+      }
+
+      int sourceComponent = calcArray->getSourceComponent();
+      if(sourceComponent >= 0)
+      {
+        operand.stride = static_cast<size_t>(operand.array->getNumberOfComponents());
+        operand.offset = static_cast<size_t>(sourceComponent);
+      }
+
+      StackShape shape = {calcArray->getNumberOfTuples(), calcArray->getComponentDimensions(), calcArray->getType() == ICalculatorArray::Array};
+      operand.broadcast = (shape.numTuples <= 1);
+
+      kernel->m_Program.push_back({OpCode::Load, static_cast<int>(kernel->m_Operands.size()), 0});
+      kernel->m_Operands.push_back(operand);
+      shapes.push_back(shape);
+      kernel->m_StackDepth = std::max(kernel->m_StackDepth, static_cast<size_t>(shapes.size()));
+      continue;
+    }
+
+    OpCode op;
+    int numArgs = 1;
+    if(nullptr != std::dynamic_pointer_cast<AdditionOperator>(item))
+    {
+      op = OpCode::Add;
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<SubtractionOperator>(item))
+    {
+      op = OpCode::Subtract;
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<MultiplicationOperator>(item))
+    {
+      op = OpCode::Multiply;
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<DivisionOperator>(item))
+    {
+      op = OpCode::Divide;
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<PowOperator>(item))
+    {
+      op = OpCode::Pow;
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<RootOperator>(item))
+    {
+      op = OpCode::Root;
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<LogOperator>(item))
+    {
+      op = OpCode::Log;
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<NegativeOperator>(item))
+    {
+      op = OpCode::Negate;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<ABSOperator>(item))
+    {
+      op = OpCode::Abs;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<SqrtOperator>(item))
+    {
+      op = OpCode::Sqrt;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<CeilOperator>(item))
+    {
+      op = OpCode::Ceil;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<FloorOperator>(item))
+    {
+      op = OpCode::Floor;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<ExpOperator>(item))
+    {
+      op = OpCode::Exp;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<LnOperator>(item))
+    {
+      op = OpCode::Ln;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<Log10Operator>(item))
+    {
+      op = OpCode::Log10;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<SinOperator>(item))
+    {
+      op = OpCode::Sin;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<CosOperator>(item))
+    {
+      op = OpCode::Cos;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<TanOperator>(item))
+    {
+      op = OpCode::Tan;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<ASinOperator>(item))
+    {
+      op = OpCode::ASin;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<ACosOperator>(item))
+    {
+      op = OpCode::ACos;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<ATanOperator>(item))
+    {
+      op = OpCode::ATan;
+    }
+    else
+    {
+      return NullPointer();
+    }
+
+    if(shapes.size() < numArgs)
+    {
+      return NullPointer();
+    }
+
+    if(numArgs == 2)
+    {
+      // The result takes the shape of the right hand argument if it is an array, otherwise the left one
+      StackShape shape1 = shapes.takeLast();
+      StackShape shape2 = shapes.takeLast();
+      StackShape result = shape1.isArray ? shape1 : shape2;
+      result.isArray = shape1.isArray || shape2.isArray;
+      shapes.push_back(result);
+    }
+
+    kernel->m_Program.push_back({op, -1, numArgs});
+  }
+
+  if(shapes.size() != 1)
+  {
+    return NullPointer();
+  }
+
+  kernel->m_NumTuples = shapes[0].numTuples;
+  kernel->m_ComponentDimensions = shapes[0].cDims;
+  kernel->m_ArrayResult = shapes[0].isArray;
+
+  // Every operand that is not broadcast must line up element for element with the result
+  size_t numElements = kernel->m_NumTuples;
+  for(const size_t& dim : kernel->m_ComponentDimensions)
+  {
+    numElements *= dim;
+  }
+  for(const Operand& operand : kernel->m_Operands)
+  {
+    if(operand.broadcast)
+    {
+      continue;
+    }
+    size_t numComps = (operand.stride > 1) ? 1 : static_cast<size_t>(operand.array->getNumberOfComponents());
+    if(operand.array->getNumberOfTuples() * numComps != numElements)
+    {
+      return NullPointer();
+    }
+  }
+
+  return kernel;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t CalculatorKernel::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<size_t> CalculatorKernel::getComponentDimensions() const
+{
+  return m_ComponentDimensions;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CalculatorKernel::isArrayResult() const
+{
+  return m_ArrayResult;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t CalculatorKernel::getStackDepth() const
+{
+  return m_StackDepth;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CalculatorKernel::canWriteTo(const IDataArray::Pointer& outputArray) const
+{
+  if(nullptr == outputArray || !outputArray->isAllocated())
+  {
+    return false;
+  }
+
+  LoadFunction load = nullptr;
+  StoreFunction store = nullptr;
+  if(!ResolveFunctions(outputArray, load, store))
+  {
+    return false;
+  }
+
+  return outputArray->getNumberOfTuples() == m_NumTuples && outputArray->getComponentDimensions() == m_ComponentDimensions;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CalculatorKernel::prepareOperands()
+{
+  for(Operand& operand : m_Operands)
+  {
+    size_t numTuples = operand.array->getNumberOfTuples();
+    operand.data = (numTuples > 0) ? operand.array->getConstVoidPointer(0) : nullptr;
+    if(numTuples > 0 && nullptr == operand.data)
+    {
+      return false;
+    }
+
+    if(operand.broadcast)
+    {
+      // An empty array reads as zero, a single tuple array always reads its first value
+      operand.constant = 0.0;
+      if(numTuples > 0)
+      {
+        operand.load(operand.data, operand.stride, operand.offset, 0, 1, &operand.constant);
+      }
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CalculatorKernel::execute(const IDataArray::Pointer& outputArray, AbstractFilter* filter)
+{
+  if(!canWriteTo(outputArray) || !prepareOperands())
+  {
+    return false;
+  }
+
+  LoadFunction load = nullptr;
+  StoreFunction store = nullptr;
+  ResolveFunctions(outputArray, load, store);
+
+  size_t numElements = outputArray->getNumberOfTuples() * static_cast<size_t>(outputArray->getNumberOfComponents());
+  if(numElements == 0)
+  {
+    return true;
+  }
+  void* output = outputArray->getVoidPointer(0);
+  size_t numTiles = (numElements + TileSize - 1) / TileSize;
+
+  EvaluateCalculatorKernelImpl impl(this, store, output, numElements, filter);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  bool doParallel = (numTiles > 1);
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numTiles), impl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    impl.evaluate(0, numTiles);
+  }
+
+  return (nullptr == filter || !filter->getCancel());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CalculatorKernel::evaluateTile(size_t start, size_t count, double* stack, StoreFunction store, void* output) const
+{
+  size_t sp = 0;
+  for(const Instruction& instruction : m_Program)
+  {
+    if(instruction.op == OpCode::Load)
+    {
+      const Operand& operand = m_Operands[instruction.operand];
+      double* dst = stack + sp * TileSize;
+      if(operand.broadcast)
+      {
+        std::fill(dst, dst + count, operand.constant);
+      }
+      else
+      {
+        operand.load(operand.data, operand.stride, operand.offset, start, count, dst);
+      }
+      sp++;
+      continue;
+    }
+
+    // Binary operators compute (left op right), where right is on top of the stack
+    double* right = stack + (sp - 1) * TileSize;
+    double* left = (sp >= 2) ? stack + (sp - 2) * TileSize : nullptr;
+    double* x = right;
+
+    switch(instruction.op)
+    {
+    case OpCode::Add:
+      for(size_t i = 0; i < count; i++)
+      {
+        left[i] = left[i] + right[i];
+      }
+      break;
+    case OpCode::Subtract:
+      for(size_t i = 0; i < count; i++)
+      {
+        left[i] = left[i] - right[i];
+      }
+      break;
+    case OpCode::Multiply:
+      for(size_t i = 0; i < count; i++)
+      {
+        left[i] = left[i] * right[i];
+      }
+      break;
+    case OpCode::Divide:
+      for(size_t i = 0; i < count; i++)
+      {
+        left[i] = left[i] / right[i];
+      }
+      break;
+    case OpCode::Pow:
+      for(size_t i = 0; i < count; i++)
+      {
+        left[i] = pow(left[i], right[i]);
+      }
+      break;
+    case OpCode::Root:
+      for(size_t i = 0; i < count; i++)
+      {
+        left[i] = (right[i] == 0) ? std::numeric_limits<double>::infinity() : pow(left[i], 1 / right[i]);
+      }
+      break;
+    case OpCode::Log:
+      for(size_t i = 0; i < count; i++)
+      {
+        left[i] = log(right[i]) / log(left[i]);
+      }
+      break;
+    case OpCode::Negate:
+      for(size_t i = 0; i < count; i++)
+      {
+        x[i] = -1 * x[i];
+      }
+      break;
+    case OpCode::Abs:
+      for(size_t i = 0; i < count; i++)
+      {
+        x[i] = fabs(x[i]);
+      }
+      break;
+    case OpCode::Sqrt:
+      for(size_t i = 0; i < count; i++)
+      {
+        x[i] = sqrt(x[i]);
+      }
+      break;
+    case OpCode::Ceil:
+      for(size_t i = 0; i < count; i++)
+      {
+        x[i] = ceil(x[i]);
+      }
+      break;
+    case OpCode::Floor:
+      for(size_t i = 0; i < count; i++)
+      {
+        x[i] = floor(x[i]);
+      }
+      break;
+    case OpCode::Exp:
+      for(size_t i = 0; i < count; i++)
+      {
+        x[i] = exp(x[i]);
+      }
+      break;
+    case OpCode::Ln:
+      for(size_t i = 0; i < count; i++)
+      {
+        x[i] = log(x[i]);
+      }
+      break;
+    case OpCode::Log10:
+      for(size_t i = 0; i < count; i++)
+      {
+        x[i] = log10(x[i]);
+      }
+      break;
+    case OpCode::Sin:
+    case OpCode::Cos:
+    case OpCode::Tan:
+      if(m_UseDegrees)
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          x[i] = CalculatorOperator::toRadians(x[i]);
+        }
+      }
+      if(instruction.op == OpCode::Sin)
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          x[i] = sin(x[i]);
+        }
+      }
+      else if(instruction.op == OpCode::Cos)
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          x[i] = cos(x[i]);
+        }
+      }
+      else
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          x[i] = tan(x[i]);
+        }
+      }
+      break;
+    case OpCode::ASin:
+    case OpCode::ACos:
+    case OpCode::ATan:
+      if(instruction.op == OpCode::ASin)
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          x[i] = asin(x[i]);
+        }
+      }
+      else if(instruction.op == OpCode::ACos)
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          x[i] = acos(x[i]);
+        }
+      }
+      else
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          x[i] = atan(x[i]);
+        }
+      }
+      if(m_UseDegrees)
+      {
+        for(size_t i = 0; i < count; i++)
+        {
+          x[i] = CalculatorOperator::toDegrees(x[i]);
+        }
+      }
+      break;
+    case OpCode::Load:
+      break;
+    }
+
+    // Binary operators leave their result in the left argument's slot
+    sp -= static_cast<size_t>(instruction.numArgs - 1);
+  }
+
+  store(stack, output, start, count);
+}
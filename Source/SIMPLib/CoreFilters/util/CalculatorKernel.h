@@ -0,0 +1,195 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QVector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "CalculatorItem.h"
+
+class AbstractFilter;
+
+/**
+ * @brief The CalculatorKernel class compiles the RPN form of an ArrayCalculator expression into a flat
+ * instruction list and evaluates it in fixed size tiles. Each tile is carried through the entire
+ * expression before the next tile is started, so no full size temporary arrays are created and the
+ * input arrays are read in their native type. Tiles are evaluated in parallel when TBB is available.
+ */
+class SIMPLib_EXPORT CalculatorKernel
+{
+  public:
+    SIMPL_SHARED_POINTERS(CalculatorKernel)
+
+    /**
+     * @brief Number of elements evaluated at once by each instruction
+     */
+    static const size_t TileSize = 1024;
+
+    using LoadFunction = void (*)(const void* data, size_t stride, size_t offset, size_t start, size_t count, double* out);
+    using StoreFunction = void (*)(const double* in, void* data, size_t start, size_t count);
+
+    /**
+     * @brief Compiles the RPN expression into a kernel.
+     * @param rpn The expression in RPN order, as produced by ArrayCalculator::toRPN
+     * @param useDegrees True if trigonometric operators work in degrees
+     * @return The kernel, or a NullPointer if the expression contains an item the kernel does not
+     * support. The caller should then fall back to evaluating the operators one by one.
+     */
+    static Pointer Compile(const QVector<CalculatorItem::Pointer>& rpn, bool useDegrees);
+
+    virtual ~CalculatorKernel();
+
+    /**
+     * @brief Returns the number of tuples of the result
+     * @return
+     */
+    size_t getNumberOfTuples() const;
+
+    /**
+     * @brief Returns the component dimensions of the result
+     * @return
+     */
+    QVector<size_t> getComponentDimensions() const;
+
+    /**
+     * @brief Returns true if the result is an array rather than a single number
+     * @return
+     */
+    bool isArrayResult() const;
+
+    /**
+     * @brief Returns true if outputArray has the shape of the result and a type the kernel can write
+     * @param outputArray
+     * @return
+     */
+    bool canWriteTo(const IDataArray::Pointer& outputArray) const;
+
+    /**
+     * @brief Evaluates the expression directly into outputArray, converting each value to the
+     * type of outputArray as it is stored.
+     * @param outputArray The allocated array that receives the result
+     * @param filter The filter that is checked for cancellation between tiles. May be nullptr.
+     * @return False if the output array could not be written or the filter was canceled
+     */
+    bool execute(const IDataArray::Pointer& outputArray, AbstractFilter* filter);
+
+    /**
+     * @brief Returns the number of tiles the instructions need on the evaluation stack
+     * @return
+     */
+    size_t getStackDepth() const;
+
+    /**
+     * @brief Evaluates the elements [start, start + count) and stores them into the output.
+     * @param start First element to evaluate
+     * @param count Number of elements to evaluate. Must not be larger than TileSize.
+     * @param stack Scratch space of getStackDepth() * TileSize values
+     * @param store Converts the values to the output type
+     * @param output Raw pointer of the output array
+     */
+    void evaluateTile(size_t start, size_t count, double* stack, StoreFunction store, void* output) const;
+
+  protected:
+    CalculatorKernel();
+
+  private:
+    enum class OpCode
+    {
+      Load,
+      Add,
+      Subtract,
+      Multiply,
+      Divide,
+      Pow,
+      Root,
+      Log,
+      Negate,
+      Abs,
+      Sqrt,
+      Ceil,
+      Floor,
+      Exp,
+      Ln,
+      Log10,
+      Sin,
+      Cos,
+      Tan,
+      ASin,
+      ACos,
+      ATan
+    };
+
+    struct Instruction
+    {
+      OpCode op;
+      int operand;
+      int numArgs;
+    };
+
+    struct Operand
+    {
+      IDataArray::Pointer array;
+      LoadFunction load = nullptr;
+      const void* data = nullptr;
+      size_t stride = 1;
+      size_t offset = 0;
+      bool broadcast = false;
+      double constant = 0.0;
+    };
+
+    std::vector<Instruction> m_Program;
+    std::vector<Operand> m_Operands;
+    size_t m_StackDepth = 0;
+    size_t m_NumTuples = 0;
+    QVector<size_t> m_ComponentDimensions;
+    bool m_ArrayResult = false;
+    bool m_UseDegrees = false;
+
+    /**
+     * @brief Resolves the raw pointers of the operands. Single tuple operands are read once and
+     * broadcast to every element.
+     * @return
+     */
+    bool prepareOperands();
+
+    CalculatorKernel(const CalculatorKernel&) = delete; // Copy Constructor Not Implemented
+    void operator=(const CalculatorKernel&) = delete;   // Move assignment Not Implemented
+};
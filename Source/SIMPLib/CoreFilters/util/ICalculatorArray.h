@@ -63,6 +63,43 @@ class SIMPLib_EXPORT ICalculatorArray : public CalculatorItem
 
     virtual DoubleArrayType::Pointer reduceToOneComponent(int c, bool allocate = true) = 0;
 
+    /**
+     * @brief Returns the number of tuples without converting the values to double precision
+     * @return
+     */
+    virtual size_t getNumberOfTuples() = 0;
+
+    /**
+     * @brief Returns the component dimensions without converting the values to double precision
+     * @return
+     */
+    virtual QVector<size_t> getComponentDimensions() = 0;
+
+    /**
+     * @brief Returns the total number of components per tuple
+     * @return
+     */
+    virtual int getNumberOfComponents() = 0;
+
+    /**
+     * @brief Returns the array that the values are read from, in its original type
+     * @return
+     */
+    virtual IDataArray::Pointer getSourceArray() = 0;
+
+    /**
+     * @brief Returns the component of the source array that this item reads, or -1 if it reads every component
+     * @return
+     */
+    virtual int getSourceComponent() = 0;
+
+    /**
+     * @brief Creates a new item that reads only component c of the source array. No values are copied.
+     * @param c
+     * @return
+     */
+    virtual ICalculatorArray::Pointer selectComponent(int c) = 0;
+
   protected:
     ICalculatorArray();
 
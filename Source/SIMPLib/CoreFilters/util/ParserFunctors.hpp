@@ -30,6 +30,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
 #include <QtCore/QByteArray>
 #include <QtCore/QString>
 
@@ -54,6 +58,178 @@ public:
     bool ok;
     QString errorMessage;
   };
+
+  /**
+   * @brief Converts a token straight from the bytes of the input without building a QString.
+   * Only plain decimal numbers are handled here. Anything else (white space, hex or octal
+   * prefixes, values out of range, too many digits) returns false so the caller can hand the
+   * token to the functor, which keeps the exact conversion rules and error messages.
+   * @param begin First byte of the token
+   * @param end One past the last byte of the token
+   * @param value Converted value
+   * @return True if the token was converted
+   */
+  template <typename T> static typename std::enable_if<std::is_integral<T>::value, bool>::type FastConvert(const char* begin, const char* end, T& value)
+  {
+    const char* ptr = begin;
+    bool negative = false;
+    if(ptr != end && (*ptr == '+' || *ptr == '-'))
+    {
+      negative = (*ptr == '-');
+      ++ptr;
+    }
+    // 18 digits always fit in an int64_t, longer values are left to the functor
+    size_t numDigits = static_cast<size_t>(end - ptr);
+    if(numDigits == 0 || numDigits > 18 || (negative && std::is_unsigned<T>::value))
+    {
+      return false;
+    }
+    // Some functors convert with base 0, which reads a leading zero as octal
+    if(*ptr == '0' && numDigits > 1)
+    {
+      return false;
+    }
+    int64_t result = 0;
+    for(; ptr != end; ++ptr)
+    {
+      uint32_t digit = static_cast<uint32_t>(static_cast<unsigned char>(*ptr)) - '0';
+      if(digit > 9)
+      {
+        return false;
+      }
+      result = result * 10 + digit;
+    }
+    if(negative)
+    {
+      result = -result;
+    }
+    if(result < static_cast<int64_t>(std::numeric_limits<T>::min()) || (result > 0 && static_cast<uint64_t>(result) > static_cast<uint64_t>(std::numeric_limits<T>::max())))
+    {
+      return false;
+    }
+    value = static_cast<T>(result);
+    return true;
+  }
+
+  static bool FastConvert(const char* begin, const char* end, double& value)
+  {
+    // Exactly representable powers of ten. A mantissa of at most 53 bits scaled by one of
+    // these is correctly rounded, so the result matches QString::toDouble() bit for bit.
+    static const double k_Pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                     1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    const char* ptr = begin;
+    bool negative = false;
+    if(ptr != end && (*ptr == '+' || *ptr == '-'))
+    {
+      negative = (*ptr == '-');
+      ++ptr;
+    }
+
+    uint64_t mantissa = 0;
+    int numDigits = 0;
+    int exponent = 0;
+    bool intDigits = false;
+    for(; ptr != end && *ptr >= '0' && *ptr <= '9'; ++ptr)
+    {
+      intDigits = true;
+      if(mantissa == 0 && *ptr == '0')
+      {
+        continue;
+      }
+      if(++numDigits > 19)
+      {
+        return false;
+      }
+      mantissa = mantissa * 10 + static_cast<uint64_t>(*ptr - '0');
+    }
+    if(!intDigits)
+    {
+      return false;
+    }
+    if(ptr != end && *ptr == '.')
+    {
+      ++ptr;
+      bool fracDigits = false;
+      for(; ptr != end && *ptr >= '0' && *ptr <= '9'; ++ptr)
+      {
+        fracDigits = true;
+        exponent--;
+        if(mantissa == 0 && *ptr == '0')
+        {
+          continue;
+        }
+        if(++numDigits > 19)
+        {
+          return false;
+        }
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*ptr - '0');
+      }
+      if(!fracDigits)
+      {
+        return false;
+      }
+    }
+    if(ptr != end && (*ptr == 'e' || *ptr == 'E'))
+    {
+      ++ptr;
+      bool negativeExp = false;
+      if(ptr != end && (*ptr == '+' || *ptr == '-'))
+      {
+        negativeExp = (*ptr == '-');
+        ++ptr;
+      }
+      int expValue = 0;
+      int expDigits = 0;
+      for(; ptr != end && *ptr >= '0' && *ptr <= '9'; ++ptr)
+      {
+        if(++expDigits > 4)
+        {
+          return false;
+        }
+        expValue = expValue * 10 + (*ptr - '0');
+      }
+      if(expDigits == 0)
+      {
+        return false;
+      }
+      exponent += negativeExp ? -expValue : expValue;
+    }
+    if(ptr != end)
+    {
+      return false;
+    }
+
+    double result = 0.0;
+    if(mantissa != 0)
+    {
+      if(mantissa > (uint64_t(1) << 53) || exponent < -22 || exponent > 22)
+      {
+        return false;
+      }
+      result = static_cast<double>(mantissa);
+      result = (exponent < 0) ? result / k_Pow10[-exponent] : result * k_Pow10[exponent];
+    }
+    value = negative ? -result : result;
+    return true;
+  }
+
+  static bool FastConvert(const char* begin, const char* end, float& value)
+  {
+    // QString::toFloat() also rounds through a double
+    double dValue = 0.0;
+    if(!FastConvert(begin, end, dValue))
+    {
+      return false;
+    }
+    value = static_cast<float>(dValue);
+    return true;
+  }
+
+  static bool FastConvert(const char* begin, const char* end, QString& value)
+  {
+    return false;
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -36,14 +36,22 @@
 #pragma once
 
 // STL Includes
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <cstring>
+#include <functional>
+#include <limits>
+#include <numeric>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataArrays/DataArrayStorage.h"
 #include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5LazyDataSource.h"
 
 
 #define mxa_bswap(s,d,t)\
@@ -398,6 +406,8 @@ class DataArray : public IDataArray
       p->m_Array = data; // Now set the internal array to the raw pointer
       p->m_OwnsData = ownsData; // Set who owns the data, i.e., who is going to "free" the memory
       if (nullptr != data) { p->m_IsAllocated = true; }
+      // The caller still holds the raw pointer
+      p->markWritablePointer();
 
       return p;
     }
@@ -428,12 +438,14 @@ class DataArray : public IDataArray
      */
     bool copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override
     {
+      loadIfPending();
+      if(!detachIfShared()) { return false; }
       if(!m_IsAllocated) { return false; }
       if(nullptr == m_Array) { return false; }
       if(destTupleOffset > m_MaxId) { return false; }
       if(!sourceArray->isAllocated()) { return false; }
       Self* source = dynamic_cast<Self*>(sourceArray.get());
-      if(nullptr == source->getPointer(0)) { return false; }
+      if(nullptr == source || nullptr == source->getConstPointer(0)) { return false; }
 
       if(sourceArray->getNumberOfComponents() != getNumberOfComponents()) { return false; }
 
@@ -449,7 +461,7 @@ class DataArray : public IDataArray
 
       size_t elementStart = destTupleOffset*getNumberOfComponents();
       size_t totalBytes = (totalSrcTuples * sourceArray->getNumberOfComponents()) * sizeof(T);
-      std::memcpy(m_Array + elementStart, source->getPointer(srcTupleOffset * sourceArray->getNumberOfComponents()), totalBytes);
+      std::memcpy(m_Array + elementStart, source->getConstPointer(srcTupleOffset * sourceArray->getNumberOfComponents()), totalBytes);
       return true;
     }
 
@@ -459,6 +471,7 @@ class DataArray : public IDataArray
      */
     bool copyIntoArray(Pointer dest)
     {
+      loadIfPending();
       if(m_IsAllocated == true && dest->isAllocated() && m_Array && dest->getPointer(0))
       {
         size_t totalBytes = m_Size * sizeof(T);
@@ -526,6 +539,79 @@ class DataArray : public IDataArray
      */
     bool isAllocated() override { return m_IsAllocated; }
 
+    /**
+     * @brief Attaches the HDF5 dataset that holds the values of this array. Any memory
+     * currently held by the array is released and the values are read from the file by
+     * loadData() or the first pointer or bulk access. The array must already have the tuple
+     * and component dimensions of the dataset.
+     * @param source
+     * @return false if the source is invalid
+     */
+    bool setLazyDataSource(const H5LazyDataSource::Pointer& source) override
+    {
+      if(nullptr == source.get())
+      {
+        return false;
+      }
+      if ((nullptr != m_Array) && (true == m_OwnsData))
+      {
+        _deallocate();
+      }
+      m_Array = nullptr;
+      m_OwnsData = true;
+      m_LazySource = source;
+      m_IsAllocated = true;
+      m_LazyLoadFailed = false;
+      m_LazyLoadPending = (m_Size > 0);
+      return true;
+    }
+
+    /**
+     * @brief Reads the values from the lazy data source if that has not happened yet.
+     * Every accessor does this on its own; calling it up front moves the read out of the
+     * first access and reports whether it worked.
+     * @return false if the values could not be read. The array is empty afterwards.
+     */
+    bool loadData() override
+    {
+      loadIfPending();
+      return !m_LazyLoadFailed;
+    }
+
+    /**
+     * @brief isDataLoaded
+     * @return false while the values are still only available in the file
+     */
+    bool isDataLoaded() override
+    {
+      return !m_LazyLoadPending;
+    }
+
+    /**
+     * @brief Releases the memory of an array that was loaded from a lazy data source. The
+     * values are read from the file again the next time they are accessed, so any changes
+     * made to the values in memory are discarded.
+     * @return false if the array has no lazy data source
+     */
+    bool evictData() override
+    {
+      if(nullptr == m_LazySource.get() || m_Size == 0)
+      {
+        return false;
+      }
+      std::lock_guard<std::mutex> lock(m_LazySource->getMutex());
+      if ((nullptr != m_Array) && (true == m_OwnsData))
+      {
+        _deallocate();
+      }
+      m_Array = nullptr;
+      m_OwnsData = true;
+      m_IsAllocated = true;
+      m_LazyLoadFailed = false;
+      m_LazyLoadPending.store(true, std::memory_order_release);
+      return true;
+    }
+
     /**
      * @brief Gives this array a human readable name
      * @param name The name of this array
@@ -568,15 +654,64 @@ class DataArray : public IDataArray
      */
     void releaseOwnership() override
     {
+      loadIfPending();
+      if(!detachIfShared()) { return; }
+      // Memory inside a scratch file can not be handed over to the caller
+      if(nullptr != m_MappedBuffer.get())
+      {
+        moveStorage(false);
+      }
       m_OwnsData = false;
     }
 
+    /**
+     * @brief Selects where the values of this array are kept. If the array is already
+     * allocated its values are moved to the new storage right away.
+     * @param type
+     * @return false if the values could not be moved
+     */
+    bool setStorageType(DataArrayStorage::Type type)
+    {
+      m_StorageType = type;
+      if(m_LazyLoadPending || nullptr == m_Array || !m_OwnsData)
+      {
+        return true;
+      }
+      bool useMappedFile = DataArrayStorage::UseMappedFile(m_StorageType, m_Size * sizeof(T));
+      if(useMappedFile == (nullptr != m_MappedBuffer.get()))
+      {
+        return true;
+      }
+      return moveStorage(useMappedFile);
+    }
+
+    /**
+     * @brief getStorageType
+     * @return
+     */
+    DataArrayStorage::Type getStorageType() const
+    {
+      return m_StorageType;
+    }
+
+    /**
+     * @brief isStoredInMappedFile
+     * @return true if the values currently live in a memory mapped scratch file
+     */
+    bool isStoredInMappedFile() const
+    {
+      return nullptr != m_MappedBuffer.get();
+    }
+
     /**
      * @brief Allocates the memory needed for this class
      * @return 1 on success, -1 on failure
      */
     virtual int32_t allocate()
     {
+      m_LazySource.reset();
+      m_LazyLoadPending = false;
+      m_LazyLoadFailed = false;
       if ((nullptr != m_Array) && (true == m_OwnsData))
       {
         _deallocate();
@@ -592,11 +727,7 @@ class DataArray : public IDataArray
 
 
       size_t newSize = m_Size;
-#if defined ( AIM_USE_SSE ) && defined ( __SSE2__ )
-      m_Array = static_cast<T*>( _mm_malloc (newSize * sizeof(T), 16) );
-#else
-      m_Array = (T*)malloc(newSize * sizeof(T));
-#endif
+      m_Array = allocateStorage(newSize, DataArrayStorage::UseMappedFile(m_StorageType, newSize * sizeof(T)), m_MappedBuffer);
       if (!m_Array)
       {
         qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
@@ -614,6 +745,9 @@ class DataArray : public IDataArray
      */
     virtual void clear()
     {
+      m_LazySource.reset();
+      m_LazyLoadPending = false;
+      m_LazyLoadFailed = false;
       if (nullptr != m_Array && true == m_OwnsData)
       {
         _deallocate();
@@ -634,6 +768,8 @@ class DataArray : public IDataArray
      */
     void initializeWithZeros() override
     {
+      loadIfPending();
+      if(!detachIfShared()) { return; }
       if(!m_IsAllocated || nullptr == m_Array) { return; }
       size_t typeSize = sizeof(T);
       ::memset(m_Array, 0, m_Size * typeSize);
@@ -644,6 +780,8 @@ class DataArray : public IDataArray
      */
     virtual void initializeWithValue(T initValue, size_t offset = 0)
     {
+      loadIfPending();
+      if(!detachIfShared()) { return; }
       if(!m_IsAllocated || nullptr == m_Array) { return; }
       for (size_t i = offset; i < m_Size; i++)
       {
@@ -661,7 +799,6 @@ class DataArray : public IDataArray
      */
     int eraseTuples(QVector<size_t>& idxs) override
     {
-
       int err = 0;
 
       // If nothing is to be erased just return
@@ -672,9 +809,12 @@ class DataArray : public IDataArray
       size_t idxs_size = static_cast<size_t>(idxs.size());
       if (idxs_size >= getNumberOfTuples() )
       {
+        // Everything goes away so there is no need to read a pending lazy source first
         resize(0);
         return 0;
       }
+      loadIfPending();
+      m_LazySource.reset();
 
       // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
       // off the end of the array and return an error code.
@@ -687,7 +827,12 @@ class DataArray : public IDataArray
       size_t newSize = (getNumberOfTuples() - idxs.size()) * m_NumComponents ;
 
       // Create a new m_Array to copy into
-      T* newArray = (T*)malloc(newSize * sizeof(T));
+      MappedFileBuffer::Pointer newBuffer;
+      T* newArray = allocateStorage(newSize, DataArrayStorage::UseMappedFile(m_StorageType, newSize * sizeof(T)), newBuffer);
+      if(nullptr == newArray)
+      {
+        return -101;
+      }
       // Splat AB across the array so we know if we are copying the values or not
       ::memset(newArray, 0xAB, newSize * sizeof(T));
 
@@ -716,6 +861,7 @@ class DataArray : public IDataArray
         _deallocate(); // We are done copying - delete the current m_Array
         m_Size = newSize;
         m_Array = newArray;
+        m_MappedBuffer = newBuffer;
         m_OwnsData = true;
         m_MaxId = newSize - 1;
         m_IsAllocated = true;
@@ -759,6 +905,7 @@ class DataArray : public IDataArray
       // Allocation was successful.  Save it.
       m_Size = newSize;
       m_Array = newArray;
+      m_MappedBuffer = newBuffer;
       // This object has now allocated its memory and owns it.
       m_OwnsData = true;
       m_IsAllocated = true;
@@ -767,6 +914,64 @@ class DataArray : public IDataArray
       return err;
     }
 
+    /**
+     * @brief Removes the tuples flagged false in the keep map. Runs of kept tuples are slid down
+     * inside the current storage and the array is shrunk afterwards, so no second buffer is needed.
+     * Memory that this array does not own or shares with a copy is left untouched and handled by eraseTuples().
+     * @param keepMap One flag per tuple
+     * @return error code.
+     */
+    int compactTuples(const QVector<bool>& keepMap) override
+    {
+      loadIfPending();
+      size_t numTuples = getNumberOfTuples();
+      if(static_cast<size_t>(keepMap.size()) != numTuples)
+      {
+        return -100;
+      }
+      if(!m_OwnsData || m_IsShared)
+      {
+        QVector<size_t> idxs;
+        for(size_t i = 0; i < numTuples; i++)
+        {
+          if(!keepMap[i])
+          {
+            idxs.push_back(i);
+          }
+        }
+        return eraseTuples(idxs);
+      }
+
+      size_t dest = 0;
+      size_t src = 0;
+      while(src < numTuples)
+      {
+        if(!keepMap[src])
+        {
+          ++src;
+          continue;
+        }
+        size_t runStart = src;
+        while(src < numTuples && keepMap[src])
+        {
+          ++src;
+        }
+        size_t runLength = src - runStart;
+        if(dest != runStart)
+        {
+          std::memmove(m_Array + dest * m_NumComponents, m_Array + runStart * m_NumComponents, runLength * m_NumComponents * sizeof(T));
+        }
+        dest += runLength;
+      }
+      if(dest == numTuples)
+      {
+        return 0;
+      }
+      m_LazySource.reset();
+      resize(dest);
+      return 0;
+    }
+
     /**
      * @brief
      * @param currentPos
@@ -775,6 +980,8 @@ class DataArray : public IDataArray
      */
     int copyTuple(size_t currentPos, size_t newPos) override
     {
+      loadIfPending();
+      if(!detachIfShared()) { return -1; }
       size_t max =  ((m_MaxId + 1) / m_NumComponents);
       if (currentPos >= max
           || newPos >= max )
@@ -845,11 +1052,28 @@ class DataArray : public IDataArray
      */
     void* getVoidPointer(size_t i) override
     {
+      loadIfPending();
+      if(!detachIfShared()) { return nullptr; }
       if (i >= m_Size) { return nullptr;}
+      markWritablePointer();
 
       return (void*)(&(m_Array[i]));
     }
 
+    /**
+     * @brief Returns a read-only void pointer to the index of the array. Unlike getVoidPointer()
+     * this does not give the array a private copy of values it shares with a deepCopy().
+     * @param i The index to have the returned pointer pointing to.
+     * @return Void Pointer. Possibly nullptr.
+     */
+    const void* getConstVoidPointer(size_t i) override
+    {
+      loadIfPending();
+      if (i >= m_Size) { return nullptr;}
+
+      return m_Array + i;
+    }
+
 
     /**
      * @brief Returns the pointer to a specific index into the array. No checks are made
@@ -860,12 +1084,52 @@ class DataArray : public IDataArray
      */
     virtual T* getPointer(size_t i)
     {
+      loadIfPending();
+      if(!detachIfShared()) { return nullptr; }
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i < m_Size);}
 #endif
+      markWritablePointer();
       return (T*)(&(m_Array[i]));
     }
 
+    /**
+     * @brief Returns a read-only pointer to a specific index into the array. Unlike getPointer()
+     * this does not give the array a private copy of values it shares with a deepCopy(), so it is
+     * the cheaper choice for code that only reads.
+     * @param i The index to return the pointer to.
+     * @return The pointer to the index
+     */
+    const T* getConstPointer(size_t i)
+    {
+      loadIfPending();
+#ifndef NDEBUG
+      if (m_Size > 0) { Q_ASSERT(i < m_Size);}
+#endif
+      return m_Array + i;
+    }
+
+    /**
+     * @brief detach Gives this array its own copy of the values if they are shared with a copy made
+     * by deepCopy(). Every method that changes values does this on its own; calling it up front
+     * only moves the copy out of the first write.
+     * @return false if the private copy could not be allocated; the values are still shared then
+     */
+    bool detach()
+    {
+      loadIfPending();
+      return detachIfShared();
+    }
+
+    /**
+     * @brief isStorageShared
+     * @return true while the values are shared with a copy made by deepCopy()
+     */
+    bool isStorageShared() const
+    {
+      return m_IsShared.load(std::memory_order_acquire);
+    }
+
     /**
      * @brief Returns the value for a given index
      * @param i The index to return the value at
@@ -873,6 +1137,8 @@ class DataArray : public IDataArray
      */
     virtual T getValue(size_t i)
     {
+      loadIfPending();
+      if(nullptr == m_Array) { return static_cast<T>(0); }
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i < m_Size);}
 #endif
@@ -886,10 +1152,13 @@ class DataArray : public IDataArray
      */
     void setValue(size_t i, T value)
     {
+      loadIfPending();
+      if(nullptr == m_Array) { return; }
 #ifndef NDEBUG
       if (m_Size > 0)
       { Q_ASSERT(i < m_Size);}
 #endif
+      if(!detachIfShared()) { return; }
       m_Array[i] = value;
     }
 
@@ -897,6 +1166,8 @@ class DataArray : public IDataArray
     // These can be overridden for more efficiency
     T getComponent(size_t i, int j)
     {
+      loadIfPending();
+      if(nullptr == m_Array) { return static_cast<T>(0); }
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i * m_NumComponents + j < m_Size);}
 #endif
@@ -911,9 +1182,12 @@ class DataArray : public IDataArray
      */
     void setComponent(size_t i, int j, T c)
     {
+      loadIfPending();
+      if(nullptr == m_Array) { return; }
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i * m_NumComponents + j < m_Size);}
 #endif
+      if(!detachIfShared()) { return; }
       m_Array[i * m_NumComponents + j] = c;
     }
 
@@ -950,6 +1224,8 @@ class DataArray : public IDataArray
      */
     void initializeTuple(size_t i, void* p) override
     {
+      loadIfPending();
+      if(!detachIfShared()) { return; }
       if(!m_IsAllocated) { return; }
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i * m_NumComponents < m_Size);}
@@ -968,9 +1244,12 @@ class DataArray : public IDataArray
      */
     T* getTuplePointer(size_t tupleIndex)
     {
+      loadIfPending();
+      if(!detachIfShared()) { return nullptr; }
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(tupleIndex * m_NumComponents < m_Size);}
 #endif
+      markWritablePointer();
       return m_Array + (tupleIndex * m_NumComponents);
     }
 
@@ -994,6 +1273,7 @@ class DataArray : public IDataArray
      */
     void printTuple(QTextStream& out, size_t i, char delimiter = ',') override
     {
+      loadIfPending();
       int precision = out.realNumberPrecision();
       T value = static_cast<T>(0x00);
       if (typeid(value) == typeid(float)) { out.setRealNumberPrecision(8); }
@@ -1015,6 +1295,7 @@ class DataArray : public IDataArray
      */
     void printComponent(QTextStream& out, size_t i, int j) override
     {
+      loadIfPending();
       out << m_Array[i * m_NumComponents + j];
     }
 
@@ -1100,16 +1381,33 @@ class DataArray : public IDataArray
     }
 
     /**
-     * @brief deepCopy
+     * @brief deepCopy Creates an independent copy of this array. Unless copy-on-write is turned off
+     * in DataArrayStorage, the copy shares the values of this array until either of them is written
+     * to, at which point that array makes its own copy. The values are copied right away if this
+     * array handed out a writable pointer that may still be in use, see
+     * DataArrayStorage::ReleaseWritablePointers().
      * @param forceNoAllocate
      * @return
      */
     IDataArray::Pointer deepCopy(bool forceNoAllocate = false) override
     {
-      IDataArray::Pointer daCopy = createNewArray(getNumberOfTuples(), getComponentDimensions(), getName(), m_IsAllocated);
+      Pointer daCopy = CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), false);
+      if(nullptr == daCopy.get())
+      {
+        return daCopy;
+      }
+      daCopy->setStorageType(m_StorageType);
+      if(m_IsAllocated == true && forceNoAllocate == false && shareStorage(*daCopy))
+      {
+        return daCopy;
+      }
+      if(m_IsAllocated && daCopy->allocate() < 0)
+      {
+        return IDataArray::NullPointer();
+      }
       if(m_IsAllocated == true && forceNoAllocate == false)
       {
-        T* src = getPointer(0);
+        const T* src = getConstPointer(0);
         void* dest = daCopy->getVoidPointer(0);
         size_t totalBytes = (getNumberOfTuples() * getNumberOfComponents() * sizeof(T));
         std::memcpy(dest, src, totalBytes);
@@ -1126,12 +1424,26 @@ class DataArray : public IDataArray
      */
     int writeH5Data(hid_t parentId, QVector<size_t> tDims) override
     {
+      return writeH5Data(parentId, tDims, H5DatasetCreationPolicy());
+    }
+
+    /**
+     * @brief writeH5Data Writes the array using the chunking/compression settings
+     * that the policy has for this array
+     * @param parentId
+     * @param tDims
+     * @param policy
+     * @return
+     */
+    int writeH5Data(hid_t parentId, QVector<size_t> tDims, const H5DatasetCreationPolicy& policy) override
+    {
+      loadIfPending();
       if (m_Array == nullptr)
       { return -85648; }
 #if 0
       return H5DataArrayWriter<T>::writeArray(parentId, getName(), getNumberOfTuples(), getNumberOfComponents(), getRank(), getDims(), getClassVersion(), m_Array, getFullNameOfClass());
 #else
-      return H5DataArrayWriter::writeDataArray<Self>(parentId, this, tDims);
+      return H5DataArrayWriter::writeDataArray<Self>(parentId, this, tDims, policy);
 #endif
     }
 
@@ -1144,7 +1456,7 @@ class DataArray : public IDataArray
     int writeXdmfAttribute(QTextStream& out, int64_t* volDims, const QString& hdfFileName,
                                    const QString& groupPath, const QString& label) override
     {
-      if (m_Array == nullptr) { return -85648; }
+      if (m_Array == nullptr && !m_LazyLoadPending) { return -85648; }
       QString dimStr;
       int precision = 0;
       QString xdmfTypeName;
@@ -1257,6 +1569,19 @@ class DataArray : public IDataArray
       {
         return -1;
       }
+      // Tell the intermediate DataArray to release ownership of the data as we are going to be responsible
+      // for deleting the memory. A scratch file is taken over as is instead of being copied to the heap.
+      Self* source = dynamic_cast<Self*>(p.get());
+      if(nullptr != source && nullptr != source->m_MappedBuffer.get())
+      {
+        m_MappedBuffer = source->m_MappedBuffer;
+        source->m_MappedBuffer.reset();
+        source->m_OwnsData = false;
+      }
+      else
+      {
+        p->releaseOwnership();
+      }
       m_Array = reinterpret_cast<T*>(p->getVoidPointer(0));
       m_Size = p->getSize();
       m_OwnsData = true;
@@ -1266,10 +1591,101 @@ class DataArray : public IDataArray
       m_NumTuples = p->getNumberOfTuples();
       m_CompDims = p->getComponentDimensions();
       m_NumComponents = p->getNumberOfComponents();
+      return err;
+    }
 
-      // Tell the intermediate DataArray to release ownership of the data as we are going to be responsible
-      // for deleting the memory
-      p->releaseOwnership();
+    /**
+     * @brief Reads only the requested range of tuples from the HDF5 dataset. Just the
+     * selected elements are transferred from the file.
+     * @param parentId
+     * @param tupleStart
+     * @param numTuples
+     * @return
+     */
+    int readH5DataTuples(hid_t parentId, size_t tupleStart, size_t numTuples) override
+    {
+      QString classType;
+      int version = 0;
+      QVector<size_t> tDims;
+      QVector<size_t> cDims;
+      int err = H5DataArrayReader::ReadRequiredAttributes(parentId, getName(), classType, version, tDims, cDims);
+      if(err < 0)
+      {
+        return err;
+      }
+      size_t totalTuples = std::accumulate(tDims.begin(), tDims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+      if(numTuples == 0 || tupleStart + numTuples > totalTuples)
+      {
+        return -1;
+      }
+      if(!allocateForH5Read(numTuples, cDims))
+      {
+        return -2;
+      }
+      hsize_t start = static_cast<hsize_t>(tupleStart) * m_NumComponents;
+      hsize_t numElements = static_cast<hsize_t>(numTuples) * m_NumComponents;
+      err = QH5Lite::readPointerDatasetElementRange(parentId, getName(), start, numElements, m_Array);
+      if(err < 0)
+      {
+        resize(0);
+      }
+      return err;
+    }
+
+    /**
+     * @brief Reads a rectangular block of tuples from the HDF5 dataset using a
+     * hyperslab selection so only the block is transferred from the file.
+     * @param parentId
+     * @param tupleOffset
+     * @param tupleCount
+     * @return
+     */
+    int readH5DataSubVolume(hid_t parentId, const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount) override
+    {
+      QString classType;
+      int version = 0;
+      QVector<size_t> tDims;
+      QVector<size_t> cDims;
+      int err = H5DataArrayReader::ReadRequiredAttributes(parentId, getName(), classType, version, tDims, cDims);
+      if(err < 0)
+      {
+        return err;
+      }
+      if(tupleOffset.size() != tDims.size() || tupleCount.size() != tDims.size())
+      {
+        return -1;
+      }
+
+      // HDF5 stores the tuple dimensions slowest to fastest (ZYX) followed by the
+      // component dimensions, so both are reversed. See H5DataArrayWriter.
+      QVector<hsize_t> offset;
+      QVector<hsize_t> count;
+      size_t numTuples = 1;
+      for(int32_t i = tDims.size() - 1; i >= 0; i--)
+      {
+        if(tupleCount[i] == 0 || tupleOffset[i] + tupleCount[i] > tDims[i])
+        {
+          return -1;
+        }
+        offset.push_back(tupleOffset[i]);
+        count.push_back(tupleCount[i]);
+        numTuples *= tupleCount[i];
+      }
+      for(int32_t i = cDims.size() - 1; i >= 0; i--)
+      {
+        offset.push_back(0);
+        count.push_back(cDims[i]);
+      }
+
+      if(!allocateForH5Read(numTuples, cDims))
+      {
+        return -2;
+      }
+      err = QH5Lite::readPointerDatasetHyperslab(parentId, getName(), offset, count, m_Array);
+      if(err < 0)
+      {
+        resize(0);
+      }
       return err;
     }
 
@@ -1278,6 +1694,8 @@ class DataArray : public IDataArray
      */
     virtual void byteSwapElements()
     {
+      loadIfPending();
+      if(!detachIfShared()) { return; }
       char* ptr = (char*)(m_Array);
       char t[8];
       size_t size = getTypeSize();
@@ -1304,13 +1722,16 @@ class DataArray : public IDataArray
     }
 
     /**
-      * @brief operator []
+      * @brief operator [] Gives the array a private copy of shared values first, so the
+      * returned reference must not be kept across a deepCopy().
       * @param i
       * @return
       */
     inline T& operator[](size_t i)
     {
+      loadIfPending();
       Q_ASSERT(i < m_Size);
+      detachIfShared();
       return m_Array[i];
     }
 
@@ -1327,7 +1748,12 @@ class DataArray : public IDataArray
       m_OwnsData(ownsData),
       m_IsAllocated(false),
       m_Name(name),
-      m_NumTuples(numTuples)
+      m_NumTuples(numTuples),
+      m_StorageType(DataArrayStorage::Type::Automatic),
+      m_LazyLoadPending(false),
+      m_LazyLoadFailed(false),
+      m_IsShared(false),
+      m_WritablePointerEpoch(k_NoWritablePointer)
     {
       // Set the Component Dimensions and compute the number of components at each tuple for caching
       m_CompDims = compDims;
@@ -1349,6 +1775,16 @@ class DataArray : public IDataArray
      */
     void _deallocate()
     {
+      if(nullptr != m_SharedStorage.get())
+      {
+        // The memory belongs to the shared block and may still be used by a copy
+        m_SharedStorage.reset();
+        m_IsShared.store(false, std::memory_order_release);
+        m_MappedBuffer.reset();
+        m_Array = nullptr;
+        m_IsAllocated = false;
+        return;
+      }
       // We are going to splat 0xABABAB across the first value of the array as a debugging aid
       unsigned char* cptr = reinterpret_cast<unsigned char*>(m_Array);
       if(nullptr != cptr)
@@ -1373,11 +1809,19 @@ class DataArray : public IDataArray
       }
 #endif
 
+      if(nullptr != m_MappedBuffer.get())
+      {
+        // Unmaps the memory and removes the scratch file
+        m_MappedBuffer.reset();
+      }
+      else
+      {
 #if defined ( AIM_USE_SSE ) && defined ( __SSE2__ )
-      _mm_free( m_buffer );
+        _mm_free( m_buffer );
 #else
-      free(m_Array);
+        free(m_Array);
 #endif
+      }
       m_Array = nullptr;
       m_IsAllocated = false;
     }
@@ -1418,19 +1862,22 @@ class DataArray : public IDataArray
       size_t newSize;
       size_t oldSize;
 
-      if (size == m_Size) // Requested size is equal to current size.  Do nothing.
+      // Wipe out the array completely if new size is zero. A pending lazy read is dropped, not performed.
+      if (size == 0)
       {
+        clear();
         return m_Array;
       }
-      newSize = size;
-      oldSize = m_Size;
-
-      // Wipe out the array completely if new size is zero.
-      if (newSize == 0)
+      loadIfPending();
+      if (size == m_Size) // Requested size is equal to current size.  Do nothing.
       {
-        clear();
         return m_Array;
       }
+      if(!detachIfShared()) { return nullptr; }
+      // The values no longer match the dataset in the file
+      m_LazySource.reset();
+      newSize = size;
+      oldSize = m_Size;
       // OS X's realloc does not free memory if the new block is smaller.  This
       // is a very serious problem and causes huge amount of memory to be
       // wasted. Do not use realloc on the Mac.
@@ -1439,8 +1886,41 @@ class DataArray : public IDataArray
       dontUseRealloc = true;
 #endif
 
+      MappedFileBuffer::Pointer newBuffer = m_MappedBuffer;
+      bool useMappedFile = DataArrayStorage::UseMappedFile(m_StorageType, newSize * sizeof(T));
+
+      if (useMappedFile && (nullptr != m_MappedBuffer.get()) && (true == m_OwnsData))
+      {
+        // Grow or shrink the scratch file. The contents are kept by the file itself.
+        bool resized = m_MappedBuffer->resize(newSize * sizeof(T));
+        m_Array = static_cast<T*>(m_MappedBuffer->getPointer());
+        if (!resized)
+        {
+          qDebug() << "Unable to resize the scratch file of " << m_Name << " to " << newSize << " elements of size " << sizeof(T) << " bytes: " << m_MappedBuffer->getErrorString();
+          return nullptr;
+        }
+        newArray = m_Array;
+      }
+      else if (useMappedFile || (nullptr != m_MappedBuffer.get()))
+      {
+        // Moving between heap memory and a scratch file
+        newArray = allocateStorage(newSize, useMappedFile, newBuffer);
+        if (!newArray)
+        {
+          qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
+          return nullptr;
+        }
+        if (m_Array != nullptr)
+        {
+          std::memcpy(newArray, m_Array, (newSize < m_Size ? newSize : m_Size) * sizeof(T));
+        }
+        if (true == m_OwnsData)
+        {
+          _deallocate();
+        }
+      }
       // Allocate a new array if we DO NOT own the current array
-      if ((nullptr != m_Array) && (false == m_OwnsData))
+      else if ((nullptr != m_Array) && (false == m_OwnsData))
       {
         // The old array is owned by the user so we cannot try to
         // reallocate it.  Just allocate new memory that we will own.
@@ -1485,6 +1965,7 @@ class DataArray : public IDataArray
       // Allocation was successful.  Save it.
       m_Size = newSize;
       m_Array = newArray;
+      m_MappedBuffer = newBuffer;
 
       // This object has now allocated its memory and owns it.
       m_OwnsData = true;
@@ -1504,6 +1985,230 @@ class DataArray : public IDataArray
 
   private:
 
+    /**
+     * @brief Allocates room for numElements values either on the heap or in a new memory
+     * mapped scratch file. Falls back to the heap if the scratch file can not be created.
+     * @param numElements
+     * @param mappedFile
+     * @param buffer Receives the scratch file or a NullPointer for heap memory
+     * @return nullptr if the memory could not be allocated
+     */
+    T* allocateStorage(size_t numElements, bool mappedFile, MappedFileBuffer::Pointer& buffer)
+    {
+      buffer = MappedFileBuffer::NullPointer();
+      if(mappedFile)
+      {
+        QString errorMessage;
+        buffer = MappedFileBuffer::Create(numElements * sizeof(T), &errorMessage);
+        if(nullptr != buffer.get())
+        {
+          return static_cast<T*>(buffer->getPointer());
+        }
+        qDebug() << "Unable to create a scratch file for " << m_Name << ": " << errorMessage << ". Using heap memory instead.";
+      }
+#if defined ( AIM_USE_SSE ) && defined ( __SSE2__ )
+      return static_cast<T*>( _mm_malloc (numElements * sizeof(T), 16) );
+#else
+      return (T*)malloc(numElements * sizeof(T));
+#endif
+    }
+
+    /**
+     * @brief Moves the values of an allocated array that owns its memory to the heap or to
+     * a new scratch file
+     * @param mappedFile
+     * @return false if the new memory could not be allocated
+     */
+    bool moveStorage(bool mappedFile)
+    {
+      MappedFileBuffer::Pointer newBuffer;
+      T* newArray = allocateStorage(m_Size, mappedFile, newBuffer);
+      if(nullptr == newArray)
+      {
+        return false;
+      }
+      std::memcpy(newArray, m_Array, m_Size * sizeof(T));
+      _deallocate();
+      m_Array = newArray;
+      m_MappedBuffer = newBuffer;
+      m_IsAllocated = true;
+      return true;
+    }
+
+    /**
+     * @brief Reads the values from the lazy data source if they have not been read yet
+     */
+    inline void loadIfPending()
+    {
+      if(m_LazyLoadPending.load(std::memory_order_acquire))
+      {
+        loadLazyData();
+      }
+    }
+
+    /**
+     * @brief Allocates the array and reads the values from the lazy data source. If the
+     * memory can not be allocated or the read fails the array is left empty, with zero
+     * tuples, and loadData() reports the failure.
+     */
+    void loadLazyData()
+    {
+      std::lock_guard<std::mutex> lock(m_LazySource->getMutex());
+      // Another thread may have finished the read while we were waiting on the lock
+      if(!m_LazyLoadPending.load(std::memory_order_relaxed))
+      {
+        return;
+      }
+      MappedFileBuffer::Pointer buffer;
+      T* data = allocateStorage(m_Size, DataArrayStorage::UseMappedFile(m_StorageType, m_Size * sizeof(T)), buffer);
+      if(nullptr != data && m_LazySource->readDataset(data) < 0)
+      {
+        qDebug() << "Error reading the values of " << m_Name << " from " << m_LazySource->getFile()->getFilePath();
+        if(nullptr == buffer.get())
+        {
+#if defined ( AIM_USE_SSE ) && defined ( __SSE2__ )
+          _mm_free( data );
+#else
+          free(data);
+#endif
+        }
+        buffer.reset();
+        data = nullptr;
+      }
+      else if(nullptr == data)
+      {
+        qDebug() << "Unable to allocate " << m_Size << " elements of size " << sizeof(T) << " bytes. ";
+      }
+      m_Array = data;
+      m_MappedBuffer = buffer;
+      m_OwnsData = true;
+      m_IsAllocated = (nullptr != data);
+      m_LazyLoadFailed = (nullptr == data);
+      if(m_LazyLoadFailed)
+      {
+        m_Size = 0;
+        m_MaxId = 0;
+        m_NumTuples = 0;
+      }
+      m_LazyLoadPending.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Gives this array a private copy of its values if they are shared with a copy
+     * @return false if the private copy could not be allocated
+     */
+    inline bool detachIfShared()
+    {
+      if(m_IsShared.load(std::memory_order_acquire))
+      {
+        return detachSharedStorage();
+      }
+      return true;
+    }
+
+    /**
+     * @brief Remembers that a writable pointer into the values was handed out during the
+     * current epoch, see DataArrayStorage::ReleaseWritablePointers()
+     */
+    inline void markWritablePointer()
+    {
+      uint64_t epoch = DataArrayStorage::GetWritablePointerEpoch();
+      if(m_WritablePointerEpoch.load(std::memory_order_relaxed) != epoch)
+      {
+        m_WritablePointerEpoch.store(epoch, std::memory_order_relaxed);
+      }
+    }
+
+    /**
+     * @brief Stops sharing the values. If every other array let go of them already the memory is
+     * simply taken back, otherwise the values are copied into new memory.
+     * @return false if the new memory could not be allocated, in which case the values stay shared
+     */
+    bool detachSharedStorage()
+    {
+      std::lock_guard<std::mutex> lock(m_SharedMutex);
+      // Another thread may have detached the array while we were waiting on the lock
+      if(!m_IsShared.load(std::memory_order_relaxed))
+      {
+        return true;
+      }
+      if(m_SharedStorage.use_count() == 1)
+      {
+        m_SharedStorage->array = nullptr;
+        m_SharedStorage->mappedBuffer.reset();
+      }
+      else
+      {
+        MappedFileBuffer::Pointer newBuffer;
+        T* newArray = allocateStorage(m_Size, DataArrayStorage::UseMappedFile(m_StorageType, m_Size * sizeof(T)), newBuffer);
+        if(nullptr == newArray)
+        {
+          // Keep reading the shared values; the caller must not write through them
+          qDebug() << "Unable to allocate " << m_Size << " elements of size " << sizeof(T) << " bytes. ";
+          return false;
+        }
+        std::memcpy(newArray, m_Array, m_Size * sizeof(T));
+        m_MappedBuffer = newBuffer;
+        m_Array = newArray;
+      }
+      m_SharedStorage.reset();
+      m_OwnsData = true;
+      m_IsShared.store(false, std::memory_order_release);
+      return true;
+    }
+
+    /**
+     * @brief Lets 'other' use the values of this array without copying them. The memory is moved
+     * into a reference counted block that is released by the last array using it.
+     * @param other A new array with the same size as this one
+     * @return false if the values can not be shared and have to be copied
+     */
+    bool shareStorage(DataArray<T>& other)
+    {
+      loadIfPending();
+      if(!DataArrayStorage::GetCopyOnWrite() || !m_OwnsData || nullptr == m_Array || m_Size == 0 || other.m_Size != m_Size)
+      {
+        return false;
+      }
+      // A writable pointer handed out since the last release could still change the shared values
+      if(m_WritablePointerEpoch.load(std::memory_order_relaxed) == DataArrayStorage::GetWritablePointerEpoch())
+      {
+        return false;
+      }
+      std::lock_guard<std::mutex> lock(m_SharedMutex);
+      if(nullptr == m_SharedStorage.get())
+      {
+        m_SharedStorage = std::make_shared<SharedStorage>(m_Array, m_MappedBuffer);
+        m_IsShared.store(true, std::memory_order_release);
+      }
+      other.clear();
+      other.m_Array = m_Array;
+      other.m_Size = m_Size;
+      other.m_MaxId = m_MaxId;
+      other.m_NumTuples = m_NumTuples;
+      other.m_MappedBuffer = m_MappedBuffer;
+      other.m_SharedStorage = m_SharedStorage;
+      other.m_OwnsData = true;
+      other.m_IsAllocated = true;
+      other.m_IsShared.store(true, std::memory_order_release);
+      return true;
+    }
+
+    /**
+     * @brief Releases the current storage and allocates room for numTuples tuples
+     * with the given component dimensions before a partial HDF5 read.
+     * @param numTuples
+     * @param cDims
+     * @return
+     */
+    bool allocateForH5Read(size_t numTuples, const QVector<size_t>& cDims)
+    {
+      resize(0);
+      m_CompDims = cDims;
+      m_NumComponents = std::accumulate(cDims.begin(), cDims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+      return resize(numTuples) > 0;
+    }
+
     //  unsigned long long int MUD_FLAP_0;
     T* m_Array;
     //  unsigned long long int MUD_FLAP_1;
@@ -1525,6 +2230,44 @@ class DataArray : public IDataArray
 
     T m_InitValue;
 
+    DataArrayStorage::Type m_StorageType;
+    MappedFileBuffer::Pointer m_MappedBuffer;
+
+    H5LazyDataSource::Pointer m_LazySource;
+    std::atomic<bool> m_LazyLoadPending;
+    bool m_LazyLoadFailed;
+
+    /**
+     * @brief The SharedStorage struct owns memory that several copies of an array read from
+     */
+    struct SharedStorage
+    {
+      SharedStorage(T* data, const MappedFileBuffer::Pointer& buffer)
+      : array(data)
+      , mappedBuffer(buffer)
+      {
+      }
+      ~SharedStorage()
+      {
+        if(nullptr == mappedBuffer.get() && nullptr != array)
+        {
+#if defined ( AIM_USE_SSE ) && defined ( __SSE2__ )
+          _mm_free( array );
+#else
+          free(array);
+#endif
+        }
+      }
+      T* array;
+      MappedFileBuffer::Pointer mappedBuffer;
+    };
+    std::shared_ptr<SharedStorage> m_SharedStorage;
+    std::atomic<bool> m_IsShared;
+    std::mutex m_SharedMutex;
+
+    static const uint64_t k_NoWritablePointer = std::numeric_limits<uint64_t>::max();
+    std::atomic<uint64_t> m_WritablePointerEpoch;
+
     DataArray(const DataArray&); //Not Implemented
     void operator=(const DataArray&); //Not Implemented
 
@@ -0,0 +1,300 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DataArrayStorage.h"
+
+#include <atomic>
+#include <mutex>
+
+#include <QtCore/QDir>
+#include <QtCore/QObject>
+
+namespace
+{
+std::atomic<size_t> s_MappedFileThreshold(0);
+std::atomic<bool> s_CopyOnWrite(true);
+std::atomic<uint64_t> s_WritablePointerEpoch(0);
+std::mutex s_ScratchDirectoryMutex;
+QString s_ScratchDirectory;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayStorage::SetMappedFileThreshold(size_t numBytes)
+{
+  s_MappedFileThreshold = numBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataArrayStorage::GetMappedFileThreshold()
+{
+  return s_MappedFileThreshold;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayStorage::SetCopyOnWrite(bool value)
+{
+  s_CopyOnWrite = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataArrayStorage::GetCopyOnWrite()
+{
+  return s_CopyOnWrite;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayStorage::ReleaseWritablePointers()
+{
+  s_WritablePointerEpoch.fetch_add(1, std::memory_order_acq_rel);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t DataArrayStorage::GetWritablePointerEpoch()
+{
+  return s_WritablePointerEpoch.load(std::memory_order_acquire);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayStorage::SetScratchDirectory(const QString& path)
+{
+  std::lock_guard<std::mutex> lock(s_ScratchDirectoryMutex);
+  s_ScratchDirectory = path;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DataArrayStorage::GetScratchDirectory()
+{
+  std::lock_guard<std::mutex> lock(s_ScratchDirectoryMutex);
+  if(s_ScratchDirectory.isEmpty())
+  {
+    return QDir::tempPath();
+  }
+  return s_ScratchDirectory;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataArrayStorage::UseMappedFile(Type type, size_t numBytes)
+{
+  if(numBytes == 0)
+  {
+    return false;
+  }
+  switch(type)
+  {
+  case Type::Heap:
+    return false;
+  case Type::MappedFile:
+    return true;
+  case Type::Automatic:
+    break;
+  }
+  size_t threshold = s_MappedFileThreshold;
+  return threshold > 0 && numBytes >= threshold;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MappedFileBuffer::MappedFileBuffer()
+: m_File(QDir(DataArrayStorage::GetScratchDirectory()).filePath("SIMPL_DataArray_XXXXXX.scratch"))
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MappedFileBuffer::~MappedFileBuffer()
+{
+  unmap();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MappedFileBuffer::Pointer MappedFileBuffer::Create(size_t numBytes, QString* errorMessage)
+{
+  Pointer buffer(new MappedFileBuffer());
+  if(!buffer->m_File.open())
+  {
+    if(nullptr != errorMessage)
+    {
+      *errorMessage = QObject::tr("Unable to create the scratch file %1: %2").arg(buffer->m_File.fileTemplate()).arg(buffer->m_File.errorString());
+    }
+    return NullPointer();
+  }
+  if(!buffer->map(numBytes))
+  {
+    if(nullptr != errorMessage)
+    {
+      *errorMessage = buffer->m_ErrorString;
+    }
+    return NullPointer();
+  }
+  return buffer;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* MappedFileBuffer::getPointer() const
+{
+  return m_Data;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t MappedFileBuffer::getSize() const
+{
+  return m_Size;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString MappedFileBuffer::getFilePath() const
+{
+  return m_File.fileName();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString MappedFileBuffer::getErrorString() const
+{
+  return m_ErrorString;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MappedFileBuffer::resize(size_t numBytes)
+{
+  if(numBytes == m_Size)
+  {
+    return true;
+  }
+  if(numBytes == 0)
+  {
+    m_ErrorString = QObject::tr("A scratch file can not be resized to 0 bytes");
+    return false;
+  }
+
+  // The old mapping stays in place until the new one exists: a growing file is extended
+  // before it is mapped again and a shrinking one is only truncated after the old mapping
+  // is gone, so a failure never touches the current contents.
+  size_t oldSize = m_Size;
+  if(numBytes > oldSize && !m_File.resize(static_cast<qint64>(numBytes)))
+  {
+    m_ErrorString = QObject::tr("Unable to resize the scratch file %1 to %2 bytes: %3").arg(m_File.fileName()).arg(numBytes).arg(m_File.errorString());
+    return false;
+  }
+  uchar* data = m_File.map(0, static_cast<qint64>(numBytes));
+  if(nullptr == data)
+  {
+    m_ErrorString = QObject::tr("Unable to map %1 bytes of the scratch file %2: %3").arg(numBytes).arg(m_File.fileName()).arg(m_File.errorString());
+    if(numBytes > oldSize)
+    {
+      m_File.resize(static_cast<qint64>(oldSize));
+    }
+    return false;
+  }
+  unmap();
+  m_Data = data;
+  m_Size = numBytes;
+  if(numBytes < oldSize)
+  {
+    // A file that can not be truncated only keeps an unused tail
+    m_File.resize(static_cast<qint64>(numBytes));
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MappedFileBuffer::map(size_t numBytes)
+{
+  if(numBytes == 0)
+  {
+    m_ErrorString = QObject::tr("A scratch file can not be mapped with 0 bytes");
+    return false;
+  }
+  // Growing the file leaves a sparse hole so no disk space is used until pages are written
+  if(!m_File.resize(static_cast<qint64>(numBytes)))
+  {
+    m_ErrorString = QObject::tr("Unable to resize the scratch file %1 to %2 bytes: %3").arg(m_File.fileName()).arg(numBytes).arg(m_File.errorString());
+    return false;
+  }
+  m_Data = m_File.map(0, static_cast<qint64>(numBytes));
+  if(nullptr == m_Data)
+  {
+    m_ErrorString = QObject::tr("Unable to map %1 bytes of the scratch file %2: %3").arg(numBytes).arg(m_File.fileName()).arg(m_File.errorString());
+    return false;
+  }
+  m_Size = numBytes;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MappedFileBuffer::unmap()
+{
+  if(nullptr != m_Data)
+  {
+    m_File.unmap(m_Data);
+  }
+  m_Data = nullptr;
+  m_Size = 0;
+}
@@ -0,0 +1,201 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <QtCore/QString>
+#include <QtCore/QTemporaryFile>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+
+/**
+ * @class DataArrayStorage DataArrayStorage.h SIMPLib/DataArrays/DataArrayStorage.h
+ * @brief Decides where the values of a DataArray are kept. Arrays are kept on the heap
+ * unless they ask for a memory mapped scratch file or their size reaches the global
+ * threshold. A threshold of zero (the default) keeps every Automatic array on the heap.
+ * PipelineRunner sets the threshold from its --mapped-threshold option and SIMPLView
+ * from the pipeline execution settings.
+ */
+class SIMPLib_EXPORT DataArrayStorage
+{
+  public:
+    enum class Type : unsigned int
+    {
+      Automatic = 0, //!< Heap unless the array size reaches the mapped file threshold
+      Heap = 1,
+      MappedFile = 2
+    };
+
+    /**
+     * @brief SetMappedFileThreshold Sets the size in bytes at which Automatic arrays are
+     * placed in a memory mapped scratch file. Zero disables mapped storage.
+     * @param numBytes
+     */
+    static void SetMappedFileThreshold(size_t numBytes);
+
+    /**
+     * @brief GetMappedFileThreshold
+     * @return
+     */
+    static size_t GetMappedFileThreshold();
+
+    /**
+     * @brief SetScratchDirectory Sets the directory the scratch files are created in. An
+     * empty path uses the system temporary directory.
+     * @param path
+     */
+    static void SetScratchDirectory(const QString& path);
+
+    /**
+     * @brief GetScratchDirectory
+     * @return
+     */
+    static QString GetScratchDirectory();
+
+    /**
+     * @brief UseMappedFile
+     * @param type The storage type requested by the array
+     * @param numBytes The size of the array in bytes
+     * @return true if the array should be kept in a memory mapped scratch file
+     */
+    static bool UseMappedFile(Type type, size_t numBytes);
+
+    /**
+     * @brief SetCopyOnWrite Selects whether DataArray::deepCopy() shares the values of the
+     * source array until one of the arrays is written to (the default), or copies them right away.
+     * Every DataArray method that can change a value gives the array a private copy first. An
+     * array that handed out a writable pointer since the last call to ReleaseWritablePointers()
+     * is always copied, because that pointer could still be used to change the source.
+     * @param value
+     */
+    static void SetCopyOnWrite(bool value);
+
+    /**
+     * @brief GetCopyOnWrite
+     * @return
+     */
+    static bool GetCopyOnWrite();
+
+    /**
+     * @brief ReleaseWritablePointers Declares that the writable pointers handed out by DataArray
+     * so far are no longer used to change values. The FilterPipeline calls this before each filter
+     * runs, since every filter fetches its pointers again in dataCheck().
+     */
+    static void ReleaseWritablePointers();
+
+    /**
+     * @brief GetWritablePointerEpoch
+     * @return The number of times ReleaseWritablePointers() was called
+     */
+    static uint64_t GetWritablePointerEpoch();
+
+  private:
+    DataArrayStorage() = delete;
+};
+
+/**
+ * @class MappedFileBuffer DataArrayStorage.h SIMPLib/DataArrays/DataArrayStorage.h
+ * @brief A block of memory that is backed by a temporary scratch file instead of swap so
+ * the operating system can page it in and out as needed. The file is removed when the
+ * buffer is destroyed.
+ */
+class SIMPLib_EXPORT MappedFileBuffer
+{
+  public:
+    SIMPL_SHARED_POINTERS(MappedFileBuffer)
+
+    /**
+     * @brief Create Creates a scratch file of the given size and maps it into memory
+     * @param numBytes
+     * @param errorMessage Receives the reason if the file could not be created or mapped
+     * @return A NullPointer if the file could not be created or mapped
+     */
+    static Pointer Create(size_t numBytes, QString* errorMessage = nullptr);
+
+    virtual ~MappedFileBuffer();
+
+    /**
+     * @brief getPointer
+     * @return The start of the mapped memory
+     */
+    void* getPointer() const;
+
+    /**
+     * @brief getSize
+     * @return The size of the mapped memory in bytes
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief getFilePath
+     * @return The path of the scratch file
+     */
+    QString getFilePath() const;
+
+    /**
+     * @brief getErrorString
+     * @return Why the last call to resize() failed
+     */
+    QString getErrorString() const;
+
+    /**
+     * @brief resize Grows or shrinks the scratch file and maps it again. The contents up
+     * to the smaller of the two sizes are kept. The pointer returned by getPointer() may
+     * change.
+     * @param numBytes
+     * @return false if the file could not be resized or mapped. The old mapping and its
+     * contents are then left untouched and getErrorString() tells why.
+     */
+    bool resize(size_t numBytes);
+
+  protected:
+    MappedFileBuffer();
+
+  private:
+    QTemporaryFile m_File;
+    uchar* m_Data = nullptr;
+    size_t m_Size = 0;
+    QString m_ErrorString;
+
+    bool map(size_t numBytes);
+    void unmap();
+
+    MappedFileBuffer(const MappedFileBuffer&) = delete; // Copy Constructor Not Implemented
+    void operator=(const MappedFileBuffer&) = delete;   // Move assignment Not Implemented
+};
@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <cstring>
 #include <vector>
 
 //-- DREAM3D Includes
@@ -44,6 +45,10 @@
 /**
  * @brief The MeshFaceNeighbors class contains arrays of Faces for each Node in the mesh. This allows quick query to the node
  * to determine what Cells the node is a part of.
+ *
+ * The lists are stored in compressed sparse row form: one flat array holds the values of every list back to back
+ * and an offsets array holds the position of the first value of each list, so the whole structure uses two
+ * allocations regardless of the number of lists.
  */
 template <typename T, typename K> class DynamicListArray
 {
@@ -52,6 +57,10 @@ public:
   SIMPL_STATIC_NEW_MACRO(DynamicListArray)
   SIMPL_TYPE_MACRO(DynamicListArray)
 
+  /**
+   * @brief The ElementList class is a view of a single list. The cells pointer points into the
+   * storage of the DynamicListArray and is only valid until the lists are reallocated.
+   */
   class ElementList
   {
   public:
@@ -62,22 +71,7 @@ public:
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
-  virtual ~DynamicListArray()
-  {
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
-    {
-      if(this->m_Array[i].cells != nullptr)
-      {
-        delete[] this->m_Array[i].cells;
-      }
-    }
-    // Now delete all the "NeighborLists" structures
-    if(this->m_Array != nullptr)
-    {
-      delete[] this->m_Array;
-    }
-  }
+  virtual ~DynamicListArray() = default;
 
   /**
    * @brief size
@@ -96,26 +90,16 @@ public:
   Pointer deepCopy(bool forceNoAllocate = false)
   {
     DynamicListArray::Pointer copy = DynamicListArray::New();
-    std::vector<T> linkCounts(m_Size, 0);
     if(forceNoAllocate)
     {
+      std::vector<T> linkCounts(m_Size, 0);
       copy->allocateLists(linkCounts);
       return copy;
     }
 
-    // Figure out how many entries, and for each entry, how many cells
-    for(size_t ptId = 0; ptId < m_Size; ptId++)
-    {
-      linkCounts[ptId] = this->m_Array[ptId].ncells;
-    }
-    // Allocate all that in the copy
-    copy->allocateLists(linkCounts);
-    // Copy the data from the original to the new
-    for(size_t ptId = 0; ptId < m_Size; ptId++)
-    {
-      ElementList& elementList = getElementList(ptId);
-      copy->setElementList(ptId, elementList);
-    }
+    copy->m_Size = m_Size;
+    copy->m_Offsets = m_Offsets;
+    copy->m_Values = m_Values;
     return copy;
   }
 
@@ -127,21 +111,31 @@ public:
    */
   inline void insertCellReference(size_t ptId, size_t pos, size_t cellId)
   {
-    this->m_Array[ptId].cells[pos] = cellId;
+    this->m_Values[this->m_Offsets[ptId] + pos] = cellId;
   }
 
   /**
-   * @brief Get a link structure given a point id.
+   * @brief Get a link structure given a point id. The list is returned by value: it is a view made of
+   * the count and a pointer into the flat value storage, not a reference to a stored list. Writing
+   * through cells changes the stored values, but assigning ncells or cells changes only the copy.
+   * Code that used to resize or replace a list through the returned reference must call
+   * setElementList instead. Binding the result to a non-const reference no longer compiles, which
+   * flags such code.
    * @param ptId
    * @return
    */
-  ElementList& getElementList(size_t ptId)
+  ElementList getElementList(size_t ptId)
   {
-    return this->m_Array[ptId];
+    ElementList list = {getNumberOfElements(ptId), getElementListPointer(ptId)};
+    return list;
   }
 
   /**
-   * @brief setElementList
+   * @brief setElementList Copies nCells values into the list at ptId. Keeping the size of the list costs
+   * O(nCells). Changing the size costs O(n) in the total number of values and lists, because every
+   * list stored after ptId is moved and its offset updated, so calling this for many lists with new
+   * sizes is quadratic. Size the lists up front with allocateLists and fill them with
+   * insertCellReference or through getElementListPointer instead.
    * @param ptId
    * @param nCells
    * @param data
@@ -153,15 +147,30 @@ public:
     {
       return false;
     }
-    if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
+
+    size_t oldCount = this->m_Offsets[ptId + 1] - this->m_Offsets[ptId];
+    size_t newCount = static_cast<size_t>(nCells);
+    if(newCount != oldCount)
     {
-      m_Array[ptId].cells = nullptr;
-      m_Array[ptId].ncells = 0;
+      typename std::vector<K>::iterator first = this->m_Values.begin() + this->m_Offsets[ptId];
+      if(newCount > oldCount)
+      {
+        this->m_Values.insert(first + oldCount, newCount - oldCount, K(0));
+      }
+      else
+      {
+        this->m_Values.erase(first + newCount, first + oldCount);
+      }
+      for(size_t i = ptId + 1; i <= m_Size; i++)
+      {
+        this->m_Offsets[i] = this->m_Offsets[i] + newCount - oldCount;
+      }
+    }
+
+    if(newCount > 0)
+    {
+      ::memcpy(getElementListPointer(ptId), data, sizeof(K) * newCount);
     }
-    m_Array[ptId].ncells = nCells;
-    // If nCells is huge then there could be problems with this
-    this->m_Array[ptId].cells = new K[nCells];
-    ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
     return true;
   }
 
@@ -173,22 +182,7 @@ public:
    */
   bool setElementList(size_t ptId, ElementList& list)
   {
-    T nCells = list.ncells;
-    K* data = list.cells;
-    if(ptId >= m_Size)
-    {
-      return false;
-    }
-    if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
-    {
-      m_Array[ptId].cells = nullptr;
-      m_Array[ptId].ncells = 0;
-    }
-    m_Array[ptId].ncells = nCells;
-    // If nCells is huge then there could be problems with this
-    this->m_Array[ptId].cells = new K[nCells];
-    ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
-    return true;
+    return setElementList(ptId, list.ncells, list.cells);
   }
 
   /**
@@ -198,7 +192,7 @@ public:
    */
   T getNumberOfElements(size_t ptId)
   {
-    return this->m_Array[ptId].ncells;
+    return static_cast<T>(this->m_Offsets[ptId + 1] - this->m_Offsets[ptId]);
   }
 
   /**
@@ -208,7 +202,35 @@ public:
    */
   K* getElementListPointer(size_t ptId)
   {
-    return this->m_Array[ptId].cells;
+    return this->m_Values.data() + this->m_Offsets[ptId];
+  }
+
+  /**
+   * @brief getNumberOfValues Returns the total number of values in all lists
+   * @return
+   */
+  size_t getNumberOfValues()
+  {
+    return m_Values.size();
+  }
+
+  /**
+   * @brief getValuesPointer Returns the flat array holding the values of every list back to back
+   * @return
+   */
+  K* getValuesPointer()
+  {
+    return m_Values.data();
+  }
+
+  /**
+   * @brief getOffsetsPointer Returns the size() + 1 offsets into the values array. The list at ptId
+   * occupies the values [offsets[ptId], offsets[ptId + 1]).
+   * @return
+   */
+  const size_t* getOffsetsPointer()
+  {
+    return m_Offsets.data();
   }
 
   /**
@@ -218,21 +240,7 @@ public:
    */
   void deserializeLinks(QVector<uint8_t>& buffer, size_t nElements)
   {
-    size_t offset = 0;
-    allocate(nElements); // Allocate all the links with 0 and nullptr;
-    uint8_t* bufPtr = buffer.data();
-
-    // Walk the array and allocate all the array links to Zero and nullptr
-    T* ncells = nullptr;
-    for(size_t i = 0; i < nElements; ++i)
-    {
-      ncells = reinterpret_cast<T*>(bufPtr + offset);
-      this->m_Array[i].ncells = *ncells; // Set the number of cells in this link
-      offset += 2;
-      this->m_Array[i].cells = new K[(*ncells)];                                // Allocate a new chunk of memory to store the list
-      ::memcpy(this->m_Array[i].cells, bufPtr + offset, (*ncells) * sizeof(K)); // Copy from the buffer into the new list memory
-      offset += (*ncells) * sizeof(K);                                          // Increment the offset
-    }
+    deserializeLinks(buffer.data(), static_cast<size_t>(buffer.size()), nElements);
   }
 
   /**
@@ -242,21 +250,46 @@ public:
    */
   void deserializeLinks(std::vector<uint8_t>& buffer, size_t nElements)
   {
+    deserializeLinks(buffer.data(), buffer.size(), nElements);
+  }
+
+  /**
+   * @brief deserializeLinks Reads lists that were serialized as a count of type T followed by that many
+   * values of type K, repeated for each of the nElements lists.
+   * @param bufPtr
+   * @param bufSize
+   * @param nElements
+   */
+  void deserializeLinks(const uint8_t* bufPtr, size_t bufSize, size_t nElements)
+  {
+    // First walk the buffer to find where each list starts
+    std::vector<T> linkCounts(nElements, 0);
     size_t offset = 0;
-    allocate(nElements); // Allocate all the links with 0 and nullptr;
-    uint8_t* bufPtr = &(buffer.front());
+    for(size_t i = 0; i < nElements && offset + sizeof(T) <= bufSize; ++i)
+    {
+      T ncells = 0;
+      ::memcpy(&ncells, bufPtr + offset, sizeof(T));
+      size_t next = offset + sizeof(T) + static_cast<size_t>(ncells) * sizeof(K);
+      if(next > bufSize)
+      {
+        break;
+      }
+      linkCounts[i] = ncells;
+      offset = next;
+    }
+    allocateLists(linkCounts);
 
-    // Walk the array and allocate all the array links to Zero and nullptr
-    T* ncells = nullptr;
-    // int32_t* cells = nullptr;
+    // Then copy every list straight into the flat value array
+    offset = 0;
     for(size_t i = 0; i < nElements; ++i)
     {
-      ncells = reinterpret_cast<T*>(bufPtr + offset);
-      this->m_Array[i].ncells = *ncells; // Set the number of cells in this link
-      offset += 2;
-      this->m_Array[i].cells = new K[(*ncells)];                                // Allocate a new chunk of memory to store the list
-      ::memcpy(this->m_Array[i].cells, bufPtr + offset, (*ncells) * sizeof(K)); // Copy from the buffer into the new list memory
-      offset += (*ncells) * sizeof(K);                                          // Increment the offset
+      offset += sizeof(T);
+      size_t numBytes = linkCounts[i] * sizeof(K);
+      if(numBytes > 0)
+      {
+        ::memcpy(getElementListPointer(i), bufPtr + offset, numBytes);
+      }
+      offset += numBytes;
     }
   }
 
@@ -266,12 +299,7 @@ public:
    */
   void allocateLists(QVector<T>& linkCounts)
   {
-    allocate(linkCounts.size());
-    for(typename std::vector<T>::size_type i = 0; i < linkCounts.size(); i++)
-    {
-      this->m_Array[i].ncells = linkCounts[i];
-      this->m_Array[i].cells = new K[this->m_Array[i].ncells];
-    }
+    allocate(static_cast<size_t>(linkCounts.size()), linkCounts.data());
   }
 
   /**
@@ -280,55 +308,36 @@ public:
    */
   void allocateLists(std::vector<T>& linkCounts)
   {
-    allocate(linkCounts.size());
-    for(typename std::vector<T>::size_type i = 0; i < linkCounts.size(); i++)
-    {
-      this->m_Array[i].ncells = linkCounts[i];
-      this->m_Array[i].cells = new K[this->m_Array[i].ncells];
-    }
+    allocate(linkCounts.size(), linkCounts.data());
   }
 
 protected:
   DynamicListArray()
-  : m_Array(nullptr)
+  : m_Offsets(1, 0)
   , m_Size(0)
   {
   }
 
   //----------------------------------------------------------------------------
-  // This will allocate memory to hold all the NeighborList structures where each
-  // structure is initialized to Zero Entries and a nullptr Pointer
-  void allocate(size_t sz, size_t ext = 1000)
+  // This will allocate the offsets for sz lists with linkCounts[i] entries in list i
+  // and a single value array large enough to hold all of them
+  void allocate(size_t sz, const T* linkCounts)
   {
-    static typename DynamicListArray<T, K>::ElementList linkInit = {0, nullptr};
-
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
-    {
-      if(this->m_Array[i].cells != nullptr)
-      {
-        delete[] this->m_Array[i].cells;
-      }
-    }
-    // Now delete all the "NeighborLists" structures
-    if(this->m_Array != nullptr)
-    {
-      delete[] this->m_Array;
-    }
-
     this->m_Size = sz;
-    // Allocate a whole new set of structures
-    this->m_Array = new typename DynamicListArray<T, K>::ElementList[sz];
-
-    // Initialize each structure to have 0 entries and nullptr pointer.
+    this->m_Offsets.assign(sz + 1, 0);
     for(size_t i = 0; i < sz; i++)
     {
-      this->m_Array[i] = linkInit;
+      this->m_Offsets[i + 1] = this->m_Offsets[i] + static_cast<size_t>(linkCounts[i]);
     }
+
+    // Release the old values before allocating the new ones
+    std::vector<K>().swap(this->m_Values);
+    this->m_Values.resize(this->m_Offsets[sz]);
   }
 
 private:
-  ElementList* m_Array; // pointer to data
+  std::vector<size_t> m_Offsets; // start of each list in m_Values, plus one past the end
+  std::vector<K> m_Values;       // the values of every list back to back
   size_t m_Size;
 };
 
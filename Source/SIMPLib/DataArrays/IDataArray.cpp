@@ -11,6 +11,8 @@
 
 #include "IDataArray.h"
 
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -28,3 +30,181 @@ bool IDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourc
 {
   return copyFromArray(destTupleOffset, sourceArray, 0, sourceArray->getNumberOfTuples());
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IDataArray::writeH5Data(hid_t parentId, QVector<size_t> tDims, const H5DatasetCreationPolicy& policy)
+{
+  Q_UNUSED(policy)
+  return writeH5Data(parentId, tDims);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IDataArray::readH5DataTuples(hid_t parentId, size_t tupleStart, size_t numTuples)
+{
+  int err = readH5Data(parentId);
+  if(err < 0)
+  {
+    return err;
+  }
+  if(tupleStart + numTuples > getNumberOfTuples())
+  {
+    return -1;
+  }
+  if(tupleStart > 0)
+  {
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      copyTuple(tupleStart + i, i);
+    }
+  }
+  resize(numTuples);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IDataArray::readH5DataSubVolume(hid_t parentId, const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount)
+{
+  QString classType;
+  int version = 0;
+  QVector<size_t> tDims;
+  QVector<size_t> cDims;
+  int err = H5DataArrayReader::ReadRequiredAttributes(parentId, getName(), classType, version, tDims, cDims);
+  if(err < 0)
+  {
+    return err;
+  }
+  err = readH5Data(parentId);
+  if(err < 0)
+  {
+    return err;
+  }
+  return cropTuples(tDims, tupleOffset, tupleCount);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IDataArray::cropTuples(const QVector<size_t>& tDims, const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount)
+{
+  int32_t rank = tDims.size();
+  if(rank == 0 || tupleOffset.size() != rank || tupleCount.size() != rank)
+  {
+    return -1;
+  }
+  size_t totalTuples = 1;
+  size_t numTuples = 1;
+  for(int32_t d = 0; d < rank; d++)
+  {
+    if(tupleCount[d] == 0 || tupleOffset[d] + tupleCount[d] > tDims[d])
+    {
+      return -2;
+    }
+    totalTuples *= tDims[d];
+    numTuples *= tupleCount[d];
+  }
+  if(totalTuples != getNumberOfTuples())
+  {
+    return -3;
+  }
+
+  // Walk the block in memory order (X fastest) and pack it to the front of the
+  // array. The source index is never smaller than the destination index so the
+  // copy can be done in place.
+  QVector<size_t> index(rank, 0);
+  for(size_t dest = 0; dest < numTuples; dest++)
+  {
+    size_t src = 0;
+    size_t stride = 1;
+    for(int32_t d = 0; d < rank; d++)
+    {
+      src += (tupleOffset[d] + index[d]) * stride;
+      stride *= tDims[d];
+    }
+    if(src != dest)
+    {
+      copyTuple(src, dest);
+    }
+    for(int32_t d = 0; d < rank; d++)
+    {
+      index[d]++;
+      if(index[d] < tupleCount[d])
+      {
+        break;
+      }
+      index[d] = 0;
+    }
+  }
+  resize(numTuples);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IDataArray::compactTuples(const QVector<bool>& keepMap)
+{
+  size_t numTuples = getNumberOfTuples();
+  if(static_cast<size_t>(keepMap.size()) != numTuples)
+  {
+    return -100;
+  }
+  // The source index is never smaller than the destination index so the
+  // surviving tuples can be packed in place.
+  size_t dest = 0;
+  for(size_t src = 0; src < numTuples; src++)
+  {
+    if(!keepMap[src])
+    {
+      continue;
+    }
+    if(src != dest)
+    {
+      copyTuple(src, dest);
+    }
+    dest++;
+  }
+  if(dest != numTuples)
+  {
+    resize(dest);
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IDataArray::setLazyDataSource(const H5LazyDataSource::Pointer& source)
+{
+  Q_UNUSED(source)
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IDataArray::isDataLoaded()
+{
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IDataArray::loadData()
+{
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IDataArray::evictData()
+{
+  return false;
+}
@@ -24,6 +24,8 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/HDF5/H5DatasetCreationPolicy.h"
+#include "SIMPLib/HDF5/H5LazyDataSource.h"
 
 
 /**
@@ -107,6 +109,18 @@ class SIMPLib_EXPORT IDataArray
      */
     virtual void* getVoidPointer ( size_t i) = 0;
 
+    /**
+     * @brief Returns a read-only void pointer pointing to the index of the array. Arrays
+     * that share their values with a copy hand these out without making a private copy,
+     * so code that only reads should use this instead of getVoidPointer().
+     * @param i The index to have the returned pointer pointing to.
+     * @return Void Pointer. Possibly nullptr.
+     */
+    virtual const void* getConstVoidPointer(size_t i)
+    {
+      return getVoidPointer(i);
+    }
+
     /**
     * @brief Returns the number of Tuples in the array.
     */
@@ -146,6 +160,15 @@ class SIMPLib_EXPORT IDataArray
      */
     virtual int eraseTuples(QVector<size_t>& idxs) = 0;
 
+    /**
+     * @brief Removes every tuple whose flag in the keep map is false, preserving the order of the
+     * remaining tuples. Unlike eraseTuples() the surviving tuples are moved towards the front of the
+     * existing storage where possible instead of being copied into a new buffer.
+     * @param keepMap One flag per tuple
+     * @return 0 on success
+     */
+    virtual int compactTuples(const QVector<bool>& keepMap);
+
     /**
      * @brief Copies a Tuple from one position to another.
      * @param currentPos The index of the source data
@@ -255,6 +278,17 @@ class SIMPLib_EXPORT IDataArray
      */
     virtual int writeH5Data(hid_t parentId, QVector<size_t> tDims) = 0;
 
+    /**
+     * @brief writeH5Data Writes the array using the given dataset creation policy to
+     * control chunking and compression. Subclasses that do not support a policy
+     * simply write the array with the default (contiguous) layout.
+     * @param parentId
+     * @param tDims
+     * @param policy
+     * @return
+     */
+    virtual int writeH5Data(hid_t parentId, QVector<size_t> tDims, const H5DatasetCreationPolicy& policy);
+
     /**
      * @brief readH5Data
      * @param parentId
@@ -262,6 +296,68 @@ class SIMPLib_EXPORT IDataArray
      */
     virtual int readH5Data(hid_t parentId) = 0;
 
+    /**
+     * @brief readH5DataTuples Reads only the tuples [tupleStart, tupleStart + numTuples)
+     * of the array that is stored in parentId under this array's name. The array is
+     * resized to hold exactly numTuples tuples. Subclasses that can not read a partial
+     * dataset fall back to reading the whole array and discarding the other tuples.
+     * @param parentId
+     * @param tupleStart
+     * @param numTuples
+     * @return Negative value on error
+     */
+    virtual int readH5DataTuples(hid_t parentId, size_t tupleStart, size_t numTuples);
+
+    /**
+     * @brief readH5DataSubVolume Reads a rectangular block of tuples from the array
+     * that is stored in parentId under this array's name. The offset and count are
+     * given in the same (XYZ) order as the tuple dimensions of the AttributeMatrix.
+     * The array is resized to hold the product of tupleCount tuples.
+     * @param parentId
+     * @param tupleOffset The first tuple index along each tuple dimension
+     * @param tupleCount The number of tuples along each tuple dimension
+     * @return Negative value on error
+     */
+    virtual int readH5DataSubVolume(hid_t parentId, const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount);
+
+    /**
+     * @brief cropTuples Compacts the array in place so that it only holds a rectangular
+     * block of its tuples and then resizes it to the size of that block.
+     * @param tDims The current tuple dimensions of the array (XYZ order)
+     * @param tupleOffset The first tuple index along each tuple dimension
+     * @param tupleCount The number of tuples along each tuple dimension
+     * @return Negative value on error
+     */
+    int cropTuples(const QVector<size_t>& tDims, const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount);
+
+    /**
+     * @brief setLazyDataSource Defers reading the values of the array until they are
+     * first accessed. The default implementation does not support lazy loading.
+     * @param source The HDF5 dataset that holds the values
+     * @return false if the array does not support lazy loading
+     */
+    virtual bool setLazyDataSource(const H5LazyDataSource::Pointer& source);
+
+    /**
+     * @brief isDataLoaded
+     * @return false if the values are still waiting to be read from a lazy data source
+     */
+    virtual bool isDataLoaded();
+
+    /**
+     * @brief loadData Reads the values of an array that has a lazy data source. Arrays without
+     * one are always loaded.
+     * @return false if the values could not be read from the file
+     */
+    virtual bool loadData();
+
+    /**
+     * @brief evictData Releases the memory of an array that has a lazy data source. The
+     * values are read again on the next access.
+     * @return false if the array can not be evicted
+     */
+    virtual bool evictData();
+
     /**
      * @brief writeXdmfAttribute
      * @param out
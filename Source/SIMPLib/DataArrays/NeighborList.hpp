@@ -36,6 +36,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
 #include <vector>
 
 #include <QtCore/QString>
@@ -45,6 +47,7 @@
 
 #include "H5Support/H5Lite.h"
 #include "H5Support/H5Utilities.h"
+#include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Lite.h"
 
 #include "SIMPLib/SIMPLib.h"
@@ -57,6 +60,17 @@
 /**
  * @class NeighborList NeighborList.hpp DREAM3DLib/Common/NeighborList.hpp
  * @brief Template class for wrapping raw arrays of data.
+ *
+ * The lists are held in one of two layouts. The packed layout stores every list back to
+ * back in a single value array indexed by an offsets array; it is what readH5Data produces
+ * and what writeH5Data writes without any repacking. The promoted layout gives each list
+ * its own shared vector and is what the mutating and reference returning methods work on.
+ * A packed list is promoted the first time one of those methods is called. Promoting does
+ * not free the packed arrays, so views and readers on other threads stay valid until the
+ * next structural mutation (addEntry, setList, resize, erase, pack...) releases them.
+ * pack() goes back to the packed layout once a list has been fully built. Code that only
+ * reads should use getListView(), getValue() or copyOfList(), which work on either layout
+ * without promoting and are safe to call concurrently with a promoting accessor.
  * @author mjackson
  * @date July 3, 2008
  * @version 1.0
@@ -71,6 +85,14 @@ class NeighborList : public IDataArray
 
     SIMPL_INSTANCE_STRING_PROPERTY(NumNeighborsArrayName)
 
+    /**
+     * @brief ContainsObjectIds marks a list whose entries are ids of objects in the same AttributeMatrix, such
+     * as the neighbor lists written by FindNeighbors. AttributeMatrix::removeInactiveObjects() renumbers these
+     * lists; lists named SIMPL::FeatureData::NeighborList are treated the same way even without the flag.
+     * The flag is stored with the list by writeH5Data() and restored by readH5Data().
+     */
+    SIMPL_INSTANCE_PROPERTY(bool, ContainsObjectIds)
+
     static Pointer New()
     {
       return CreateArray(0, "NeighborList", false);
@@ -239,6 +261,21 @@ class NeighborList : public IDataArray
     typedef std::vector<T> VectorType;
     typedef std::shared_ptr<VectorType> SharedVectorType;
 
+    /**
+     * @brief The ConstListView class is a read-only view of a single list. The values pointer points
+     * into the storage of the NeighborList and is only valid until the lists are changed.
+     */
+    class ConstListView
+    {
+      public:
+        const T* values;
+        size_t size;
+
+        const T* begin() const { return values; }
+        const T* end() const { return values + size; }
+        const T& operator[](size_t index) const { return values[index]; }
+    };
+
     ~NeighborList() override
     {
       //std::cout << "~NeighborList<T> size()=" << _data.size() << std::endl;
@@ -355,7 +392,7 @@ class NeighborList : public IDataArray
         return 0;
       }
 
-      size_t arraySize = m_Array.size();
+      size_t arraySize = getListCount();
       // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
       // off the end of the array and return an error code.
       for(QVector<size_t>::size_type i = 0; i < idxs.size(); ++i)
@@ -363,6 +400,39 @@ class NeighborList : public IDataArray
         if (idxs[i] >= arraySize) { return -100; }
       }
 
+      if(m_Packed)
+      {
+        // Slide the surviving lists down inside the value array and rebuild the offsets
+        std::vector<size_t> offsets;
+        offsets.reserve(arraySize - idxsSize + 1);
+        offsets.push_back(0);
+        size_t idxsIndex = 0;
+        size_t writePos = 0;
+        for(size_t dIdx = 0; dIdx < arraySize; ++dIdx)
+        {
+          if (dIdx != idxs[idxsIndex])
+          {
+            size_t nEle = m_Offsets[dIdx + 1] - m_Offsets[dIdx];
+            if(writePos != m_Offsets[dIdx])
+            {
+              std::copy(m_Values.begin() + m_Offsets[dIdx], m_Values.begin() + m_Offsets[dIdx + 1], m_Values.begin() + writePos);
+            }
+            writePos += nEle;
+            offsets.push_back(writePos);
+          }
+          else
+          {
+            ++idxsIndex;
+            if (idxsIndex == idxsSize ) { idxsIndex--;}
+          }
+        }
+        m_Values.resize(writePos);
+        m_Offsets.swap(offsets);
+        m_NumTuples = m_Offsets.size() - 1;
+        return err;
+      }
+
+      releaseStalePackedStorage();
       std::vector<SharedVectorType> replacement(arraySize - idxsSize);
 
       size_t idxsIndex = 0;
@@ -385,6 +455,119 @@ class NeighborList : public IDataArray
       return err;
     }
 
+    /**
+     * @brief Removes the lists flagged false in the keep map while keeping the order of the others.
+     * Packed lists are slid down inside the value array; promoted lists just move their shared vectors.
+     * @param keepMap One flag per list
+     * @return error code.
+     */
+    int compactTuples(const QVector<bool>& keepMap) override
+    {
+      size_t arraySize = getListCount();
+      if(static_cast<size_t>(keepMap.size()) != arraySize)
+      {
+        return -100;
+      }
+
+      if(m_Packed)
+      {
+        std::vector<size_t> offsets;
+        offsets.reserve(arraySize + 1);
+        offsets.push_back(0);
+        size_t writePos = 0;
+        for(size_t dIdx = 0; dIdx < arraySize; ++dIdx)
+        {
+          if(!keepMap[dIdx])
+          {
+            continue;
+          }
+          if(writePos != m_Offsets[dIdx])
+          {
+            std::copy(m_Values.begin() + m_Offsets[dIdx], m_Values.begin() + m_Offsets[dIdx + 1], m_Values.begin() + writePos);
+          }
+          writePos += m_Offsets[dIdx + 1] - m_Offsets[dIdx];
+          offsets.push_back(writePos);
+        }
+        m_Values.resize(writePos);
+        m_Offsets.swap(offsets);
+        m_NumTuples = m_Offsets.size() - 1;
+        return 0;
+      }
+
+      releaseStalePackedStorage();
+      size_t rIdx = 0;
+      for(size_t dIdx = 0; dIdx < arraySize; ++dIdx)
+      {
+        if(!keepMap[dIdx])
+        {
+          continue;
+        }
+        if(rIdx != dIdx)
+        {
+          m_Array[rIdx] = std::move(m_Array[dIdx]);
+        }
+        ++rIdx;
+      }
+      m_Array.resize(rIdx);
+      m_NumTuples = rIdx;
+      return 0;
+    }
+
+    /**
+     * @brief filterEntries Visits every entry of every list in list order and removes the entries
+     * for which 'func' returns false. 'func' is called as func(T& value, size_t entryIndex), may
+     * change the value it is given and receives the position of the entry counted over all lists
+     * before anything was removed. Both the packed and the promoted layouts are filtered in place.
+     * @param func
+     */
+    template <typename Func>
+    void filterEntries(Func func)
+    {
+      size_t entry = 0;
+      if(m_Packed)
+      {
+        size_t count = m_Offsets.size() - 1;
+        size_t writePos = 0;
+        size_t begin = m_Offsets[0];
+        for(size_t dIdx = 0; dIdx < count; ++dIdx)
+        {
+          size_t end = m_Offsets[dIdx + 1];
+          for(size_t v = begin; v < end; ++v, ++entry)
+          {
+            T value = m_Values[v];
+            if(func(value, entry))
+            {
+              m_Values[writePos++] = value;
+            }
+          }
+          begin = end;
+          m_Offsets[dIdx + 1] = writePos;
+        }
+        m_Values.resize(writePos);
+        return;
+      }
+
+      releaseStalePackedStorage();
+      for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+      {
+        if(nullptr == m_Array[dIdx].get())
+        {
+          continue;
+        }
+        VectorType& list = *(m_Array[dIdx]);
+        size_t writePos = 0;
+        for(size_t v = 0; v < list.size(); ++v, ++entry)
+        {
+          T value = list[v];
+          if(func(value, entry))
+          {
+            list[writePos++] = value;
+          }
+        }
+        list.resize(writePos);
+      }
+    }
+
     /**
      * @brief copyTuple
      * @param currentPos
@@ -393,6 +576,8 @@ class NeighborList : public IDataArray
      */
     int copyTuple(size_t currentPos, size_t newPos) override
     {
+      promote();
+      releaseStalePackedStorage();
       m_Array[newPos] = m_Array[currentPos];
       return 0;
     }
@@ -423,6 +608,8 @@ class NeighborList : public IDataArray
     bool copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override
     {
       if(!m_IsAllocated) { return false; }
+      promote();
+      releaseStalePackedStorage();
       if(destTupleOffset >= m_Array.size() ) { return false; }
       if(!sourceArray->isAllocated()) { return false; }
       Self* source = dynamic_cast<Self*>(sourceArray.get());
@@ -444,7 +631,8 @@ class NeighborList : public IDataArray
 
       for(size_t i = srcTupleOffset; i < srcTupleOffset + totalSrcTuples; i++)
       {
-        m_Array[destTupleOffset + i] = source->getList(i);
+        ConstListView view = source->getListView(static_cast<int>(i));
+        m_Array[destTupleOffset + i] = SharedVectorType(new VectorType(view.begin(), view.end()));
       }
       return true;
 
@@ -496,6 +684,10 @@ class NeighborList : public IDataArray
      */
     size_t getSize() override
     {
+      if(m_Packed)
+      {
+        return m_Values.size();
+      }
       size_t total = 0;
       for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
       {
@@ -549,6 +741,7 @@ class NeighborList : public IDataArray
      */
     void initializeWithZeros() override {
       m_Array.clear();
+      resetPackedStorage();
       m_IsAllocated = false;
     }
 
@@ -559,8 +752,19 @@ class NeighborList : public IDataArray
     IDataArray::Pointer deepCopy(bool forceNoAllocate = false) override
     {
       typename NeighborList<T>::Pointer daCopyPtr = NeighborList<T>::CreateArray(getNumberOfTuples(), getName(), m_IsAllocated);
+      daCopyPtr->setNumNeighborsArrayName(m_NumNeighborsArrayName);
+      daCopyPtr->setContainsObjectIds(m_ContainsObjectIds);
 
-      if(forceNoAllocate == false)
+      if(forceNoAllocate == false && m_Packed)
+      {
+        // The packed layout copies as two flat arrays
+        daCopyPtr->m_Array.clear();
+        daCopyPtr->m_Offsets = m_Offsets;
+        daCopyPtr->m_Values = m_Values;
+        daCopyPtr->m_Packed = true;
+        daCopyPtr->m_NumTuples = m_Offsets.size() - 1;
+      }
+      else if(forceNoAllocate == false)
       {
         size_t count = (m_IsAllocated ? getNumberOfTuples(): 0);
         for(size_t i = 0; i < count; i++)
@@ -580,6 +784,23 @@ class NeighborList : public IDataArray
     int32_t resizeTotalElements(size_t size) override
     {
       //std::cout << "NeighborList::resizeTotalElements(" << size << ")" << std::endl;
+      if(m_Packed)
+      {
+        // New lists are empty, so growing only repeats the last offset
+        if(size + 1 < m_Offsets.size())
+        {
+          m_Offsets.resize(size + 1);
+          m_Values.resize(m_Offsets.back());
+        }
+        else
+        {
+          m_Offsets.resize(size + 1, m_Offsets.back());
+        }
+        m_NumTuples = size;
+        m_IsAllocated = (size != 0);
+        return 1;
+      }
+      releaseStalePackedStorage();
       size_t old = m_Array.size();
       m_Array.resize(size);
       m_NumTuples = size;
@@ -603,6 +824,16 @@ class NeighborList : public IDataArray
     //FIXME: These need to be implemented
     void printTuple(QTextStream& out, size_t i, char delimiter = ',') override
     {
+      if(m_Packed)
+      {
+        size_t size = m_Offsets[i + 1] - m_Offsets[i];
+        out << size;
+        for(size_t j = m_Offsets[i]; j < m_Offsets[i + 1]; j++)
+        {
+          out << delimiter << m_Values[j];
+        }
+        return;
+      }
       SharedVectorType sharedVec = m_Array[i];
       VectorType* vec = sharedVec.get();
       size_t size = vec->size();
@@ -630,6 +861,19 @@ class NeighborList : public IDataArray
      * @return
      */
     int writeH5Data(hid_t parentId, QVector<size_t> tDims) override
+    {
+      return writeH5Data(parentId, tDims, H5DatasetCreationPolicy());
+    }
+
+    /**
+     * @brief writeH5Data Writes the flattened lists and the linked NumNeighbors array
+     * using the chunking/compression settings of the policy
+     * @param parentId
+     * @param tDims
+     * @param policy
+     * @return
+     */
+    int writeH5Data(hid_t parentId, QVector<size_t> tDims, const H5DatasetCreationPolicy& policy) override
     {
       int err = 0;
 
@@ -638,13 +882,15 @@ class NeighborList : public IDataArray
       // can compare this with what is written in the file. If they are
       // different we are going to overwrite what is in the file with what
       // we compute here.
-      Int32ArrayType::Pointer numNeighborsPtr = Int32ArrayType::CreateArray(m_Array.size(), m_NumNeighborsArrayName);
+      size_t numLists = getListCount();
+      Int32ArrayType::Pointer numNeighborsPtr = Int32ArrayType::CreateArray(numLists, m_NumNeighborsArrayName);
       int32_t* numNeighbors = numNeighborsPtr->getPointer(0);
       size_t total = 0;
-      for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+      for(size_t dIdx = 0; dIdx < numLists; ++dIdx)
       {
-        numNeighbors[dIdx] = static_cast<int32_t>(m_Array[dIdx]->size());
-        total += m_Array[dIdx]->size();
+        size_t nEle = (m_Packed ? m_Offsets[dIdx + 1] - m_Offsets[dIdx] : m_Array[dIdx]->size());
+        numNeighbors[dIdx] = static_cast<int32_t>(nEle);
+        total += nEle;
       }
 
       // Check to see if the NumNeighbors is already written to the file
@@ -652,13 +898,13 @@ class NeighborList : public IDataArray
       if (QH5Lite::datasetExists(parentId, m_NumNeighborsArrayName) == false)
       {
         // The NumNeighbors Array is NOT already in the file so write it to the file
-        numNeighborsPtr->writeH5Data(parentId, tDims);
+        numNeighborsPtr->writeH5Data(parentId, tDims, policy);
       }
       else
       {
         // The NumNeighbors array is in the dream3d file so read it up into memory and compare with what
         // we have in memory.
-        std::vector<int32_t> fileNumNeigh(m_Array.size());
+        std::vector<int32_t> fileNumNeigh(numLists);
         err = QH5Lite::readVectorDataset(parentId, m_NumNeighborsArrayName, fileNumNeigh);
         if (err < 0)
         {
@@ -683,24 +929,29 @@ class NeighborList : public IDataArray
       // the top of the function versus what is in memory
       if(rewrite == true)
       {
-        numNeighborsPtr->writeH5Data(parentId, tDims);
+        numNeighborsPtr->writeH5Data(parentId, tDims, policy);
       }
 
-      // Allocate an array of the proper size so we can concatenate all the arrays together into a single array that
-      // can be written to the HDF5 File. This operation can ballon the memory size temporarily until this operation
-      // is complete.
-      QVector<T> flat (total);
-      size_t currentStart = 0;
-      for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+      // The packed layout is already the on-disk layout and is written as is. Promoted lists have to
+      // be concatenated into a single array first, which can balloon the memory size temporarily
+      // until this operation is complete.
+      std::vector<T> flat;
+      T* flatPtr = m_Values.data();
+      if(!m_Packed)
       {
-        size_t nEle = m_Array[dIdx]->size();
-        if (nEle == 0) { continue; }
-        T* start = &(m_Array[dIdx]->front()); // get the pointer to the front of the array
-        //    T* end = start + nEle; // get the pointer to the end of the array
-        T* dst = &(flat.front()) + currentStart;
-        ::memcpy(dst, start, nEle * sizeof(T));
-
-        currentStart += m_Array[dIdx]->size();
+        flat.resize(total);
+        size_t currentStart = 0;
+        for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+        {
+          size_t nEle = m_Array[dIdx]->size();
+          if (nEle == 0) { continue; }
+          T* start = &(m_Array[dIdx]->front()); // get the pointer to the front of the array
+          T* dst = flat.data() + currentStart;
+          ::memcpy(dst, start, nEle * sizeof(T));
+
+          currentStart += nEle;
+        }
+        flatPtr = flat.data();
       }
 
       // Now we can actually write the actual array data.
@@ -708,7 +959,9 @@ class NeighborList : public IDataArray
       hsize_t dims[1] = { total };
       if (total > 0)
       {
-        err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, &(flat.front()));
+        hid_t dcpl = policy.createPropertyList(getName(), rank, dims, sizeof(T));
+        H5PropertyListAutoCloser dcplCloser(&dcpl);
+        err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, flatPtr, dcpl);
         if(err < 0)
         {
           return -605;
@@ -742,11 +995,18 @@ class NeighborList : public IDataArray
           return -610;
         }
 
-        err = QH5Lite::writeStringAttribute(parentId, getName(), "Linked NumNeighbors Dataset", m_NumNeighborsArrayName);
+        err = QH5Lite::writeStringAttribute(parentId, getName(), SIMPL::HDF5::LinkedNumNeighbors, m_NumNeighborsArrayName);
         if(err < 0)
         {
           return -608;
         }
+
+        int32_t containsObjectIds = (m_ContainsObjectIds ? 1 : 0);
+        err = QH5Lite::writeScalarAttribute(parentId, getName(), SIMPL::HDF5::ContainsObjectIds, containsObjectIds);
+        if(err < 0)
+        {
+          return -611;
+        }
       }
       return err;
     }
@@ -823,6 +1083,26 @@ class NeighborList : public IDataArray
       // of elements that would be needed to flatten the array
       std::vector<int32_t> numNeighbors;
 
+      // Restore the attributes written by writeH5Data(). Files written by older versions do
+      // not have the ContainsObjectIds flag, so the defaults are kept when one is missing.
+      hid_t did = H5Dopen(parentId, getName().toLatin1().constData(), H5P_DEFAULT);
+      if(did >= 0)
+      {
+        QString numNeighborsName;
+        if(QH5Lite::findAttribute(did, SIMPL::HDF5::LinkedNumNeighbors) == 1 &&
+           QH5Lite::readStringAttribute(parentId, getName(), SIMPL::HDF5::LinkedNumNeighbors, numNeighborsName) >= 0 && QH5Lite::datasetExists(parentId, numNeighborsName))
+        {
+          m_NumNeighborsArrayName = numNeighborsName;
+        }
+        int32_t containsObjectIds = 0;
+        if(QH5Lite::findAttribute(did, SIMPL::HDF5::ContainsObjectIds) == 1 &&
+           QH5Lite::readScalarAttribute(parentId, getName(), SIMPL::HDF5::ContainsObjectIds, containsObjectIds) >= 0)
+        {
+          m_ContainsObjectIds = (containsObjectIds != 0);
+        }
+        H5Dclose(did);
+      }
+
       // Check to see if the NumNeighbors exists in the file, which it must.
       if(QH5Lite::datasetExists(parentId, m_NumNeighborsArrayName) == true)
       {
@@ -838,36 +1118,32 @@ class NeighborList : public IDataArray
         return -703;
       }
 
+      // The flat dataset is read straight into the packed value array and the NumNeighbors
+      // counts become its offsets, so no per list allocations are made.
       std::vector<T> flat;
       err = QH5Lite::readVectorDataset(parentId, getName(), flat);
       if (err < 0)
       {
         return err;
       }
-      // Loop over all the entries and make new Vectors to hold the incoming data
-      m_Array.resize(numNeighbors.size());
-      m_IsAllocated = true;
-      size_t currentStart = 0;
-      qint32 count = static_cast<qint32>(numNeighbors.size());
-      for(QVector<int32_t>::size_type dIdx = 0; dIdx < count; ++dIdx)
+      std::vector<size_t> offsets(numNeighbors.size() + 1, 0);
+      for(size_t dIdx = 0; dIdx < numNeighbors.size(); ++dIdx)
       {
-        size_t nEle = numNeighbors[dIdx];
-        if(nEle > 0)
-        {
-          m_Array[dIdx] = SharedVectorType(new VectorType(numNeighbors[dIdx]));
-
-          T* dst = &(m_Array[dIdx]->front()); // get the pointer to the front of the array
-          //    T* end = start + nEle; // get the pointer to the end of the array
-          T* start = &(flat.front()) + currentStart;
-          ::memcpy(dst, start, nEle * sizeof(T));
-          currentStart += nEle;
-        }
-        else
-        {
-          m_Array[dIdx] = SharedVectorType(new VectorType(0));
-        }
+        size_t nEle = (numNeighbors[dIdx] > 0 ? static_cast<size_t>(numNeighbors[dIdx]) : 0);
+        offsets[dIdx + 1] = offsets[dIdx] + nEle;
+      }
+      if(offsets.back() > flat.size())
+      {
+        return -704;
       }
-      m_NumTuples = m_Array.size(); // Sync up the numTuples property with the size of the internal array
+      flat.resize(offsets.back());
+
+      m_Array.clear();
+      m_Offsets.swap(offsets);
+      m_Values.swap(flat);
+      m_Packed = true;
+      m_IsAllocated = true;
+      m_NumTuples = m_Offsets.size() - 1; // Sync up the numTuples property with the number of lists
       return err;
     }
 
@@ -878,6 +1154,8 @@ class NeighborList : public IDataArray
      */
     void addEntry(int grainId, T value)
     {
+      promote();
+      releaseStalePackedStorage();
       if(grainId >= static_cast<int>(m_Array.size()) )
       {
         size_t old = m_Array.size();
@@ -899,6 +1177,7 @@ class NeighborList : public IDataArray
     void clearAllLists()
     {
       m_Array.clear();
+      resetPackedStorage();
       m_IsAllocated = false;
     }
 
@@ -910,6 +1189,8 @@ class NeighborList : public IDataArray
      */
     void setList(int grainId, SharedVectorType neighborList)
     {
+      promote();
+      releaseStalePackedStorage();
       if(grainId >= static_cast<int>(m_Array.size()) )
       {
         size_t old = m_Array.size();
@@ -934,8 +1215,17 @@ class NeighborList : public IDataArray
     T getValue(int grainId, int index, bool& ok)
     {
 #ifndef NDEBUG
-      if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
+      if (getListCount() > 0u) { Q_ASSERT(grainId < static_cast<int>(getListCount()));}
 #endif
+      if(m_Packed)
+      {
+        if(index < 0 || static_cast<size_t>(index) >= m_Offsets[grainId + 1] - m_Offsets[grainId])
+        {
+          ok = false;
+          return -1;
+        }
+        return m_Values[m_Offsets[grainId] + index];
+      }
       SharedVectorType vec = m_Array[grainId];
       if(index < 0 || static_cast<size_t>(index) >= vec->size())
       {
@@ -951,7 +1241,7 @@ class NeighborList : public IDataArray
      */
     int getNumberOfLists()
     {
-      return static_cast<int>(m_Array.size());
+      return static_cast<int>(getListCount());
     }
 
     /**
@@ -962,29 +1252,40 @@ class NeighborList : public IDataArray
     int getListSize(int grainId)
     {
 #ifndef NDEBUG
-      if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
+      if (getListCount() > 0u) { Q_ASSERT(grainId < static_cast<int>(getListCount()));}
 #endif
+      if(m_Packed)
+      {
+        return static_cast<int>(m_Offsets[grainId + 1] - m_Offsets[grainId]);
+      }
       return static_cast<int>(m_Array[grainId]->size());
     }
 
+    /**
+     * @brief getListReference Promotes packed lists, use getListView() to only read.
+     * @param grainId
+     * @return
+     */
     VectorType& getListReference(int grainId)
     {
 #ifndef NDEBUG
-      if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
+      if (getListCount() > 0u) { Q_ASSERT(grainId < static_cast<int>(getListCount()));}
 #endif
+      promote();
       return *(m_Array[grainId]);
     }
 
     /**
-     * @brief getList
+     * @brief getList Promotes packed lists, use getListView() to only read.
      * @param grainId
      * @return
      */
     SharedVectorType getList(int grainId)
     {
 #ifndef NDEBUG
-      if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
+      if (getListCount() > 0u) { Q_ASSERT(grainId < static_cast<int>(getListCount()));}
 #endif
+      promote();
       return m_Array[grainId];
     }
 
@@ -996,38 +1297,99 @@ class NeighborList : public IDataArray
     VectorType copyOfList(int grainId)
     {
 #ifndef NDEBUG
-      if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
+      if (getListCount() > 0u) { Q_ASSERT(grainId < static_cast<int>(getListCount()));}
 #endif
+      if(m_Packed)
+      {
+        return VectorType(m_Values.begin() + m_Offsets[grainId], m_Values.begin() + m_Offsets[grainId + 1]);
+      }
 
       VectorType copy(*(m_Array[grainId]));
       return copy;
     }
 
     /**
-     * @brief operator []
+     * @brief getListView Returns a read-only view of a list. Unlike getList(), getListReference() and
+     * operator[] this does not promote packed lists, so it is the cheap choice for code that only reads.
+     * @param grainId
+     * @return
+     */
+    ConstListView getListView(int grainId)
+    {
+#ifndef NDEBUG
+      if (getListCount() > 0u) { Q_ASSERT(grainId < static_cast<int>(getListCount()));}
+#endif
+      if(m_Packed)
+      {
+        ConstListView view = {m_Values.data() + m_Offsets[grainId], m_Offsets[grainId + 1] - m_Offsets[grainId]};
+        return view;
+      }
+      ConstListView view = {m_Array[grainId]->data(), m_Array[grainId]->size()};
+      return view;
+    }
+
+    /**
+     * @brief operator [] Promotes packed lists, use getListView() to only read.
      * @param grainId
      * @return
      */
     VectorType& operator[](int grainId)
     {
 #ifndef NDEBUG
-      if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
+      if (getListCount() > 0u) { Q_ASSERT(grainId < static_cast<int>(getListCount()));}
 #endif
+      promote();
       return *(m_Array[grainId]);
     }
 
     /**
-     * @brief operator []
+     * @brief operator [] Promotes packed lists, use getListView() to only read.
      * @param grainId
      * @return
      */
     VectorType& operator[](size_t grainId)
     {
 #ifndef NDEBUG
-      if (m_Array.size() > 0ul) { Q_ASSERT(grainId < m_Array.size());}
+      if (getListCount() > 0ul) { Q_ASSERT(grainId < getListCount());}
 #endif
+      promote();
       return *(m_Array[grainId]);
+    }
 
+    /**
+     * @brief isPacked Returns true when the lists are held in the packed offsets/values layout
+     * @return
+     */
+    bool isPacked()
+    {
+      return m_Packed;
+    }
+
+    /**
+     * @brief pack Moves every list into the packed layout and releases the individual list
+     * vectors. Shared vectors and references handed out earlier are no longer connected to
+     * this NeighborList afterwards, so only call this once the lists have been fully built.
+     */
+    void pack()
+    {
+      if(m_Packed)
+      {
+        return;
+      }
+      std::vector<size_t> offsets(m_Array.size() + 1, 0);
+      for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+      {
+        offsets[dIdx + 1] = offsets[dIdx] + m_Array[dIdx]->size();
+      }
+      std::vector<T> values(offsets.back());
+      for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+      {
+        std::copy(m_Array[dIdx]->begin(), m_Array[dIdx]->end(), values.begin() + offsets[dIdx]);
+      }
+      std::vector<SharedVectorType>().swap(m_Array);
+      m_Offsets.swap(offsets);
+      m_Values.swap(values);
+      m_Packed = true;
     }
 
 
@@ -1037,18 +1399,83 @@ class NeighborList : public IDataArray
      */
     NeighborList(size_t numTuples, const QString name) :
       m_NumNeighborsArrayName(SIMPL::FeatureData::NumNeighbors),
+      m_ContainsObjectIds(false),
       m_Name(name),
       m_NumTuples(numTuples),
-      m_IsAllocated(false)
+      m_IsAllocated(false),
+      m_Packed(false)
     {    }
 
   private:
     std::vector<SharedVectorType> m_Array;
+    std::vector<size_t> m_Offsets;
+    std::vector<T> m_Values;
+    std::atomic<bool> m_Packed;
+    std::mutex m_PromoteMutex;
     QString m_Name;
     size_t m_NumTuples;
     bool m_IsAllocated;
     T m_InitValue;
 
+    /**
+     * @brief getListCount Returns the number of lists in whichever layout is active
+     * @return
+     */
+    size_t getListCount()
+    {
+      return (m_Packed ? m_Offsets.size() - 1 : m_Array.size());
+    }
+
+    /**
+     * @brief promote Copies the packed lists into individual shared vectors so they can be
+     * handed out by reference. The packed arrays are left untouched because another thread
+     * may still be reading them through getListView(), getValue() or copyOfList(); they are
+     * released by the next structural mutation through releaseStalePackedStorage().
+     */
+    void promote()
+    {
+      if(!m_Packed.load(std::memory_order_acquire))
+      {
+        return;
+      }
+      std::lock_guard<std::mutex> lock(m_PromoteMutex);
+      if(!m_Packed.load(std::memory_order_relaxed))
+      {
+        return;
+      }
+      size_t count = m_Offsets.size() - 1;
+      std::vector<SharedVectorType> lists(count);
+      for(size_t dIdx = 0; dIdx < count; ++dIdx)
+      {
+        lists[dIdx] = SharedVectorType(new VectorType(m_Values.begin() + m_Offsets[dIdx], m_Values.begin() + m_Offsets[dIdx + 1]));
+      }
+      m_Array.swap(lists);
+      m_Packed.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief releaseStalePackedStorage Frees the packed arrays left behind by promote(). Only
+     * called from structural mutators, which must not run concurrently with any reader.
+     */
+    void releaseStalePackedStorage()
+    {
+      if(!m_Packed && !m_Offsets.empty())
+      {
+        std::vector<size_t>().swap(m_Offsets);
+        std::vector<T>().swap(m_Values);
+      }
+    }
+
+    /**
+     * @brief resetPackedStorage Drops the packed arrays and returns to the empty promoted layout
+     */
+    void resetPackedStorage()
+    {
+      std::vector<size_t>().swap(m_Offsets);
+      std::vector<T>().swap(m_Values);
+      m_Packed = false;
+    }
+
 
     NeighborList(const NeighborList&); // Copy Constructor Not Implemented
     void operator=(const NeighborList&); // Move assignment Not Implemented
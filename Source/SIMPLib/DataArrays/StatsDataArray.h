@@ -321,6 +321,9 @@ class SIMPLib_EXPORT StatsDataArray : public IDataArray
      */
     void printComponent(QTextStream& out, size_t i, int j) override;
 
+    // Keep the policy aware overload from IDataArray visible. It falls back to the method below.
+    using IDataArray::writeH5Data;
+
     /**
      *
      * @param parentId
@@ -322,6 +322,9 @@ public:
    */
   QString getFullNameOfClass();
 
+  // Keep the policy aware overload from IDataArray visible. It falls back to the method below.
+  using IDataArray::writeH5Data;
+
   /**
    *
    * @param parentId
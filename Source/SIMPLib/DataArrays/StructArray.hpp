@@ -656,6 +656,9 @@ class StructArray : public IDataArray
     }
 
 
+    // Keep the policy aware overload from IDataArray visible. It falls back to the method below.
+    using IDataArray::writeH5Data;
+
     /**
      *
      * @param parentId
@@ -35,7 +35,9 @@
 
 #include <stdlib.h>
 
+#include <atomic>
 #include <iostream>
+#include <thread>
 #include <vector>
 
 #include <QtCore/QDir>
@@ -43,11 +45,16 @@
 #include <QtCore/QString>
 #include <QtCore/QVector>
 
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/SIMPLib.h"
 
@@ -626,6 +633,139 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> void TestNeighborListPackedForType()
+  {
+    typename NeighborList<T>::Pointer n = NeighborList<T>::CreateArray(5, "NeighborList");
+    for(int i = 0; i < 5; ++i)
+    {
+      for(T j = 0; j < (T)(i + 1); ++j)
+      {
+        n->addEntry(i, static_cast<T>(j + i));
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(n->isPacked(), false)
+    n->pack();
+    DREAM3D_REQUIRE_EQUAL(n->isPacked(), true)
+    DREAM3D_REQUIRE_EQUAL(n->getSize(), static_cast<size_t>(15))
+
+    // Erase while packed and check the remaining lists slid down
+    QVector<size_t> eraseElements;
+    eraseElements.push_back(1);
+    eraseElements.push_back(3);
+    n->eraseTuples(eraseElements);
+    DREAM3D_REQUIRE_EQUAL(n->isPacked(), true)
+    DREAM3D_REQUIRE_EQUAL(n->getNumberOfLists(), 3)
+    int expected[3] = {0, 2, 4};
+    for(int i = 0; i < 3; ++i)
+    {
+      DREAM3D_REQUIRE_EQUAL(n->getListSize(i), expected[i] + 1)
+      for(int j = 0; j < expected[i] + 1; ++j)
+      {
+        bool ok = true;
+        DREAM3D_REQUIRE_EQUAL(n->getValue(i, j, ok), static_cast<T>(j + expected[i]))
+      }
+    }
+
+    // Read-only views work on the packed layout without promoting it
+    for(int i = 0; i < 3; ++i)
+    {
+      typename NeighborList<T>::ConstListView view = n->getListView(i);
+      DREAM3D_REQUIRE_EQUAL(view.size, static_cast<size_t>(expected[i] + 1))
+      DREAM3D_REQUIRE_EQUAL(view[0], static_cast<T>(expected[i]))
+      DREAM3D_REQUIRE_EQUAL(*(view.end() - 1), static_cast<T>(2 * expected[i]))
+    }
+    DREAM3D_REQUIRE_EQUAL(n->isPacked(), true)
+
+    // A packed deep copy must not share storage with the original once promoted
+    typename NeighborList<T>::Pointer copy = std::dynamic_pointer_cast<NeighborList<T>>(n->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(copy->isPacked(), true)
+
+    // Mutating through a reference promotes the lists to individual vectors
+    (*n)[2][0] = static_cast<T>(99);
+    n->addEntry(0, static_cast<T>(7));
+    DREAM3D_REQUIRE_EQUAL(n->isPacked(), false)
+    DREAM3D_REQUIRE_EQUAL(n->getListSize(0), 2)
+    bool ok = true;
+    DREAM3D_REQUIRE_EQUAL(n->getValue(2, 0, ok), static_cast<T>(99))
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(2, 0, ok), static_cast<T>(4))
+    DREAM3D_REQUIRE_EQUAL(copy->getListSize(0), 1)
+    DREAM3D_REQUIRE_EQUAL(n->getListView(0).size, static_cast<size_t>(2))
+    DREAM3D_REQUIRE_EQUAL(n->getListView(2)[0], static_cast<T>(99))
+
+    // Growing a packed list adds empty lists
+    copy->resize(6);
+    DREAM3D_REQUIRE_EQUAL(copy->isPacked(), true)
+    DREAM3D_REQUIRE_EQUAL(copy->getListSize(5), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> void TestNeighborListConcurrentPromoteForType()
+  {
+    const int numLists = 2000;
+    typename NeighborList<T>::Pointer n = NeighborList<T>::CreateArray(numLists, "NeighborList");
+    for(int i = 0; i < numLists; ++i)
+    {
+      for(int j = 0; j < (i % 7) + 1; ++j)
+      {
+        n->addEntry(i, static_cast<T>(i + j));
+      }
+    }
+    n->pack();
+    DREAM3D_REQUIRE_EQUAL(n->isPacked(), true)
+
+    // Readers walk the lists through the non-promoting accessors while another thread
+    // promotes through operator[]. The packed arrays must stay valid for the readers.
+    std::atomic<int> mismatches(0);
+    std::atomic<bool> promoted(false);
+    auto reader = [&]() {
+      for(int pass = 0; pass < 20 || !promoted; ++pass)
+      {
+        for(int i = 0; i < numLists; ++i)
+        {
+          typename NeighborList<T>::ConstListView view = n->getListView(i);
+          bool ok = true;
+          if(view.size != static_cast<size_t>((i % 7) + 1) || view[0] != static_cast<T>(i) || n->getValue(i, 0, ok) != static_cast<T>(i) ||
+             n->copyOfList(i).size() != view.size)
+          {
+            mismatches++;
+          }
+        }
+      }
+    };
+    std::vector<std::thread> threads;
+    for(int t = 0; t < 3; ++t)
+    {
+      threads.push_back(std::thread(reader));
+    }
+    std::thread promoter([&]() {
+      for(int i = 0; i < numLists; ++i)
+      {
+        if((*n)[i].size() != static_cast<size_t>((i % 7) + 1))
+        {
+          mismatches++;
+        }
+      }
+      promoted = true;
+    });
+    promoter.join();
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+    DREAM3D_REQUIRE_EQUAL(mismatches.load(), 0)
+    DREAM3D_REQUIRE_EQUAL(n->isPacked(), false)
+
+    // The next structural mutation releases the packed arrays and keeps the promoted lists
+    n->addEntry(0, static_cast<T>(5));
+    DREAM3D_REQUIRE_EQUAL(n->getListSize(0), 2)
+    DREAM3D_REQUIRE_EQUAL(n->getListView(numLists - 1).size, static_cast<size_t>(((numLists - 1) % 7) + 1))
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -643,6 +783,12 @@ public:
     TestNeighborListForType<double>();
 
     TestNeighborListDeepCopyForType<int8_t>();
+
+    TestNeighborListPackedForType<int32_t>();
+    TestNeighborListPackedForType<float>();
+
+    TestNeighborListConcurrentPromoteForType<int32_t>();
+    TestNeighborListConcurrentPromoteForType<float>();
   }
 
   // -----------------------------------------------------------------------------
@@ -1154,6 +1300,562 @@ public:
     DREAM3D_REQUIRE_EQUAL(comp, 0);
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPartialH5Read()
+  {
+    // 6 x 5 x 4 volume with 2 components. Each value encodes its own X, Y, Z and component
+    QVector<size_t> tDims = {6, 5, 4};
+    QVector<size_t> cDims(1, 2);
+    Int32ArrayType::Pointer volume = Int32ArrayType::CreateArray(tDims, cDims, "Volume", true);
+    for(size_t z = 0; z < tDims[2]; z++)
+    {
+      for(size_t y = 0; y < tDims[1]; y++)
+      {
+        for(size_t x = 0; x < tDims[0]; x++)
+        {
+          size_t tuple = (z * tDims[1] + y) * tDims[0] + x;
+          volume->setComponent(tuple, 0, static_cast<int32_t>(x + 10 * y + 100 * z));
+          volume->setComponent(tuple, 1, -static_cast<int32_t>(tuple));
+        }
+      }
+    }
+
+    hid_t fileId = QH5Utilities::createFile(UnitTest::DataArrayTest::TestFile);
+    DREAM3D_REQUIRE(fileId > 0)
+    H5ScopedFileSentinel sentinel(&fileId, false);
+    int err = volume->writeH5Data(fileId, tDims);
+    DREAM3D_REQUIRE(err >= 0)
+
+    // A tuple range that does not start or end on a row boundary
+    Int32ArrayType::Pointer range = Int32ArrayType::CreateArray(0, cDims, "Volume", false);
+    err = range->readH5DataTuples(fileId, 7, 41);
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE_EQUAL(range->getNumberOfTuples(), 41)
+    DREAM3D_REQUIRE_EQUAL(range->getNumberOfComponents(), 2)
+    for(size_t i = 0; i < range->getNumberOfTuples(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(range->getComponent(i, 0), volume->getComponent(i + 7, 0))
+      DREAM3D_REQUIRE_EQUAL(range->getComponent(i, 1), volume->getComponent(i + 7, 1))
+    }
+
+    // Reading past the end of the array is an error
+    err = range->readH5DataTuples(fileId, 100, 50);
+    DREAM3D_REQUIRE(err < 0)
+
+    // A block from the middle of the volume
+    QVector<size_t> offset = {1, 2, 1};
+    QVector<size_t> count = {3, 2, 2};
+    Int32ArrayType::Pointer block = Int32ArrayType::CreateArray(0, cDims, "Volume", false);
+    err = block->readH5DataSubVolume(fileId, offset, count);
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE_EQUAL(block->getNumberOfTuples(), 12)
+    size_t index = 0;
+    for(size_t z = 0; z < count[2]; z++)
+    {
+      for(size_t y = 0; y < count[1]; y++)
+      {
+        for(size_t x = 0; x < count[0]; x++)
+        {
+          int32_t expected = static_cast<int32_t>((x + offset[0]) + 10 * (y + offset[1]) + 100 * (z + offset[2]));
+          DREAM3D_REQUIRE_EQUAL(block->getComponent(index, 0), expected)
+          index++;
+        }
+      }
+    }
+
+    // The generic in memory crop must give the same answer
+    Int32ArrayType::Pointer cropped = std::dynamic_pointer_cast<Int32ArrayType>(volume->deepCopy());
+    err = cropped->cropTuples(tDims, offset, count);
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE_EQUAL(cropped->getNumberOfTuples(), block->getNumberOfTuples())
+    for(size_t i = 0; i < cropped->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(cropped->getValue(i), block->getValue(i))
+    }
+
+    // A block that does not fit inside the volume
+    count[0] = 6;
+    err = block->readH5DataSubVolume(fileId, offset, count);
+    DREAM3D_REQUIRE(err < 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLazyH5Read()
+  {
+    QVector<size_t> cDims(1, 3);
+    size_t numTuples = 25;
+    Int32ArrayType::Pointer source = Int32ArrayType::CreateArray(numTuples, cDims, "LazyArray", true);
+    for(size_t i = 0; i < source->getSize(); i++)
+    {
+      source->setValue(i, static_cast<int32_t>(i * 3 + 1));
+    }
+    {
+      hid_t fileId = QH5Utilities::createFile(UnitTest::DataArrayTest::TestFile);
+      DREAM3D_REQUIRE(fileId > 0)
+      H5ScopedFileSentinel sentinel(&fileId, false);
+      int err = source->writeH5Data(fileId, QVector<size_t>(1, numTuples));
+      DREAM3D_REQUIRE(err >= 0)
+    }
+
+    H5LazyFileHandle::Pointer file = H5LazyFileHandle::Open(UnitTest::DataArrayTest::TestFile);
+    DREAM3D_REQUIRE_VALID_POINTER(file.get())
+
+    Int32ArrayType::Pointer lazy = Int32ArrayType::CreateArray(numTuples, cDims, "LazyArray", false);
+    DREAM3D_REQUIRE_EQUAL(lazy->setLazyDataSource(H5LazyDataSource::New(file, "/", "LazyArray")), true)
+    DREAM3D_REQUIRE_EQUAL(lazy->isAllocated(), true)
+    DREAM3D_REQUIRE_EQUAL(lazy->isDataLoaded(), false)
+    DREAM3D_REQUIRE_EQUAL(lazy->getSize(), source->getSize())
+
+    // The first access reads the values
+    int32_t* ptr = lazy->getPointer(0);
+    DREAM3D_REQUIRE_VALID_POINTER(ptr)
+    DREAM3D_REQUIRE_EQUAL(lazy->isDataLoaded(), true)
+    for(size_t i = 0; i < lazy->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(ptr[i], source->getValue(i))
+    }
+
+    // Evicting throws away the in memory changes and the next access reads the file again
+    lazy->setValue(0, -1);
+    DREAM3D_REQUIRE_EQUAL(lazy->evictData(), true)
+    DREAM3D_REQUIRE_EQUAL(lazy->isDataLoaded(), false)
+    DREAM3D_REQUIRE_EQUAL(lazy->loadData(), true)
+    DREAM3D_REQUIRE_EQUAL(lazy->isDataLoaded(), true)
+    DREAM3D_REQUIRE_EQUAL(lazy->getValue(0), source->getValue(0))
+
+    // Deep copies and resizes see the values from the file
+    lazy->evictData();
+    IDataArray::Pointer copy = lazy->deepCopy();
+    DREAM3D_REQUIRE_EQUAL(copy->isDataLoaded(), true)
+    DREAM3D_REQUIRE_EQUAL(std::dynamic_pointer_cast<Int32ArrayType>(copy)->getValue(5), source->getValue(5))
+    lazy->evictData();
+    lazy->resize(numTuples * 2);
+    DREAM3D_REQUIRE_EQUAL(lazy->getValue(source->getSize() - 1), source->getValue(source->getSize() - 1))
+    DREAM3D_REQUIRE_EQUAL(lazy->evictData(), false)
+
+    // Erasing every tuple drops the pending read instead of performing it
+    lazy = Int32ArrayType::CreateArray(numTuples, cDims, "LazyArray", false);
+    lazy->setLazyDataSource(H5LazyDataSource::New(file, "/", "LazyArray"));
+    QVector<size_t> allTuples;
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      allTuples.push_back(i);
+    }
+    DREAM3D_REQUIRE_EQUAL(lazy->eraseTuples(allTuples), 0)
+    DREAM3D_REQUIRE_EQUAL(lazy->getNumberOfTuples(), static_cast<size_t>(0))
+    DREAM3D_REQUIRE_EQUAL(lazy->evictData(), false)
+
+    // The element accessors read the values on their own
+    lazy = Int32ArrayType::CreateArray(numTuples, cDims, "LazyArray", false);
+    lazy->setLazyDataSource(H5LazyDataSource::New(file, "/", "LazyArray"));
+    DREAM3D_REQUIRE_EQUAL(lazy->getComponent(2, 1), source->getComponent(2, 1))
+    DREAM3D_REQUIRE_EQUAL(lazy->isDataLoaded(), true)
+
+    // A failed read leaves the array empty and is reported by loadData()
+    Int32ArrayType::Pointer missing = Int32ArrayType::CreateArray(numTuples, cDims, "MissingArray", false);
+    DREAM3D_REQUIRE_EQUAL(missing->setLazyDataSource(H5LazyDataSource::New(file, "/", "MissingArray")), true)
+    DREAM3D_REQUIRE_EQUAL(missing->loadData(), false)
+    DREAM3D_REQUIRE_EQUAL(missing->isAllocated(), false)
+    DREAM3D_REQUIRE_EQUAL(missing->getNumberOfTuples(), static_cast<size_t>(0))
+    DREAM3D_REQUIRE(nullptr == missing->getPointer(0))
+
+    // Without the explicit loadData() the accessors see the same empty array
+    missing = Int32ArrayType::CreateArray(numTuples, cDims, "MissingArray", false);
+    missing->setLazyDataSource(H5LazyDataSource::New(file, "/", "MissingArray"));
+    DREAM3D_REQUIRE_EQUAL(missing->getValue(0), 0)
+    missing->setComponent(0, 0, 5);
+    DREAM3D_REQUIRE_EQUAL(missing->getSize(), static_cast<size_t>(0))
+
+    // An array without a lazy source can not be evicted
+    DREAM3D_REQUIRE_EQUAL(source->evictData(), false)
+    DREAM3D_REQUIRE_EQUAL(source->loadData(), true)
+    DREAM3D_REQUIRE_EQUAL(source->setLazyDataSource(H5LazyDataSource::NullPointer()), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMappedFileStorage()
+  {
+    QVector<size_t> cDims(1, 2);
+    size_t numTuples = 10000;
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(numTuples, cDims, "MappedArray", false);
+    array->setStorageType(DataArrayStorage::Type::MappedFile);
+    DREAM3D_REQUIRE(array->allocate() > 0)
+    DREAM3D_REQUIRE_EQUAL(array->isStoredInMappedFile(), true)
+    for(size_t i = 0; i < array->getSize(); i++)
+    {
+      array->setValue(i, static_cast<float>(i));
+    }
+
+    // Growing and shrinking keep the existing values
+    array->resize(numTuples * 3);
+    DREAM3D_REQUIRE_EQUAL(array->isStoredInMappedFile(), true)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(numTuples * 2 - 1), static_cast<float>(numTuples * 2 - 1))
+    DREAM3D_REQUIRE_EQUAL(array->getValue(numTuples * 2), 0.0f)
+    array->resize(numTuples / 2);
+    DREAM3D_REQUIRE_EQUAL(array->getValue(numTuples - 1), static_cast<float>(numTuples - 1))
+
+    // A failed resize leaves the mapping and its contents as they were
+    MappedFileBuffer::Pointer buffer = MappedFileBuffer::Create(4096);
+    DREAM3D_REQUIRE_VALID_POINTER(buffer.get())
+    static_cast<char*>(buffer->getPointer())[4095] = 7;
+    DREAM3D_REQUIRE_EQUAL(buffer->resize(0), false)
+    DREAM3D_REQUIRE_EQUAL(buffer->getErrorString().isEmpty(), false)
+    DREAM3D_REQUIRE_EQUAL(buffer->getSize(), static_cast<size_t>(4096))
+    DREAM3D_REQUIRE_EQUAL(static_cast<char*>(buffer->getPointer())[4095], 7)
+    DREAM3D_REQUIRE_EQUAL(buffer->resize(8192), true)
+    DREAM3D_REQUIRE_EQUAL(static_cast<char*>(buffer->getPointer())[4095], 7)
+    DREAM3D_REQUIRE_EQUAL(buffer->resize(4096), true)
+    DREAM3D_REQUIRE_EQUAL(static_cast<char*>(buffer->getPointer())[4095], 7)
+
+    QVector<size_t> idxs = {0, 2};
+    DREAM3D_REQUIRE_EQUAL(array->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(array->isStoredInMappedFile(), true)
+    DREAM3D_REQUIRE_EQUAL(array->getComponent(0, 0), 2.0f)
+    DREAM3D_REQUIRE_EQUAL(array->getComponent(1, 0), 6.0f)
+
+    FloatArrayType::Pointer copy = std::dynamic_pointer_cast<FloatArrayType>(array->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(copy->isStoredInMappedFile(), true)
+    DREAM3D_REQUIRE_EQUAL(copy->getComponent(1, 1), 7.0f)
+
+    // Switching the storage moves the values
+    DREAM3D_REQUIRE_EQUAL(array->setStorageType(DataArrayStorage::Type::Heap), true)
+    DREAM3D_REQUIRE_EQUAL(array->isStoredInMappedFile(), false)
+    DREAM3D_REQUIRE_EQUAL(array->getComponent(1, 0), 6.0f)
+
+    // Automatic arrays use a scratch file once they reach the global threshold
+    DataArrayStorage::SetMappedFileThreshold(1024);
+    FloatArrayType::Pointer small = FloatArrayType::CreateArray(16, cDims, "Small", true);
+    DREAM3D_REQUIRE_EQUAL(small->isStoredInMappedFile(), false)
+    small->resize(numTuples);
+    DREAM3D_REQUIRE_EQUAL(small->isStoredInMappedFile(), true)
+    FloatArrayType::Pointer large = FloatArrayType::CreateArray(numTuples, cDims, "Large", true);
+    DREAM3D_REQUIRE_EQUAL(large->isStoredInMappedFile(), true)
+    DataArrayStorage::SetMappedFileThreshold(0);
+
+    // Handing the memory to the caller moves it to the heap first
+    large->setValue(3, 42.0f);
+    large->releaseOwnership();
+    DREAM3D_REQUIRE_EQUAL(large->isStoredInMappedFile(), false)
+    float* released = large->getPointer(0);
+    DREAM3D_REQUIRE_EQUAL(released[3], 42.0f)
+    large = FloatArrayType::NullPointer();
+    free(released);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRemoveInactiveObjectsForLayout(bool packed)
+  {
+    QVector<size_t> tDims(1, 6);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellFeatureData", AttributeMatrix::Type::CellFeature);
+
+    FloatArrayType::Pointer values = FloatArrayType::CreateArray(6, QVector<size_t>(1, 2), "Values", true);
+    for(size_t i = 0; i < 6; i++)
+    {
+      values->setComponent(i, 0, static_cast<float>(i * 10));
+      values->setComponent(i, 1, static_cast<float>(i * 10 + 1));
+    }
+    am->addAttributeArray(values->getName(), values);
+
+    QVector<std::vector<int32_t>> neighbors = {{}, {2, 3}, {1, 3, 4}, {1, 2, 5}, {2, 5}, {3, 4}};
+    Int32NeighborListType::Pointer neighborList = Int32NeighborListType::CreateArray(6, SIMPL::FeatureData::NeighborList, true);
+    FloatNeighborListType::Pointer areaList = FloatNeighborListType::CreateArray(6, SIMPL::FeatureData::SharedSurfaceAreaList, true);
+    Int32ArrayType::Pointer numNeighbors = Int32ArrayType::CreateArray(6, SIMPL::FeatureData::NumNeighbors, true);
+    for(int32_t i = 0; i < 6; i++)
+    {
+      Int32NeighborListType::SharedVectorType ids(new std::vector<int32_t>(neighbors[i]));
+      FloatNeighborListType::SharedVectorType areas(new std::vector<float>);
+      for(int32_t neighbor : neighbors[i])
+      {
+        areas->push_back(static_cast<float>(100 * i + neighbor));
+      }
+      neighborList->setList(i, ids);
+      areaList->setList(i, areas);
+      numNeighbors->setValue(i, static_cast<int32_t>(neighbors[i].size()));
+    }
+    if(packed)
+    {
+      neighborList->pack();
+      areaList->pack();
+    }
+    am->addAttributeArray(neighborList->getName(), neighborList);
+    am->addAttributeArray(areaList->getName(), areaList);
+    am->addAttributeArray(numNeighbors->getName(), numNeighbors);
+
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(8, SIMPL::CellData::FeatureIds, true);
+    int32_t ids[8] = {0, 1, 2, 3, 4, 5, 5, 4};
+    for(size_t i = 0; i < 8; i++)
+    {
+      featureIds->setValue(i, ids[i]);
+    }
+
+    QVector<bool> activeObjects = {true, true, false, true, false, true};
+    DREAM3D_REQUIRE_EQUAL(am->removeInactiveObjects(activeObjects, featureIds.get()), true)
+    DREAM3D_REQUIRE_EQUAL(am->getNumberOfTuples(), static_cast<size_t>(4))
+
+    // Old objects 0, 1, 3 and 5 remain as 0, 1, 2 and 3
+    size_t kept[4] = {0, 1, 3, 5};
+    DREAM3D_REQUIRE_EQUAL(values->getNumberOfTuples(), static_cast<size_t>(4))
+    for(size_t i = 0; i < 4; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(values->getComponent(i, 0), static_cast<float>(kept[i] * 10))
+      DREAM3D_REQUIRE_EQUAL(values->getComponent(i, 1), static_cast<float>(kept[i] * 10 + 1))
+    }
+
+    // The NeighborLists are kept, renumbered and stripped of the removed objects
+    DREAM3D_REQUIRE(am->doesAttributeArrayExist(SIMPL::FeatureData::NeighborList))
+    DREAM3D_REQUIRE(am->doesAttributeArrayExist(SIMPL::FeatureData::SharedSurfaceAreaList))
+    QVector<std::vector<int32_t>> expectedNeighbors = {{}, {2}, {1, 3}, {2}};
+    QVector<std::vector<float>> expectedAreas = {{}, {103.0f}, {301.0f, 305.0f}, {503.0f}};
+    DREAM3D_REQUIRE_EQUAL(neighborList->getNumberOfTuples(), static_cast<size_t>(4))
+    DREAM3D_REQUIRE_EQUAL(areaList->getNumberOfTuples(), static_cast<size_t>(4))
+    for(int32_t i = 0; i < 4; i++)
+    {
+      DREAM3D_REQUIRE(neighborList->copyOfList(i) == expectedNeighbors[i])
+      DREAM3D_REQUIRE(areaList->copyOfList(i) == expectedAreas[i])
+      DREAM3D_REQUIRE_EQUAL(numNeighbors->getValue(i), static_cast<int32_t>(expectedNeighbors[i].size()))
+    }
+
+    int32_t expectedIds[8] = {0, 1, 0, 2, 0, 3, 3, 0};
+    for(size_t i = 0; i < 8; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(featureIds->getValue(i), expectedIds[i])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRemoveInactiveObjectsPairing()
+  {
+    QVector<size_t> tDims(1, 4);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellFeatureData", AttributeMatrix::Type::CellFeature);
+
+    // An id list under a custom name is recognized by its flag, and an int32 list of values paired
+    // with it keeps its values instead of being renumbered
+    QVector<std::vector<int32_t>> neighbors = {{}, {2, 3}, {1, 3}, {1, 2}};
+    Int32NeighborListType::Pointer idList = Int32NeighborListType::CreateArray(4, "Contacts", true);
+    idList->setContainsObjectIds(true);
+    idList->setNumNeighborsArrayName("NumContacts");
+    Int32NeighborListType::Pointer countList = Int32NeighborListType::CreateArray(4, "ContactCounts", true);
+    countList->setNumNeighborsArrayName("NumContacts");
+    for(int32_t i = 0; i < 4; i++)
+    {
+      Int32NeighborListType::SharedVectorType ids(new std::vector<int32_t>(neighbors[i]));
+      Int32NeighborListType::SharedVectorType counts(new std::vector<int32_t>);
+      for(int32_t neighbor : neighbors[i])
+      {
+        counts->push_back(100 * i + neighbor);
+      }
+      idList->setList(i, ids);
+      countList->setList(i, counts);
+    }
+    am->addAttributeArray(idList->getName(), idList);
+    am->addAttributeArray(countList->getName(), countList);
+
+    QVector<bool> activeObjects = {true, true, false, true};
+    QString errorMessage;
+    DREAM3D_REQUIRE_EQUAL(am->removeInactiveObjects(activeObjects, nullptr, &errorMessage), true)
+    DREAM3D_REQUIRE(errorMessage.isEmpty())
+    QVector<std::vector<int32_t>> expectedIds = {{}, {2}, {1}};
+    QVector<std::vector<int32_t>> expectedCounts = {{}, {103}, {301}};
+    for(int32_t i = 0; i < 3; i++)
+    {
+      DREAM3D_REQUIRE(idList->copyOfList(i) == expectedIds[i])
+      DREAM3D_REQUIRE(countList->copyOfList(i) == expectedCounts[i])
+    }
+
+    // The flag and the NumNeighbors link survive a round trip through HDF5
+    {
+      hid_t fileId = QH5Utilities::createFile(UnitTest::DataArrayTest::TestFile);
+      DREAM3D_REQUIRE(fileId > 0)
+      H5ScopedFileSentinel sentinel(&fileId, false);
+      DREAM3D_REQUIRE(idList->writeH5Data(fileId, QVector<size_t>(1, 3)) >= 0)
+      Int32NeighborListType::Pointer readList = std::dynamic_pointer_cast<Int32NeighborListType>(H5DataArrayReader::ReadNeighborListData(fileId, idList->getName()));
+      DREAM3D_REQUIRE_VALID_POINTER(readList.get())
+      DREAM3D_REQUIRE_EQUAL(readList->getContainsObjectIds(), true)
+      DREAM3D_REQUIRE(readList->getNumNeighborsArrayName() == "NumContacts")
+      DREAM3D_REQUIRE(readList->copyOfList(2) == expectedIds[2])
+    }
+
+    // A list that cannot be paired with an id list is removed and reported, the others are still compacted
+    FloatNeighborListType::Pointer orphan = FloatNeighborListType::CreateArray(3, "Orphan", true);
+    orphan->setNumNeighborsArrayName("NumOrphans");
+    am->addAttributeArray(orphan->getName(), orphan);
+    activeObjects = {true, false, true};
+    DREAM3D_REQUIRE_EQUAL(am->removeInactiveObjects(activeObjects, nullptr, &errorMessage), true)
+    DREAM3D_REQUIRE(errorMessage.contains("Orphan"))
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("Orphan"), false)
+    DREAM3D_REQUIRE_EQUAL(am->getNumberOfTuples(), static_cast<size_t>(2))
+    DREAM3D_REQUIRE(idList->copyOfList(1).empty())
+    DREAM3D_REQUIRE(countList->copyOfList(1).empty())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRemoveInactiveObjects()
+  {
+    TestRemoveInactiveObjectsForLayout(false);
+    TestRemoveInactiveObjectsForLayout(true);
+    TestRemoveInactiveObjectsPairing();
+
+    // Arrays that wrap memory they do not own are compacted into a new buffer
+    int32_t* raw = static_cast<int32_t*>(malloc(5 * sizeof(int32_t)));
+    for(int32_t i = 0; i < 5; i++)
+    {
+      raw[i] = i;
+    }
+    Int32ArrayType::Pointer wrapped = Int32ArrayType::WrapPointer(raw, 5, QVector<size_t>(1, 1), "Wrapped", false);
+    QVector<bool> keepMap = {true, false, true, false, true};
+    DREAM3D_REQUIRE_EQUAL(wrapped->compactTuples(keepMap), 0)
+    DREAM3D_REQUIRE_EQUAL(wrapped->getNumberOfTuples(), static_cast<size_t>(3))
+    DREAM3D_REQUIRE_EQUAL(wrapped->getValue(1), 2)
+    DREAM3D_REQUIRE_EQUAL(wrapped->getValue(2), 4)
+    DREAM3D_REQUIRE_EQUAL(raw[1], 1)
+    wrapped = Int32ArrayType::NullPointer();
+    free(raw);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCopyOnWrite()
+  {
+    DataArrayStorage::SetCopyOnWrite(true);
+    QVector<size_t> cDims(1, 3);
+    Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(100, cDims, "Source", true);
+    for(size_t i = 0; i < array->getSize(); i++)
+    {
+      array->setValue(i, static_cast<int32_t>(i));
+    }
+
+    // The copy shares the values until it is written to
+    Int32ArrayType::Pointer copy = std::dynamic_pointer_cast<Int32ArrayType>(array->deepCopy());
+    DREAM3D_REQUIRE_VALID_POINTER(copy.get())
+    DREAM3D_REQUIRE_EQUAL(copy->isStorageShared(), true)
+    DREAM3D_REQUIRE_EQUAL(array->isStorageShared(), true)
+    DREAM3D_REQUIRE(copy->getConstPointer(0) == array->getConstPointer(0))
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(299), 299)
+    DREAM3D_REQUIRE_EQUAL(copy->isStorageShared(), true)
+
+    // Writing an element gives the copy its own values
+    copy->setValue(5, -1);
+    DREAM3D_REQUIRE_EQUAL(copy->isStorageShared(), false)
+    DREAM3D_REQUIRE(copy->getConstPointer(0) != array->getConstPointer(0))
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(5), -1)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(6), 6)
+    DREAM3D_REQUIRE_EQUAL(array->getValue(5), 5)
+
+    // The last array using the values takes the memory back instead of copying it
+    const int32_t* shared = array->getConstPointer(0);
+    DREAM3D_REQUIRE_EQUAL(array->isStorageShared(), true)
+    array->getPointer(0)[0] = 7;
+    DREAM3D_REQUIRE_EQUAL(array->isStorageShared(), false)
+    DREAM3D_REQUIRE(array->getConstPointer(0) == shared)
+
+    // The pointer handed out above may still be written through, so the next copy is made right away
+    Int32ArrayType::Pointer eagerCopy = std::dynamic_pointer_cast<Int32ArrayType>(array->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(eagerCopy->isStorageShared(), false)
+    array->getPointer(0)[1] = 8;
+    DREAM3D_REQUIRE_EQUAL(eagerCopy->getValue(1), 1)
+    array->getPointer(0)[1] = 1;
+
+    // Copies of copies share the same values and releasing one keeps the others valid
+    DataArrayStorage::ReleaseWritablePointers();
+    Int32ArrayType::Pointer copy2 = std::dynamic_pointer_cast<Int32ArrayType>(array->deepCopy());
+    Int32ArrayType::Pointer copy3 = std::dynamic_pointer_cast<Int32ArrayType>(copy2->deepCopy());
+    DREAM3D_REQUIRE(copy3->getConstPointer(0) == array->getConstPointer(0))
+    array = Int32ArrayType::NullPointer();
+    copy2->resize(50);
+    DREAM3D_REQUIRE_EQUAL(copy2->isStorageShared(), false)
+    DREAM3D_REQUIRE_EQUAL(copy3->getNumberOfTuples(), static_cast<size_t>(100))
+    DREAM3D_REQUIRE_EQUAL(copy3->getValue(0), 7)
+    DREAM3D_REQUIRE_EQUAL(copy3->getValue(299), 299)
+
+    // Removing tuples from a shared array leaves the other copies untouched
+    Int32ArrayType::Pointer copy4 = std::dynamic_pointer_cast<Int32ArrayType>(copy3->deepCopy());
+    QVector<bool> keepMap(100, false);
+    keepMap[1] = true;
+    DREAM3D_REQUIRE_EQUAL(copy4->compactTuples(keepMap), 0)
+    DREAM3D_REQUIRE_EQUAL(copy4->getNumberOfTuples(), static_cast<size_t>(1))
+    DREAM3D_REQUIRE_EQUAL(copy4->getValue(0), 3)
+    DREAM3D_REQUIRE_EQUAL(copy3->getValue(3), 3)
+    DREAM3D_REQUIRE_EQUAL(copy3->getNumberOfTuples(), static_cast<size_t>(100))
+
+    // Shared scratch files stay mapped until the last array lets go of them
+    FloatArrayType::Pointer mapped = FloatArrayType::CreateArray(1000, cDims, "Mapped", false);
+    mapped->setStorageType(DataArrayStorage::Type::MappedFile);
+    DREAM3D_REQUIRE(mapped->allocate() > 0)
+    mapped->initializeWithValue(2.0f);
+    FloatArrayType::Pointer mappedCopy = std::dynamic_pointer_cast<FloatArrayType>(mapped->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(mappedCopy->isStoredInMappedFile(), true)
+    DREAM3D_REQUIRE_EQUAL(mapped->setStorageType(DataArrayStorage::Type::Heap), true)
+    DREAM3D_REQUIRE_EQUAL(mapped->isStorageShared(), false)
+    mapped = FloatArrayType::NullPointer();
+    DREAM3D_REQUIRE_EQUAL(mappedCopy->getValue(2999), 2.0f)
+    mappedCopy->setValue(0, 1.0f);
+    DREAM3D_REQUIRE_EQUAL(mappedCopy->isStoredInMappedFile(), true)
+    DREAM3D_REQUIRE_EQUAL(mappedCopy->getValue(0), 1.0f)
+
+    // Turning copy-on-write off copies the values right away
+    DataArrayStorage::SetCopyOnWrite(false);
+    Int32ArrayType::Pointer eager = std::dynamic_pointer_cast<Int32ArrayType>(copy3->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(eager->isStorageShared(), false)
+    DREAM3D_REQUIRE(eager->getConstPointer(0) != copy3->getConstPointer(0))
+    DREAM3D_REQUIRE_EQUAL(eager->getValue(299), 299)
+    DataArrayStorage::SetCopyOnWrite(true);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCopyOnWriteDuplicate()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("Source");
+    dca->addDataContainer(dc);
+    QVector<size_t> tDims(1, 50);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addAttributeMatrix(am->getName(), am);
+    FloatArrayType::Pointer values = FloatArrayType::CreateArray(50, "Values", true);
+    values->initializeWithValue(3.0f);
+    am->addAttributeArray(values->getName(), values);
+
+    // A pointer fetched before the copy keeps writing into the source only
+    float* raw = values->getPointer(0);
+    dca->duplicateDataContainer("Source", "Copy");
+    FloatArrayType::Pointer copied = dca->getDataContainer("Copy")->getAttributeMatrix("CellData")->getAttributeArrayAs<FloatArrayType>("Values");
+    DREAM3D_REQUIRE_VALID_POINTER(copied.get())
+    DREAM3D_REQUIRE_EQUAL(copied->isStorageShared(), false)
+    raw[0] = 4.0f;
+    DREAM3D_REQUIRE_EQUAL(copied->getValue(0), 3.0f)
+
+    // Once the pipeline moves on to the next filter the duplicate shares the values
+    DataArrayStorage::ReleaseWritablePointers();
+    dca->duplicateDataContainer("Source", "Shared");
+    FloatArrayType::Pointer shared = dca->getDataContainer("Shared")->getAttributeMatrix("CellData")->getAttributeArrayAs<FloatArrayType>("Values");
+    DREAM3D_REQUIRE_VALID_POINTER(shared.get())
+    DREAM3D_REQUIRE_EQUAL(shared->isStorageShared(), true)
+    DREAM3D_REQUIRE(shared->getConstPointer(0) == values->getConstPointer(0))
+
+    // Changing either copy leaves the other one as it was
+    (*shared)[10] = -1.0f;
+    DREAM3D_REQUIRE_EQUAL(values->getValue(10), 3.0f)
+    values->setComponent(20, 0, -2.0f);
+    DREAM3D_REQUIRE_EQUAL(shared->getValue(20), 3.0f)
+    DREAM3D_REQUIRE_EQUAL(shared->getValue(0), 4.0f)
+    DREAM3D_REQUIRE_EQUAL(shared->getValue(10), -1.0f)
+    DREAM3D_REQUIRE_EQUAL(values->getValue(20), -2.0f)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1177,6 +1879,12 @@ public:
     DREAM3D_REGISTER_TEST(TestNeighborList())
     DREAM3D_REGISTER_TEST(TestWrapPointer())
     DREAM3D_REGISTER_TEST(TestPrintDataArray())
+    DREAM3D_REGISTER_TEST(TestPartialH5Read())
+    DREAM3D_REGISTER_TEST(TestLazyH5Read())
+    DREAM3D_REGISTER_TEST(TestMappedFileStorage())
+    DREAM3D_REGISTER_TEST(TestRemoveInactiveObjects())
+    DREAM3D_REGISTER_TEST(TestCopyOnWrite())
+    DREAM3D_REGISTER_TEST(TestCopyOnWriteDuplicate())
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -41,6 +41,12 @@
 #include <fstream>
 #include <iostream>
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
 // HDF5 Includes
 #include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Lite.h"
@@ -49,6 +55,7 @@
 // DREAM3D Includes
 #include "SIMPLib/DataArrays/StatsDataArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
@@ -56,6 +63,167 @@
 #include "SIMPLib/DataContainers/DataContainerProxy.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 
+namespace
+{
+/**
+ * @brief The CompactArraysImpl class compacts several arrays against the same keep map at once
+ */
+class CompactArraysImpl
+{
+public:
+  CompactArraysImpl(const QVector<IDataArray::Pointer>& arrays, const QVector<bool>& keepMap)
+  : m_Arrays(arrays)
+  , m_KeepMap(keepMap)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      m_Arrays[static_cast<int>(i)]->compactTuples(m_KeepMap);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const QVector<IDataArray::Pointer>& m_Arrays;
+  const QVector<bool>& m_KeepMap;
+};
+
+/**
+ * @brief The RenumberFeatureIdsImpl class replaces every feature id with its new number
+ */
+class RenumberFeatureIdsImpl
+{
+public:
+  RenumberFeatureIdsImpl(int32_t* featureIds, const int32_t* newNames, size_t numNames)
+  : m_FeatureIds(featureIds)
+  , m_NewNames(newNames)
+  , m_NumNames(numNames)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      if(m_FeatureIds[i] >= 0 && static_cast<size_t>(m_FeatureIds[i]) < m_NumNames)
+      {
+        m_FeatureIds[i] = m_NewNames[m_FeatureIds[i]];
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  int32_t* m_FeatureIds;
+  const int32_t* m_NewNames;
+  size_t m_NumNames;
+};
+
+/**
+ * @brief Copies the size of every list of a NeighborList<T> and the name of its NumNeighbors array
+ * @param array NeighborList to measure
+ * @param sizes Output list sizes
+ * @param numNeighborsName Output name of the linked NumNeighbors array
+ * @return False if the array is not a NeighborList<T>
+ */
+template <typename T>
+bool GetTypedNeighborListLayout(const IDataArray::Pointer& array, std::vector<int32_t>& sizes, QString& numNeighborsName)
+{
+  typename NeighborList<T>::Pointer list = std::dynamic_pointer_cast<NeighborList<T>>(array);
+  if(nullptr == list.get())
+  {
+    return false;
+  }
+  numNeighborsName = list->getNumNeighborsArrayName();
+  int32_t numLists = list->getNumberOfLists();
+  sizes.resize(static_cast<size_t>(numLists));
+  for(int32_t i = 0; i < numLists; i++)
+  {
+    sizes[i] = list->getListSize(i);
+  }
+  return true;
+}
+
+/**
+ * @brief Calls GetTypedNeighborListLayout() with the value type of the NeighborList
+ * @param array
+ * @param sizes
+ * @param numNeighborsName
+ * @return False if the array is not a NeighborList of a supported type
+ */
+bool GetNeighborListLayout(const IDataArray::Pointer& array, std::vector<int32_t>& sizes, QString& numNeighborsName)
+{
+  return GetTypedNeighborListLayout<float>(array, sizes, numNeighborsName) || GetTypedNeighborListLayout<double>(array, sizes, numNeighborsName) ||
+         GetTypedNeighborListLayout<int8_t>(array, sizes, numNeighborsName) || GetTypedNeighborListLayout<uint8_t>(array, sizes, numNeighborsName) ||
+         GetTypedNeighborListLayout<int16_t>(array, sizes, numNeighborsName) || GetTypedNeighborListLayout<uint16_t>(array, sizes, numNeighborsName) ||
+         GetTypedNeighborListLayout<int32_t>(array, sizes, numNeighborsName) || GetTypedNeighborListLayout<uint32_t>(array, sizes, numNeighborsName) ||
+         GetTypedNeighborListLayout<int64_t>(array, sizes, numNeighborsName) || GetTypedNeighborListLayout<uint64_t>(array, sizes, numNeighborsName);
+}
+
+/**
+ * @brief Removes the same entries from a NeighborList<T> that were removed from the object id NeighborList
+ * it is paired with, so values stored per neighbor stay matched with their neighbor.
+ * @param array NeighborList to filter
+ * @param keepEntries Entry mask of the paired object id NeighborList
+ * @return False if the array is not a NeighborList<T>
+ */
+template <typename T>
+bool RemoveTypedNeighborEntries(const IDataArray::Pointer& array, const std::vector<bool>& keepEntries)
+{
+  typename NeighborList<T>::Pointer list = std::dynamic_pointer_cast<NeighborList<T>>(array);
+  if(nullptr == list.get())
+  {
+    return false;
+  }
+  list->filterEntries([&keepEntries](T&, size_t entry) { return keepEntries[entry]; });
+  return true;
+}
+
+/**
+ * @brief Calls RemoveTypedNeighborEntries() with the value type of the NeighborList
+ * @param array
+ * @param keepEntries
+ */
+void RemoveNeighborEntries(const IDataArray::Pointer& array, const std::vector<bool>& keepEntries)
+{
+  RemoveTypedNeighborEntries<float>(array, keepEntries) || RemoveTypedNeighborEntries<double>(array, keepEntries) || RemoveTypedNeighborEntries<int8_t>(array, keepEntries) ||
+      RemoveTypedNeighborEntries<uint8_t>(array, keepEntries) || RemoveTypedNeighborEntries<int16_t>(array, keepEntries) || RemoveTypedNeighborEntries<uint16_t>(array, keepEntries) ||
+      RemoveTypedNeighborEntries<int32_t>(array, keepEntries) || RemoveTypedNeighborEntries<uint32_t>(array, keepEntries) || RemoveTypedNeighborEntries<int64_t>(array, keepEntries) ||
+      RemoveTypedNeighborEntries<uint64_t>(array, keepEntries);
+}
+
+/**
+ * @brief Returns the array as an object id NeighborList if it is marked as one or carries the name
+ * FindNeighbors gives its neighbor list
+ * @param array
+ * @return
+ */
+Int32NeighborListType::Pointer ObjectIdNeighborList(const IDataArray::Pointer& array)
+{
+  Int32NeighborListType::Pointer list = std::dynamic_pointer_cast<Int32NeighborListType>(array);
+  if(nullptr != list.get() && (list->getContainsObjectIds() || list->getName() == SIMPL::FeatureData::NeighborList))
+  {
+    return list;
+  }
+  return Int32NeighborListType::NullPointer();
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -63,6 +231,7 @@ AttributeMatrix::AttributeMatrix(QVector<size_t> tDims, const QString& name, Att
 : m_Type(attrType)
 , m_Name(name)
 , m_TupleDims(tDims)
+, m_AttributeArraysMutex(QMutex::Recursive)
 {
 }
 
@@ -291,6 +460,7 @@ void AttributeMatrix::ReadAttributeMatrixStructure(hid_t containerId, DataContai
 // -----------------------------------------------------------------------------
 bool AttributeMatrix::doesAttributeArrayExist(const QString& name) const
 {
+  QMutexLocker locker(&m_AttributeArraysMutex);
   return m_AttributeArrays.contains(name);
 }
 
@@ -333,6 +503,7 @@ int AttributeMatrix::addAttributeArray(const QString& name, IDataArray::Pointer
   }
   Q_ASSERT(getNumberOfTuples() == data->getNumberOfTuples());
 
+  QMutexLocker locker(&m_AttributeArraysMutex);
   m_AttributeArrays[name] = data;
   return 0;
 }
@@ -342,6 +513,7 @@ int AttributeMatrix::addAttributeArray(const QString& name, IDataArray::Pointer
 // -----------------------------------------------------------------------------
 IDataArray::Pointer AttributeMatrix::getAttributeArray(const QString& name)
 {
+  QMutexLocker locker(&m_AttributeArraysMutex);
   QMap<QString, IDataArray::Pointer>::iterator it;
   it = m_AttributeArrays.find(name);
   if(it == m_AttributeArrays.end())
@@ -356,6 +528,7 @@ IDataArray::Pointer AttributeMatrix::getAttributeArray(const QString& name)
 // -----------------------------------------------------------------------------
 IDataArray::Pointer AttributeMatrix::removeAttributeArray(const QString& name)
 {
+  QMutexLocker locker(&m_AttributeArraysMutex);
   QMap<QString, IDataArray::Pointer>::iterator it;
   it = m_AttributeArrays.find(name);
   if(it == m_AttributeArrays.end())
@@ -373,6 +546,7 @@ IDataArray::Pointer AttributeMatrix::removeAttributeArray(const QString& name)
 // -----------------------------------------------------------------------------
 RenameErrorCodes AttributeMatrix::renameAttributeArray(const QString& oldname, const QString& newname, bool overwrite)
 {
+  QMutexLocker locker(&m_AttributeArraysMutex);
   QMap<QString, IDataArray::Pointer>::iterator itOld;
   QMap<QString, IDataArray::Pointer>::iterator itNew;
 
@@ -432,7 +606,7 @@ size_t AttributeMatrix::getNumberOfTuples()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-bool AttributeMatrix::removeInactiveObjects(const QVector<bool> &activeObjects, DataArray<int32_t> *featureIds)
+bool AttributeMatrix::removeInactiveObjects(const QVector<bool> &activeObjects, DataArray<int32_t> *featureIds, QString* warningMessage)
 {
   bool acceptableMatrix = false;
   // Only valid for feature or ensemble type matrices
@@ -443,60 +617,168 @@ bool AttributeMatrix::removeInactiveObjects(const QVector<bool> &activeObjects,
     acceptableMatrix = true;
   }
   size_t totalTuples = getNumberOfTuples();
-  if(static_cast<size_t>(activeObjects.size()) == totalTuples && acceptableMatrix == true)
+  if(static_cast<size_t>(activeObjects.size()) != totalTuples || acceptableMatrix == false)
   {
-    size_t goodcount = 1;
-    QVector<size_t> newNames(totalTuples, 0);
-    QVector<size_t> removeList;
+    return false;
+  }
 
-    for(qint32 i = 1; i < activeObjects.size(); i++)
+  // Build the keep map and the new numbering once. Object 0 is never removed.
+  QVector<bool> keepMap(activeObjects);
+  QVector<int32_t> newNames(static_cast<int>(totalTuples), 0);
+  int32_t goodcount = 1;
+  if(totalTuples > 0)
+  {
+    keepMap[0] = true;
+  }
+  for(int32_t i = 1; i < keepMap.size(); i++)
+  {
+    if(keepMap[i])
     {
-      if(activeObjects[i] == false)
-      {
-        removeList.push_back(i);
-        newNames[i] = 0;
-      }
-      else
-      {
-        newNames[i] = goodcount;
-        goodcount++;
-      }
+      newNames[i] = goodcount;
+      goodcount++;
     }
+  }
+  size_t numKept = (totalTuples > 0) ? static_cast<size_t>(goodcount) : 0;
+  if(numKept == totalTuples)
+  {
+    return true;
+  }
 
-    if(removeList.size() > 0)
+  // NeighborLists of object ids still point at the old numbering once the tuples are compacted. Every
+  // other NeighborList holds one value per neighbor and is kept only if it can be paired with exactly one
+  // id list through the NumNeighbors array they share, so its entries can be dropped together with the
+  // removed neighbors. Lists that can not be paired are removed from the matrix and reported.
+  QVector<Int32NeighborListType::Pointer> idLists;
+  QVector<std::vector<int32_t>> idListSizes;
+  QVector<IDataArray::Pointer> valueLists;
+  for(QMap<QString, IDataArray::Pointer>::iterator iter = m_AttributeArrays.begin(); iter != m_AttributeArrays.end(); ++iter)
+  {
+    if(iter.value()->getTypeAsString().compare(SIMPL::TypeNames::NeighborList) != 0)
     {
-      QList<QString> headers = getAttributeArrayNames();
-      for(QList<QString>::iterator iter = headers.begin(); iter != headers.end(); ++iter)
+      continue;
+    }
+    Int32NeighborListType::Pointer idList = ObjectIdNeighborList(iter.value());
+    if(nullptr != idList.get())
+    {
+      idLists.push_back(idList);
+      QString numNeighborsName;
+      idListSizes.push_back(std::vector<int32_t>());
+      GetNeighborListLayout(idList, idListSizes.back(), numNeighborsName);
+    }
+    else
+    {
+      valueLists.push_back(iter.value());
+    }
+  }
+  QVector<IDataArray::Pointer> pairedLists;
+  QVector<int32_t> valueListPairs;
+  QString removedLists;
+  for(int32_t i = 0; i < valueLists.size(); i++)
+  {
+    QString numNeighborsName;
+    std::vector<int32_t> sizes;
+    IDataArray::Pointer valueList = valueLists[i];
+    int32_t pair = -1;
+    int32_t candidates = 0;
+    if(GetNeighborListLayout(valueList, sizes, numNeighborsName))
+    {
+      for(int32_t j = 0; j < idLists.size(); j++)
       {
-        IDataArray::Pointer p = getAttributeArray(*iter);
-        QString type = p->getTypeAsString();
-        if(type.compare("NeighborList<T>") == 0)
-        {
-          removeAttributeArray(*iter);
-        }
-        else
+        if(idLists[j]->getNumNeighborsArrayName() == numNeighborsName)
         {
-          p->eraseTuples(removeList);
+          candidates++;
+          pair = j;
         }
       }
-      QVector<size_t> tDims(1, (totalTuples - removeList.size()));
-      setTupleDimensions(tDims);
+    }
+    if(candidates != 1 || idListSizes[pair] != sizes)
+    {
+      removedLists += (removedLists.isEmpty() ? "" : ", ") + valueList->getName();
+      removeAttributeArray(valueList->getName());
+      continue;
+    }
+    pairedLists.push_back(valueList);
+    valueListPairs.push_back(pair);
+  }
+  if(!removedLists.isEmpty() && nullptr != warningMessage)
+  {
+    *warningMessage = QObject::tr("The NeighborLists %1 could not be matched with exactly one list of object ids that uses the same NumNeighbors array and has the same list sizes, "
+                                  "so they were removed")
+                          .arg(removedLists);
+  }
+
+  QVector<IDataArray::Pointer> arrays;
+  for(QMap<QString, IDataArray::Pointer>::iterator iter = m_AttributeArrays.begin(); iter != m_AttributeArrays.end(); ++iter)
+  {
+    arrays.push_back(iter.value());
+  }
 
-      // Loop over all the points and correct all the feature names
-      size_t totalPoints = featureIds->getNumberOfTuples();
-      int32_t* featureIdPtr = featureIds->getPointer(0);
-      for(size_t i = 0; i < totalPoints; i++)
+  // Compact every array against the same keep map
+  CompactArraysImpl compactImpl(arrays, keepMap);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, static_cast<size_t>(arrays.size()), 1), compactImpl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    compactImpl.compute(0, static_cast<size_t>(arrays.size()));
+  }
+
+  // Renumber the id lists and drop the entries of removed objects
+  QVector<std::vector<bool>> keepEntries(idLists.size());
+  for(int32_t i = 0; i < idLists.size(); i++)
+  {
+    Int32NeighborListType::Pointer idList = idLists[i];
+    std::vector<bool>& keep = keepEntries[i];
+    const QVector<bool>& constKeepMap = keepMap;
+    const QVector<int32_t>& constNewNames = newNames;
+    idList->filterEntries([&keep, &constKeepMap, &constNewNames, totalTuples](int32_t& value, size_t) {
+      bool keepEntry = true;
+      if(value >= 0 && static_cast<size_t>(value) < totalTuples)
       {
-        if(featureIdPtr[i] >= 0 && featureIdPtr[i] < newNames.size())
-        {
-          featureIdPtr[i] = static_cast<int32_t>(newNames[featureIdPtr[i]]);
-        }
+        keepEntry = constKeepMap[value];
+        value = constNewNames[value];
+      }
+      keep.push_back(keepEntry);
+      return keepEntry;
+    });
+
+    // Keep the neighbor counts in step with the lists
+    int32_t numLists = idList->getNumberOfLists();
+    Int32ArrayType::Pointer numNeighbors = std::dynamic_pointer_cast<Int32ArrayType>(getAttributeArray(idList->getNumNeighborsArrayName()));
+    if(nullptr != numNeighbors.get() && numNeighbors->getNumberOfTuples() == static_cast<size_t>(numLists) && numNeighbors->getNumberOfComponents() == 1)
+    {
+      for(int32_t j = 0; j < numLists; j++)
+      {
+        numNeighbors->setValue(j, idList->getListSize(j));
       }
     }
   }
-  else
+  for(int32_t i = 0; i < pairedLists.size(); i++)
   {
-    return false;
+    RemoveNeighborEntries(pairedLists[i], keepEntries[valueListPairs[i]]);
+  }
+
+  m_TupleDims = QVector<size_t>(1, numKept);
+
+  // Loop over all the points and correct all the feature names
+  if(nullptr != featureIds)
+  {
+    size_t totalPoints = featureIds->getNumberOfTuples();
+    RenumberFeatureIdsImpl renumberImpl(featureIds->getPointer(0), newNames.constData(), totalTuples);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, totalPoints), renumberImpl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      renumberImpl.compute(0, totalPoints);
+    }
   }
   return true;
 }
@@ -535,6 +817,7 @@ void AttributeMatrix::clearAttributeArrays()
 // -----------------------------------------------------------------------------
 QList<QString> AttributeMatrix::getAttributeArrayNames()
 {
+  QMutexLocker locker(&m_AttributeArraysMutex);
   QList<QString> keys;
   for(QMap<QString, IDataArray::Pointer>::iterator iter = m_AttributeArrays.begin(); iter != m_AttributeArrays.end(); ++iter)
   {
@@ -548,6 +831,7 @@ QList<QString> AttributeMatrix::getAttributeArrayNames()
 // -----------------------------------------------------------------------------
 int AttributeMatrix::getNumAttributeArrays() const
 {
+  QMutexLocker locker(&m_AttributeArraysMutex);
   return static_cast<int>(m_AttributeArrays.size());
 }
 
@@ -574,13 +858,13 @@ AttributeMatrix::Pointer AttributeMatrix::deepCopy(bool forceNoAllocate)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int AttributeMatrix::writeAttributeArraysToHDF5(hid_t parentId)
+int AttributeMatrix::writeAttributeArraysToHDF5(hid_t parentId, const H5DatasetCreationPolicy& policy)
 {
   int err;
   for(QMap<QString, IDataArray::Pointer>::iterator iter = m_AttributeArrays.begin(); iter != m_AttributeArrays.end(); ++iter)
   {
     IDataArray::Pointer d = iter.value();
-    err = d->writeH5Data(parentId, m_TupleDims);
+    err = d->writeH5Data(parentId, m_TupleDims, policy);
     if(err < 0)
     {
       return err;
@@ -650,11 +934,26 @@ int AttributeMatrix::addAttributeArrayFromHDF5Path(hid_t gid, QString name, bool
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy)
+int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy, const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount,
+                                                 const H5LazyFileHandle::Pointer& lazyFile)
 {
   int err = 0;
   QMap<QString, DataArrayProxy> dasToRead = attrMatProxy->dataArrays;
   QString classType;
+  bool readSubVolume = !tupleOffset.isEmpty() && !tupleCount.isEmpty();
+  QVector<size_t> fileTupleDims;
+  if(readSubVolume)
+  {
+    // The tuple dimensions stored in the file describe the full volume
+    fileTupleDims = m_TupleDims;
+    QH5Lite::readVectorAttribute(amGid, ".", SIMPL::HDF5::TupleDimensions, fileTupleDims);
+  }
+  bool readLazy = !preflight && nullptr != lazyFile.get();
+  QString amPath;
+  if(readLazy)
+  {
+    amPath = QH5Utilities::getObjectPath(amGid);
+  }
   for(QMap<QString, DataArrayProxy>::iterator iter = dasToRead.begin(); iter != dasToRead.end(); ++iter)
   {
     // qDebug() << "Reading the " << iter->name << " Array from the " << m_Name << " Attribute Matrix \n";
@@ -666,7 +965,25 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
     //   qDebug() << groupName << " Array: " << *iter << " with C++ ClassType of " << classType << "\n";
     IDataArray::Pointer dPtr = IDataArray::NullPointer();
 
-    if(classType.startsWith("DataArray") == true)
+    if(classType.startsWith("DataArray") == true && readSubVolume)
+    {
+      dPtr = H5DataArrayReader::ReadIDataArraySubVolume(amGid, iter->name, tupleOffset, tupleCount, preflight);
+      if(nullptr == dPtr.get())
+      {
+        err = -1;
+        break;
+      }
+    }
+    else if(classType.startsWith("DataArray") == true && readLazy)
+    {
+      // Only the meta data is read now. The values are read on first access.
+      dPtr = H5DataArrayReader::ReadIDataArray(amGid, iter->name, true);
+      if(nullptr != dPtr.get() && !dPtr->setLazyDataSource(H5LazyDataSource::New(lazyFile, amPath, iter->name)))
+      {
+        dPtr = H5DataArrayReader::ReadIDataArray(amGid, iter->name, false);
+      }
+    }
+    else if(classType.startsWith("DataArray") == true)
     {
       dPtr = H5DataArrayReader::ReadIDataArray(amGid, iter->name, preflight);
     }
@@ -696,6 +1013,20 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
     //      dPtr = statsData;
     //    }
 
+    // Arrays that can not be partially read are read whole and then cropped
+    if(readSubVolume && nullptr != dPtr.get() && dPtr->getNumberOfTuples() != getNumberOfTuples())
+    {
+      if(preflight)
+      {
+        dPtr->resize(getNumberOfTuples());
+      }
+      else if(dPtr->cropTuples(fileTupleDims, tupleOffset, tupleCount) < 0)
+      {
+        err = -1;
+        break;
+      }
+    }
+
     if(nullptr != dPtr.get())
     {
       addAttributeArray(dPtr->getName(), dPtr);
@@ -50,6 +50,7 @@
 #include <QtCore/QList>
 #include <QtCore/QString>
 #include <QtCore/QMap>
+#include <QtCore/QMutex>
 #include <QtCore/QVector>
 
 //-- DREAM3D Includes
@@ -349,6 +350,10 @@ public:
         ss = QObject::tr("The AttributeMatrix named '%1' contains an array with name '%2' but the DataArray could not be downcast using std::dynamic_pointer_cast<T>.").arg(getName()).arg(attributeArrayName);
         filter->notifyErrorMessage(filter->getHumanLabel(), ss, filter->getErrorCondition());
       }
+      else if(nullptr != attributeArray.get() && !loadLazyArray<Filter>(filter, iDataArray, err))
+      {
+        return ArrayType::NullPointer();
+      }
       return attributeArray;
     }
 
@@ -394,6 +399,10 @@ public:
         IDataArray::Pointer ptr = getAttributeArray(attributeArrayName);
         if (std::dynamic_pointer_cast<ArrayType>(ptr) != nullptr)
         {
+          if(!loadLazyArray<Filter>(filter, ptr, err))
+          {
+            return attributeArray;
+          }
           return std::dynamic_pointer_cast<ArrayType>(ptr);
         }
         else
@@ -487,6 +496,30 @@ public:
       }
     }
 
+    /**
+     * @brief Reads the values of an array that still waits on a lazy data source and reports a
+     * failed read to the filter.
+     * @param filter Can be nullptr
+     * @param array
+     * @param err The error code to set into the filter if the values could not be read
+     * @return false if the values could not be read
+     */
+    template<class Filter>
+    bool loadLazyArray(Filter* filter, const IDataArray::Pointer& array, int err)
+    {
+      if(array->loadData())
+      {
+        return true;
+      }
+      if(nullptr != filter)
+      {
+        QString ss = QObject::tr("The values of the DataArray '%1' in the AttributeMatrix '%2' could not be read from the file they were loaded from").arg(array->getName()).arg(getName());
+        filter->setErrorCondition(err);
+        filter->notifyErrorMessage(filter->getHumanLabel(), ss, filter->getErrorCondition());
+      }
+      return false;
+    }
+
     /**
      * @brief dataArrayCompatibility
      * @param arrayName
@@ -558,10 +591,17 @@ public:
 
     /**
     * @brief Removes inactive objects from the Attribute Matrix and renumbers the active objects to preserve a compact matrix
-      (only valid for feature or ensemble type matrices)
-    * @param size The new size of the array
+      (only valid for feature or ensemble type matrices). All arrays are compacted concurrently against one keep map.
+      NeighborList<int32_t> arrays that hold object ids (see NeighborList::getContainsObjectIds()) are renumbered, the
+      entries of removed objects are dropped and their NumNeighbors array is updated to match. Every other NeighborList
+      that shares its NumNeighbors array name with exactly one id list of the same list sizes has its entries dropped
+      together with the matching id list entries; any other NeighborList is removed from the matrix.
+    * @param activeObjects One flag per object. Object 0 is always kept
+    * @param featureIds Array of object ids to renumber. Ids of removed objects become 0
+    * @param warningMessage Receives the names of the NeighborLists that could not be paired and were removed
+    * @return False, with nothing modified, if the matrix type or the number of flags is not valid
     */
-    bool removeInactiveObjects(const QVector<bool> &activeObjects, DataArray<int32_t>* featureIds);
+    bool removeInactiveObjects(const QVector<bool>& activeObjects, DataArray<int32_t>* featureIds, QString* warningMessage = nullptr);
 
     /**
      * @brief Sets the Tuple Dimensions for the Attribute Matrix
@@ -592,9 +632,10 @@ public:
     /**
      * @brief writeAttributeArraysToHDF5
      * @param parentId
+     * @param policy The chunking/compression policy used to create each array's dataset
      * @return
      */
-    virtual int writeAttributeArraysToHDF5(hid_t parentId);
+    virtual int writeAttributeArraysToHDF5(hid_t parentId, const H5DatasetCreationPolicy& policy = H5DatasetCreationPolicy());
 
     /**
      * @brief addAttributeArrayFromHDF5Path
@@ -610,9 +651,15 @@ public:
      * @param amGid
      * @param preflight
      * @param attrMatProxy
+     * @param tupleOffset Optional first tuple index along each tuple dimension. When given
+     * together with tupleCount only that block of tuples is read from each array.
+     * @param tupleCount Optional number of tuples along each tuple dimension
+     * @param lazyFile Optional open file. When given the DataArrays are created from their
+     * meta data only and read their values from this file the first time they are accessed.
      * @return
      */
-    virtual int readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy);
+    virtual int readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy, const QVector<size_t>& tupleOffset = QVector<size_t>(),
+                                            const QVector<size_t>& tupleCount = QVector<size_t>(), const H5LazyFileHandle::Pointer& lazyFile = H5LazyFileHandle::NullPointer());
 
     /**
      * @brief generateXdmfText
@@ -676,6 +723,9 @@ public:
   private:
     QVector<size_t> m_TupleDims;
     QMap<QString, IDataArray::Pointer> m_AttributeArrays;
+    // Guards lookups and insertions in m_AttributeArrays so filters working on different arrays of
+    // the same AttributeMatrix can run concurrently
+    mutable QMutex m_AttributeArraysMutex;
 
     AttributeMatrix(const AttributeMatrix&);
     void operator =(const AttributeMatrix&);
@@ -320,7 +320,7 @@ int DataContainer::getNumAttributeMatrices()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int DataContainer::writeAttributeMatricesToHDF5(hid_t parentId)
+int DataContainer::writeAttributeMatricesToHDF5(hid_t parentId, const H5DatasetCreationPolicy& policy)
 {
   int err;
   hid_t attributeMatrixId;
@@ -348,7 +348,7 @@ int DataContainer::writeAttributeMatricesToHDF5(hid_t parentId)
     {
       return err;
     }
-    err = (*iter)->writeAttributeArraysToHDF5(attributeMatrixId);
+    err = (*iter)->writeAttributeArraysToHDF5(attributeMatrixId, policy);
     if(err < 0)
     {
       return err;
@@ -360,7 +360,7 @@ int DataContainer::writeAttributeMatricesToHDF5(hid_t parentId)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, const DataContainerProxy& dcProxy)
+int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, const DataContainerProxy& dcProxy, const H5LazyFileHandle::Pointer& lazyFile)
 {
   int err = 0;
   QVector<size_t> tDims;
@@ -395,6 +395,25 @@ int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, co
       return -1;
     }
 
+    // Only the Cell data of an Image Geometry is restricted to the requested sub-volume
+    QVector<size_t> tupleOffset;
+    QVector<size_t> tupleCount;
+    if(dcProxy.hasSubVolume() && static_cast<AttributeMatrix::Type>(amTypeTmp) == AttributeMatrix::Type::Cell && tDims.size() == 3)
+    {
+      tupleOffset = dcProxy.subVolumeOffset;
+      tupleCount = dcProxy.subVolumeDims;
+      for(int32_t i = 0; i < 3; i++)
+      {
+        if(tupleCount[i] == 0 || tupleOffset[i] + tupleCount[i] > tDims[i])
+        {
+          H5Gclose(amGid);
+          H5Gclose(dcGid);
+          return -1;
+        }
+      }
+      tDims = tupleCount;
+    }
+
     if(getAttributeMatrix(amName) == nullptr)
     {
       amType = static_cast<AttributeMatrix::Type>(amTypeTmp);
@@ -403,7 +422,7 @@ int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, co
     }
 
     AttributeMatrixProxy amProxy = iter.value();
-    err = getAttributeMatrix(amName)->readAttributeArraysFromHDF5(amGid, preflight, &amProxy);
+    err = getAttributeMatrix(amName)->readAttributeArraysFromHDF5(amGid, preflight, &amProxy, tupleOffset, tupleCount, lazyFile);
     if(err < 0)
     {
       err |= H5Gclose(dcGid);
@@ -443,7 +462,7 @@ DataContainer::Pointer DataContainer::deepCopy(bool forceNoAllocate)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int DataContainer::writeMeshToHDF5(hid_t dcGid, bool writeXdmf)
+int DataContainer::writeMeshToHDF5(hid_t dcGid, bool writeXdmf, const H5DatasetCreationPolicy& policy)
 {
   int err;
   hid_t geometryId;
@@ -504,7 +523,7 @@ int DataContainer::writeMeshToHDF5(hid_t dcGid, bool writeXdmf)
     {
       return err;
     }
-    err = m_Geometry->writeGeometryToHDF5(geometryId, writeXdmf);
+    err = m_Geometry->writeGeometryToHDF5(geometryId, writeXdmf, policy);
     if(err < 0)
     {
       return err;
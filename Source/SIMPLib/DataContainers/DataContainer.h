@@ -47,6 +47,7 @@
 #include "SIMPLib/Common/Observable.h"
 #include "SIMPLib/DataContainers/DataArrayPath.h"
 #include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/HDF5/H5LazyDataSource.h"
 
 class QTextStream;
 class DataArrayPath;
@@ -332,15 +333,20 @@ public:
 
     /**
     * @brief Writes all the Attribute Matrices to HDF5 file
+    * @param parentId
+    * @param policy The chunking/compression policy used to create the array datasets
     * @return
     */
-    virtual int writeAttributeMatricesToHDF5(hid_t parentId);
+    virtual int writeAttributeMatricesToHDF5(hid_t parentId, const H5DatasetCreationPolicy& policy = H5DatasetCreationPolicy());
 
     /**
-    * @brief Reads desired Attribute Matrices from HDF5 file
+    * @brief Reads desired Attribute Matrices from HDF5 file. If the proxy selects a
+    * sub-volume then only that block of the Cell Attribute Matrices is read. If a lazy
+    * file is given the values of the DataArrays are only read when first accessed.
     * @return
     */
-    virtual int readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, const DataContainerProxy& dcProxy);
+    virtual int readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, const DataContainerProxy& dcProxy,
+                                              const H5LazyFileHandle::Pointer& lazyFile = H5LazyFileHandle::NullPointer());
 
     /**
      * @brief creates copy of dataContainer
@@ -351,9 +357,11 @@ public:
     /**
      * @brief writeMeshToHDF5
      * @param dcGid
+     * @param writeXdmf
+     * @param policy The chunking/compression policy used to create the geometry datasets
      * @return
      */
-    virtual int writeMeshToHDF5(hid_t dcGid, bool writeXdmf);
+    virtual int writeMeshToHDF5(hid_t dcGid, bool writeXdmf, const H5DatasetCreationPolicy& policy = H5DatasetCreationPolicy());
 
     /**
      * @brief writeXdmf
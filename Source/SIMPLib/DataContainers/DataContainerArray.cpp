@@ -36,6 +36,22 @@
 
 #include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
 #include "SIMPLib/DataContainers/DataContainerProxy.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+namespace
+{
+/**
+ * @brief The AccessRecording struct is the access recorder of one thread and the
+ * DataContainerArray it records
+ */
+struct AccessRecording
+{
+  const DataContainerArray* dca = nullptr;
+  QVector<DataArrayPath>* recorder = nullptr;
+  int depth = 0;
+};
+thread_local AccessRecording s_AccessRecording;
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -55,6 +71,7 @@ DataContainerArray::~DataContainerArray() = default;
 // -----------------------------------------------------------------------------
 void DataContainerArray::addDataContainer(DataContainer::Pointer f)
 {
+  recordAccess(DataArrayPath());
   m_Array.push_back(f);
 }
 
@@ -63,6 +80,7 @@ void DataContainerArray::addDataContainer(DataContainer::Pointer f)
 // -----------------------------------------------------------------------------
 int DataContainerArray::getNumDataContainers()
 {
+  recordAccess(DataArrayPath());
   return m_Array.size();
 }
 
@@ -71,6 +89,7 @@ int DataContainerArray::getNumDataContainers()
 // -----------------------------------------------------------------------------
 void DataContainerArray::clearDataContainers()
 {
+  recordAccess(DataArrayPath());
   m_Array.clear();
 }
 
@@ -124,6 +143,7 @@ bool DataContainerArray::empty()
 // -----------------------------------------------------------------------------
 DataContainer::Pointer DataContainerArray::removeDataContainer(const QString& name)
 {
+  recordAccess(DataArrayPath());
   removeDataContainerFromBundles(name);
   DataContainer::Pointer f = DataContainer::NullPointer();
   for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
@@ -145,6 +165,7 @@ DataContainer::Pointer DataContainerArray::removeDataContainer(const QString& na
 // -----------------------------------------------------------------------------
 bool DataContainerArray::renameDataContainer(const QString& oldName, const QString& newName)
 {
+  recordAccess(DataArrayPath());
   DataContainer::Pointer dc = DataContainer::NullPointer();
 
   // Make sure we do not already have a DataContainer with the newname
@@ -187,6 +208,7 @@ bool DataContainerArray::renameDataContainer(const QString& oldName, const QStri
 // -----------------------------------------------------------------------------
 DataContainer::Pointer DataContainerArray::getDataContainer(const QString& name)
 {
+  recordAccess(DataArrayPath(name, "", ""));
   DataContainer::Pointer f = DataContainer::NullPointer();
   for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
   {
@@ -214,6 +236,7 @@ DataContainer::Pointer DataContainerArray::getDataContainer(const DataArrayPath&
 // -----------------------------------------------------------------------------
 AttributeMatrix::Pointer DataContainerArray::getAttributeMatrix(const DataArrayPath& path)
 {
+  RecordingScope scope(this, DataArrayPath(path.getDataContainerName(), path.getAttributeMatrixName(), ""));
   DataContainer::Pointer dc = getDataContainer(path);
   if(nullptr == dc.get())
   {
@@ -228,6 +251,7 @@ AttributeMatrix::Pointer DataContainerArray::getAttributeMatrix(const DataArrayP
 // -----------------------------------------------------------------------------
 void DataContainerArray::duplicateDataContainer(const QString& name, const QString& newName)
 {
+  recordAccess(DataArrayPath());
   DataContainer::Pointer f = DataContainer::NullPointer();
   for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
   {
@@ -253,6 +277,7 @@ void DataContainerArray::duplicateDataContainer(const QString& name, const QStri
 // -----------------------------------------------------------------------------
 QList<QString> DataContainerArray::getDataContainerNames()
 {
+  recordAccess(DataArrayPath());
   QList<QString> names;
   for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
   {
@@ -266,6 +291,7 @@ QList<QString> DataContainerArray::getDataContainerNames()
 // -----------------------------------------------------------------------------
 QList<DataContainer::Pointer>& DataContainerArray::getDataContainers()
 {
+  recordAccess(DataArrayPath());
   return m_Array;
 }
 
@@ -287,8 +313,9 @@ void DataContainerArray::printDataContainerNames(QTextStream& out)
 // -----------------------------------------------------------------------------
 int DataContainerArray::readDataContainersFromHDF5(bool preflight, hid_t dcaGid, 
                                                    const DataContainerArrayProxy &dcaProxy, 
-                                                   Observable* obs)
+                                                   Observable* obs, const H5LazyFileHandle::Pointer& lazyFile)
 {
+  recordAccess(DataArrayPath());
   int err = 0;
   QList<DataContainerProxy> dcsToRead = dcaProxy.dataContainers.values();
   QListIterator<DataContainerProxy> dcIter(dcsToRead);
@@ -335,7 +362,21 @@ int DataContainerArray::readDataContainersFromHDF5(bool preflight, hid_t dcaGid,
       }
       return -198745603;
     }
-    err = this->getDataContainer(dcProxy.name)->readAttributeMatricesFromHDF5(preflight, dcGid, dcProxy);
+    if(dcProxy.hasSubVolume())
+    {
+      err = applySubVolumeToGeometry(dc, dcProxy);
+      if(err < 0)
+      {
+        H5Gclose(dcGid);
+        if(nullptr != obs)
+        {
+          QString ss = QObject::tr("The sub-volume requested for '%1' is only valid for an Image Geometry and must lie inside its dimensions").arg(dcProxy.name);
+          obs->notifyErrorMessage(getNameOfClass(), ss, -198745605);
+        }
+        return -198745605;
+      }
+    }
+    err = this->getDataContainer(dcProxy.name)->readAttributeMatricesFromHDF5(preflight, dcGid, dcProxy, lazyFile);
     if(err < 0)
     {
       if(nullptr != obs)
@@ -349,11 +390,42 @@ int DataContainerArray::readDataContainersFromHDF5(bool preflight, hid_t dcaGid,
   return err;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int DataContainerArray::applySubVolumeToGeometry(const DataContainerShPtr& dc, const DataContainerProxy& dcProxy)
+{
+  ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+  if(nullptr == image.get())
+  {
+    return -1;
+  }
+  size_t dims[3] = {0, 0, 0};
+  float res[3] = {1.0f, 1.0f, 1.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+  std::tie(dims[0], dims[1], dims[2]) = image->getDimensions();
+  std::tie(res[0], res[1], res[2]) = image->getResolution();
+  std::tie(origin[0], origin[1], origin[2]) = image->getOrigin();
+  for(int32_t i = 0; i < 3; i++)
+  {
+    if(dcProxy.subVolumeDims[i] == 0 || dcProxy.subVolumeOffset[i] + dcProxy.subVolumeDims[i] > dims[i])
+    {
+      return -2;
+    }
+    // Keep the selected voxels at the same place in space
+    origin[i] = origin[i] + static_cast<float>(dcProxy.subVolumeOffset[i]) * res[i];
+  }
+  image->setDimensions(dcProxy.subVolumeDims[0], dcProxy.subVolumeDims[1], dcProxy.subVolumeDims[2]);
+  image->setOrigin(origin);
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 bool DataContainerArray::doesDataContainerExist(const QString& name)
 {
+  recordAccess(DataArrayPath(name, "", ""));
   for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
   {
     if((*it)->getName().compare(name) == 0)
@@ -369,6 +441,7 @@ bool DataContainerArray::doesDataContainerExist(const QString& name)
 // -----------------------------------------------------------------------------
 bool DataContainerArray::doesAttributeMatrixExist(const DataArrayPath& path)
 {
+  RecordingScope scope(this, DataArrayPath(path.getDataContainerName(), path.getAttributeMatrixName(), ""));
   if(!doesDataContainerExist(path.getDataContainerName()))
   {
     return false;
@@ -383,6 +456,7 @@ bool DataContainerArray::doesAttributeMatrixExist(const DataArrayPath& path)
 // -----------------------------------------------------------------------------
 bool DataContainerArray::doesAttributeArrayExist(const DataArrayPath& path)
 {
+  RecordingScope scope(this, path);
   if(!doesDataContainerExist(path.getDataContainerName()))
   {
     return false;
@@ -401,6 +475,7 @@ bool DataContainerArray::doesAttributeArrayExist(const DataArrayPath& path)
 // -----------------------------------------------------------------------------
 void DataContainerArray::setDataContainerBundles(QMap<QString, IDataContainerBundle::Pointer> bundles)
 {
+  recordAccess(DataArrayPath());
   m_DataContainerBundles = bundles;
 }
 
@@ -409,6 +484,7 @@ void DataContainerArray::setDataContainerBundles(QMap<QString, IDataContainerBun
 // -----------------------------------------------------------------------------
 QMap<QString, IDataContainerBundle::Pointer>& DataContainerArray::getDataContainerBundles()
 {
+  recordAccess(DataArrayPath());
   return m_DataContainerBundles;
 }
 
@@ -417,6 +493,7 @@ QMap<QString, IDataContainerBundle::Pointer>& DataContainerArray::getDataContain
 // -----------------------------------------------------------------------------
 IDataContainerBundle::Pointer DataContainerArray::getDataContainerBundle(const QString& name)
 {
+  recordAccess(DataArrayPath());
   IDataContainerBundle::Pointer f = IDataContainerBundle::NullPointer();
   for(QMap<QString, IDataContainerBundle::Pointer>::iterator it = m_DataContainerBundles.begin(); it != m_DataContainerBundles.end(); ++it)
   {
@@ -435,6 +512,7 @@ IDataContainerBundle::Pointer DataContainerArray::getDataContainerBundle(const Q
 // -----------------------------------------------------------------------------
 void DataContainerArray::addDataContainerBundle(IDataContainerBundle::Pointer dataContainerBundle)
 {
+  recordAccess(DataArrayPath());
   m_DataContainerBundles[dataContainerBundle->getName()] = dataContainerBundle;
 }
 
@@ -443,6 +521,7 @@ void DataContainerArray::addDataContainerBundle(IDataContainerBundle::Pointer da
 // -----------------------------------------------------------------------------
 int DataContainerArray::removeDataContainerBundle(const QString& name)
 {
+  recordAccess(DataArrayPath());
   return m_DataContainerBundles.remove(name);
 }
 
@@ -473,6 +552,7 @@ void DataContainerArray::removeDataContainerFromBundles(const QString& name)
 // -----------------------------------------------------------------------------
 bool DataContainerArray::renameDataContainerBundle(const QString& oldName, const QString newName)
 {
+  recordAccess(DataArrayPath());
   // Make sure we do not already have a DataContainerBundle with the newname
   QMap<QString, IDataContainerBundle::Pointer>::iterator iter = m_DataContainerBundles.find(newName);
 
@@ -544,6 +624,7 @@ DataContainerArray::Pointer DataContainerArray::deepCopy(bool forceNoAllocate)
 // -----------------------------------------------------------------------------
 void DataContainerArray::renameDataArrayPaths(DataArrayPath::RenameContainer renamePaths)
 {
+  recordAccess(DataArrayPath());
   for(DataArrayPath::RenameType renameType : renamePaths)
   {
     DataArrayPath oldPath;
@@ -572,3 +653,51 @@ void DataContainerArray::renameDataArrayPaths(DataArrayPath::RenameContainer ren
     }
   }
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath>* DataContainerArray::setAccessRecorder(QVector<DataArrayPath>* recorder)
+{
+  QVector<DataArrayPath>* previous = (s_AccessRecording.dca == this ? s_AccessRecording.recorder : nullptr);
+  s_AccessRecording.dca = (nullptr != recorder ? this : nullptr);
+  s_AccessRecording.recorder = recorder;
+  s_AccessRecording.depth = 0;
+  return previous;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerArray::recordAccess(const DataArrayPath& path)
+{
+  if(s_AccessRecording.dca == this && s_AccessRecording.depth == 0)
+  {
+    s_AccessRecording.recorder->push_back(path);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataContainerArray::beginRecordingScope(const DataArrayPath& path)
+{
+  if(s_AccessRecording.dca != this)
+  {
+    return false;
+  }
+  recordAccess(path);
+  s_AccessRecording.depth++;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerArray::endRecordingScope()
+{
+  if(s_AccessRecording.dca == this && s_AccessRecording.depth > 0)
+  {
+    s_AccessRecording.depth--;
+  }
+}
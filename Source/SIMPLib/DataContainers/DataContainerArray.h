@@ -41,11 +41,13 @@
 #include <QtCore/QObject> // for Q_OBJECT
 #include <QtCore/QString>
 #include <QtCore/QList>
+#include <QtCore/QVector>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/DataContainers/IDataContainerBundle.h"
 #include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/HDF5/H5LazyDataSource.h"
 
 
 class DataContainer;
@@ -192,12 +194,24 @@ class SIMPLib_EXPORT DataContainerArray : public QObject
      * @param dcaGid
      * @param dcaProxy
      * @param obs
+     * @param lazyFile Optional open file the DataArrays read their values from on first access
      * @return
      */
     virtual int readDataContainersFromHDF5(bool preflight,
                                            hid_t dcaGid,
                                            const DataContainerArrayProxy& dcaProxy,
-                                           Observable* obs = nullptr);
+                                           Observable* obs = nullptr,
+                                           const H5LazyFileHandle::Pointer& lazyFile = H5LazyFileHandle::NullPointer());
+
+    /**
+     * @brief applySubVolumeToGeometry Shrinks the Image Geometry of the DataContainer to
+     * the sub-volume selected in the proxy and moves its origin so the selected voxels
+     * stay at the same place in space.
+     * @param dc
+     * @param dcProxy
+     * @return Negative value if the geometry is not an Image Geometry or the sub-volume does not fit
+     */
+    static int applySubVolumeToGeometry(const DataContainerShPtr& dc, const DataContainerProxy& dcProxy);
 
 
     /**
@@ -364,6 +378,7 @@ class SIMPLib_EXPORT DataContainerArray : public QObject
     template<typename Filter>
     AttributeMatrix::Pointer getPrereqAttributeMatrixFromPath(Filter* filter, const DataArrayPath& path, int err)
     {
+      RecordingScope scope(this, DataArrayPath(path.getDataContainerName(), path.getAttributeMatrixName(), ""));
       // First try to get the Parent DataContainer. If an error occurs the error message will have been set
       // so just return a nullptr shared pointer
       DataContainerShPtr dc = getPrereqDataContainer<Filter>(filter, path.getDataContainerName(), false);
@@ -384,6 +399,7 @@ class SIMPLib_EXPORT DataContainerArray : public QObject
     template<class ArrayType, class Filter>
     typename ArrayType::Pointer getPrereqArrayFromPath(Filter* filter, const DataArrayPath& path, QVector<size_t> cDims)
     {
+      RecordingScope scope(this, path);
 
       QString ss;
       typename ArrayType::Pointer dataArray = ArrayType::NullPointer();
@@ -452,6 +468,7 @@ class SIMPLib_EXPORT DataContainerArray : public QObject
     template<class ArrayType, class Filter>
     typename ArrayType::Pointer getPrereqIDataArrayFromPath(Filter* filter, const DataArrayPath& path)
     {
+      RecordingScope scope(this, path);
 
       QString ss;
       typename ArrayType::Pointer dataArray = ArrayType::NullPointer();
@@ -529,6 +546,7 @@ class SIMPLib_EXPORT DataContainerArray : public QObject
                                                              QVector<size_t> compDims,
                                                              const QString property = "")
     {
+      RecordingScope scope(this, path);
       typename ArrayType::Pointer dataArray = ArrayType::NullPointer();
       QString ss;
       if(path.isValid() == false)
@@ -735,6 +753,17 @@ class SIMPLib_EXPORT DataContainerArray : public QObject
      */
     DataContainerArray::Pointer deepCopy(bool forceNoAllocate = false);
 
+    /**
+     * @brief setAccessRecorder Starts recording the DataArrayPath of every DataContainer, AttributeMatrix and
+     * DataArray that the calling thread looks up, creates or removes through this DataContainerArray. Each access
+     * is recorded at the finest level the caller asked for; an empty path means the whole DataContainerArray was
+     * touched. Other threads keep their own recorders, so filters running concurrently on the same
+     * DataContainerArray each record only their own accesses. Pass nullptr to stop recording.
+     * @param recorder
+     * @return The recorder the calling thread used before, so nested recordings can restore it
+     */
+    QVector<DataArrayPath>* setAccessRecorder(QVector<DataArrayPath>* recorder);
+
   protected:
     DataContainerArray();
 
@@ -742,6 +771,47 @@ class SIMPLib_EXPORT DataContainerArray : public QObject
     QList<DataContainerShPtr>  m_Array;
     QMap<QString, IDataContainerBundle::Pointer> m_DataContainerBundles;
 
+    /**
+     * @brief The RecordingScope class records a single access and suppresses the coarser records
+     * made by the lookups nested inside it
+     */
+    class RecordingScope
+    {
+    public:
+      RecordingScope(DataContainerArray* dca, const DataArrayPath& path)
+      : m_Dca(dca->beginRecordingScope(path) ? dca : nullptr)
+      {
+      }
+      ~RecordingScope()
+      {
+        if(nullptr != m_Dca)
+        {
+          m_Dca->endRecordingScope();
+        }
+      }
+
+    private:
+      DataContainerArray* m_Dca;
+    };
+
+    /**
+     * @brief recordAccess Appends the path to the access recorder of the calling thread, if one is set
+     * @param path
+     */
+    void recordAccess(const DataArrayPath& path);
+
+    /**
+     * @brief beginRecordingScope Records the path and suppresses the records of nested lookups
+     * @param path
+     * @return false if the calling thread is not recording accesses to this DataContainerArray
+     */
+    bool beginRecordingScope(const DataArrayPath& path);
+
+    /**
+     * @brief endRecordingScope Ends a scope started by beginRecordingScope()
+     */
+    void endRecordingScope();
+
     DataContainerArray(const DataContainerArray&) = delete; // Copy Constructor Not Implemented
     void operator=(const DataContainerArray&) = delete;     // Move assignment Not Implemented
 };
@@ -483,6 +483,31 @@ DataContainerProxy& DataContainerArrayProxy::getDataContainerProxy(const QString
   return dataContainers[name];
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataContainerArrayProxy::setImageGeomSubVolume(const QString& name, const QVector<size_t>& offset, const QVector<size_t>& dims)
+{
+  if(!dataContainers.contains(name))
+  {
+    return false;
+  }
+  DataContainerProxy& dcProxy = dataContainers[name];
+  if(offset.isEmpty() && dims.isEmpty())
+  {
+    dcProxy.subVolumeOffset.clear();
+    dcProxy.subVolumeDims.clear();
+    return true;
+  }
+  if(offset.size() != 3 || dims.size() != 3)
+  {
+    return false;
+  }
+  dcProxy.subVolumeOffset = offset;
+  dcProxy.subVolumeDims = dims;
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
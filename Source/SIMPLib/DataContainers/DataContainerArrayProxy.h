@@ -166,6 +166,17 @@ class SIMPLib_EXPORT DataContainerArrayProxy
      */
     DataContainerProxy& getDataContainerProxy(const QString& name);
 
+    /**
+     * @brief setImageGeomSubVolume Restricts the reading of the Image Geometry DataContainer
+     * with the given name to a block of voxels. Passing empty vectors clears the selection
+     * so the whole volume is read again.
+     * @param name The name of the DataContainer.
+     * @param offset The first voxel index along X, Y and Z
+     * @param dims The number of voxels along X, Y and Z
+     * @return false if the DataContainer does not exist or the vectors are not 3 long
+     */
+    bool setImageGeomSubVolume(const QString& name, const QVector<size_t>& offset, const QVector<size_t>& dims);
+
     /**
      * @brief Updates the proxy to match a renamed DataArrayPath
      * @param renamePath
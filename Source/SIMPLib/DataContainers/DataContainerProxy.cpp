@@ -62,6 +62,8 @@ DataContainerProxy::DataContainerProxy(const DataContainerProxy& amp)
   name = amp.name;
   dcType = amp.dcType;
   attributeMatricies = amp.attributeMatricies;
+  subVolumeOffset = amp.subVolumeOffset;
+  subVolumeDims = amp.subVolumeDims;
 }
 
 // -----------------------------------------------------------------------------
@@ -74,7 +76,16 @@ DataContainerProxy& DataContainerProxy::operator=(const DataContainerProxy& amp)
 // -----------------------------------------------------------------------------
 bool DataContainerProxy::operator==(const DataContainerProxy& amp) const
 {
-  return flag == amp.flag && name == amp.name && dcType == amp.dcType && attributeMatricies == amp.attributeMatricies;
+  return flag == amp.flag && name == amp.name && dcType == amp.dcType && attributeMatricies == amp.attributeMatricies && subVolumeOffset == amp.subVolumeOffset &&
+         subVolumeDims == amp.subVolumeDims;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataContainerProxy::hasSubVolume() const
+{
+  return subVolumeOffset.size() == 3 && subVolumeDims.size() == 3;
 }
 
 // -----------------------------------------------------------------------------
@@ -108,6 +119,18 @@ void DataContainerProxy::writeJson(QJsonObject& json)
   json["Name"] = name;
   json["Type"] = static_cast<double>(dcType);
   json["Attribute Matricies"] = writeMap(attributeMatricies);
+  if(hasSubVolume())
+  {
+    QJsonArray offsetArray;
+    QJsonArray dimsArray;
+    for(int i = 0; i < 3; i++)
+    {
+      offsetArray.push_back(static_cast<double>(subVolumeOffset[i]));
+      dimsArray.push_back(static_cast<double>(subVolumeDims[i]));
+    }
+    json["Sub Volume Offset"] = offsetArray;
+    json["Sub Volume Dimensions"] = dimsArray;
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -127,6 +150,21 @@ bool DataContainerProxy::readJson(QJsonObject& json)
       dcType = static_cast<unsigned int>(json["Type"].toDouble());
     }
     attributeMatricies = readMap(json["Attribute Matricies"].toArray());
+    subVolumeOffset.clear();
+    subVolumeDims.clear();
+    if(json["Sub Volume Offset"].isArray() && json["Sub Volume Dimensions"].isArray())
+    {
+      QJsonArray offsetArray = json["Sub Volume Offset"].toArray();
+      QJsonArray dimsArray = json["Sub Volume Dimensions"].toArray();
+      if(offsetArray.size() == 3 && dimsArray.size() == 3)
+      {
+        for(int i = 0; i < 3; i++)
+        {
+          subVolumeOffset.push_back(static_cast<size_t>(offsetArray[i].toDouble()));
+          subVolumeDims.push_back(static_cast<size_t>(dimsArray[i].toDouble()));
+        }
+      }
+    }
     return true;
   }
   return false;
@@ -40,6 +40,7 @@
 #include <QtCore/QString>
 #include <QtCore/QMap>
 #include <QtCore/QJsonArray>
+#include <QtCore/QVector>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
@@ -143,12 +144,24 @@ class SIMPLib_EXPORT DataContainerProxy
      */
     void updatePath(DataArrayPath::RenameType renamePath);
 
+    /**
+     * @brief Returns true if only a sub-volume of an Image Geometry should be read
+     * from the file. See subVolumeOffset and subVolumeDims.
+     * @return
+     */
+    bool hasSubVolume() const;
+
     //----- Our variables, publicly available
     uint8_t flag;
     QString name;
     unsigned int dcType;
     QMap<QString, AttributeMatrixProxy> attributeMatricies;
 
+    // Optional voxel selection (XYZ order) for Image Geometry data containers. When
+    // set, only this block of the Cell AttributeMatrices is read from the file.
+    QVector<size_t> subVolumeOffset;
+    QVector<size_t> subVolumeDims;
+
   private:
 
     /**
@@ -35,21 +35,174 @@
 
 #include "FilterPipeline.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_arena.h>
+#endif
+
 #include "SIMPLib/CoreFilters/EmptyFilter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 
 #include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/DataArrays/DataArrayStorage.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/DataContainerReaderFilterParameter.h"
+#include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
+#include "SIMPLib/FilterParameters/ImportHDF5DatasetFilterParameter.h"
+#include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/InputPathFilterParameter.h"
+#include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/OutputPathFilterParameter.h"
+#include "SIMPLib/FilterParameters/ReadASCIIDataFilterParameter.h"
 #include "SIMPLib/Utilities/StringOperations.h"
 
+namespace
+{
+// -----------------------------------------------------------------------------
+// Two paths overlap when one of them is an ancestor of (or equal to) the other.
+// An empty path stands for the whole DataContainerArray.
+// -----------------------------------------------------------------------------
+bool PathsOverlap(const DataArrayPath& a, const DataArrayPath& b)
+{
+  if(a.getDataContainerName().isEmpty() || b.getDataContainerName().isEmpty())
+  {
+    return true;
+  }
+  if(a.getDataContainerName() != b.getDataContainerName())
+  {
+    return false;
+  }
+  if(a.getAttributeMatrixName().isEmpty() || b.getAttributeMatrixName().isEmpty())
+  {
+    return true;
+  }
+  if(a.getAttributeMatrixName() != b.getAttributeMatrixName())
+  {
+    return false;
+  }
+  if(a.getDataArrayName().isEmpty() || b.getDataArrayName().isEmpty())
+  {
+    return true;
+  }
+  return a.getDataArrayName() == b.getDataArrayName();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FootprintsOverlap(const QVector<DataArrayPath>& a, const QVector<DataArrayPath>& b)
+{
+  for(const DataArrayPath& pathA : a)
+  {
+    for(const DataArrayPath& pathB : b)
+    {
+      if(PathsOverlap(pathA, pathB))
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+// A footprint contains a path when one of its paths is an ancestor of (or equal to) it
+// -----------------------------------------------------------------------------
+bool FootprintContains(const QVector<DataArrayPath>& footprint, const DataArrayPath& path)
+{
+  for(const DataArrayPath& declared : footprint)
+  {
+    if(declared.getDataContainerName().isEmpty())
+    {
+      return true;
+    }
+    if(declared.getDataContainerName() != path.getDataContainerName())
+    {
+      continue;
+    }
+    if(declared.getAttributeMatrixName().isEmpty())
+    {
+      return true;
+    }
+    if(declared.getAttributeMatrixName() != path.getAttributeMatrixName())
+    {
+      continue;
+    }
+    if(declared.getDataArrayName().isEmpty() || declared.getDataArrayName() == path.getDataArrayName())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+// Filters that read or write files are recognized by their file system parameters
+// -----------------------------------------------------------------------------
+bool UsesFileSystem(const AbstractFilter::Pointer& filter)
+{
+  for(const FilterParameter::Pointer& parameter : filter->getFilterParameters())
+  {
+    FilterParameter* fp = parameter.get();
+    if(nullptr != dynamic_cast<InputFileFilterParameter*>(fp) || nullptr != dynamic_cast<InputPathFilterParameter*>(fp) || nullptr != dynamic_cast<OutputFileFilterParameter*>(fp) ||
+       nullptr != dynamic_cast<OutputPathFilterParameter*>(fp) || nullptr != dynamic_cast<DataContainerReaderFilterParameter*>(fp) || nullptr != dynamic_cast<FileListInfoFilterParameter*>(fp) ||
+       nullptr != dynamic_cast<ImportHDF5DatasetFilterParameter*>(fp) || nullptr != dynamic_cast<ReadASCIIDataFilterParameter*>(fp))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+// -----------------------------------------------------------------------------
+// A preflight footprint is complete only if it contains every DataArrayPath the filter's
+// parameters select. A filter that skipped one of them during preflight may still touch
+// it during execution, so it can not be scheduled on its footprint alone.
+// -----------------------------------------------------------------------------
+bool FootprintCoversParameters(const AbstractFilter::Pointer& filter, const QVector<DataArrayPath>& footprint)
+{
+  const int pathType = qMetaTypeId<DataArrayPath>();
+  const int pathVectorType = qMetaTypeId<QVector<DataArrayPath>>();
+  for(const FilterParameter::Pointer& parameter : filter->getFilterParameters())
+  {
+    QVariant value = filter->property(parameter->getPropertyName().toLatin1().constData());
+    QVector<DataArrayPath> paths;
+    if(value.userType() == pathType)
+    {
+      paths.push_back(value.value<DataArrayPath>());
+    }
+    else if(value.userType() == pathVectorType)
+    {
+      paths = value.value<QVector<DataArrayPath>>();
+    }
+    for(const DataArrayPath& path : paths)
+    {
+      if(!path.getDataContainerName().isEmpty() && !FootprintContains(footprint, path))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 FilterPipeline::FilterPipeline()
 : QObject()
 , m_ErrorCondition(0)
+, m_DataflowExecution(false)
+, m_Profiler(nullptr)
 , m_Cancel(false)
+, m_DataflowRunning(false)
 , m_PipelineName("")
 , m_Dca(nullptr)
 {
@@ -278,7 +431,15 @@ void FilterPipeline::fromJson(const QJsonObject& json, IObserver* obs)
 void FilterPipeline::setCancel(bool value)
 {
   this->m_Cancel = value;
-  if(nullptr != m_CurrentFilter.get())
+  if(m_DataflowRunning)
+  {
+    // Several filters may be executing at once, so every one of them needs the flag
+    for(const AbstractFilter::Pointer& filter : m_Pipeline)
+    {
+      filter->setCancel(value);
+    }
+  }
+  else if(nullptr != m_CurrentFilter.get())
   {
     m_CurrentFilter->setCancel(value);
   }
@@ -515,18 +676,87 @@ void FilterPipeline::disconnectFilterNotifications(QObject* filter)
 // -----------------------------------------------------------------------------
 int FilterPipeline::preflightPipeline()
 {
-  // Create the DataContainer object
-  DataContainerArray::Pointer dca = DataContainerArray::New();
+  PreflightCache cache;
+  return incrementalPreflightPipeline(cache);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::isSnapshotCurrent(const PreflightSnapshot& snapshot, const AbstractFilter::Pointer& filter)
+{
+  if(snapshot.filter.lock() != filter || snapshot.enabled != filter->getEnabled())
+  {
+    return false;
+  }
+  return snapshot.parameters == filter->toJson();
+}
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int FilterPipeline::incrementalPreflightPipeline(PreflightCache& cache, const std::atomic<bool>* cancel)
+{
   setErrorCondition(0);
   int preflightError = 0;
 
+  // Find the first filter that was edited, moved or toggled since the cache was recorded
+  int count = m_Pipeline.size();
+  int startIndex = 0;
+  while(startIndex < count && startIndex < cache.size() && isSnapshotCurrent(cache[startIndex], m_Pipeline[startIndex]))
+  {
+    startIndex++;
+  }
+  cache.resize(startIndex);
+
+  // Create the DataContainer object
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+
   DataArrayPath::RenameContainer renamedPaths;
   DataArrayPath::RenameContainer filterRenamedPaths;
 
-  // Start looping through each filter in the Pipeline and preflight everything
-  for(FilterContainerType::iterator filter = m_Pipeline.begin(); filter != m_Pipeline.end(); ++filter)
+  // Restore the unchanged filters and pick up the preflight where the last of them left off
+  for(int i = 0; i < startIndex; i++)
   {
+    const PreflightSnapshot& snapshot = cache[i];
+    AbstractFilter::Pointer filter = m_Pipeline[i];
+    filter->setErrorCondition(snapshot.errorCondition);
+    filter->setWarningCondition(snapshot.warningCondition);
+    if(filter->getDataContainerArray() != snapshot.dca)
+    {
+      filter->setDataContainerArray(snapshot.dca);
+    }
+    connectFilterNotifications(filter.get());
+    for(const PipelineMessage& msg : snapshot.messages)
+    {
+      filter->broadcastPipelineMessage(msg);
+    }
+    disconnectFilterNotifications(filter.get());
+    if(snapshot.enabled)
+    {
+      preflightError |= snapshot.errorCondition;
+    }
+  }
+  if(startIndex > 0)
+  {
+    const PreflightSnapshot& snapshot = cache[startIndex - 1];
+    dca = snapshot.dca->deepCopy(false);
+    renamedPaths = snapshot.renamedPaths;
+    filterRenamedPaths = snapshot.filterRenamedPaths;
+  }
+
+  // Loop through each remaining filter in the Pipeline and preflight everything
+  for(FilterContainerType::iterator filter = m_Pipeline.begin() + startIndex; filter != m_Pipeline.end(); ++filter)
+  {
+    if(nullptr != cancel && *cancel)
+    {
+      break;
+    }
+
+    PreflightSnapshot snapshot;
+    QVector<PipelineMessage>* messages = &snapshot.messages;
+    QMetaObject::Connection recorder = connect((*filter).get(), &Observable::filterGeneratedMessage, [messages](const PipelineMessage& msg) { messages->push_back(msg); });
+
     // Do not preflight disabled filters
     if((*filter)->getEnabled())
     {
@@ -611,6 +841,17 @@ int FilterPipeline::preflightPipeline()
         renamedPaths.push_back(renameType);
       }
     }
+
+    disconnect(recorder);
+    snapshot.filter = *filter;
+    snapshot.parameters = (*filter)->toJson();
+    snapshot.enabled = (*filter)->getEnabled();
+    snapshot.errorCondition = (*filter)->getErrorCondition();
+    snapshot.warningCondition = (*filter)->getWarningCondition();
+    snapshot.dca = (*filter)->getDataContainerArray();
+    snapshot.renamedPaths = renamedPaths;
+    snapshot.filterRenamedPaths = filterRenamedPaths;
+    cache.push_back(snapshot);
   }
   setCurrentFilter(AbstractFilter::NullPointer());
 
@@ -622,6 +863,18 @@ int FilterPipeline::preflightPipeline()
 // -----------------------------------------------------------------------------
 DataContainerArray::Pointer FilterPipeline::execute()
 {
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(m_DataflowExecution && nullptr == m_Profiler.get())
+  {
+    QVector<QVector<int>> predecessors;
+    QVector<QVector<DataArrayPath>> footprints;
+    if(buildDataflowGraph(predecessors, footprints))
+    {
+      return executeDataflow(predecessors);
+    }
+  }
+#endif
+
   int err = 0;
 
   // Clear pipeline cancel state
@@ -663,7 +916,19 @@ DataContainerArray::Pointer FilterPipeline::execute()
       connectFilterNotifications(filt.get());
       filt->setDataContainerArray(m_Dca);
       setCurrentFilter(*filter);
-      filt->execute();
+      // Pointers fetched by the filters that already ran are not written through any more
+      DataArrayStorage::ReleaseWritablePointers();
+      if(nullptr != m_Profiler.get())
+      {
+        m_Profiler->beginFilter(filt.get(), m_Dca);
+        filt->execute();
+        m_Profiler->endFilter(filt.get(), m_Dca);
+      }
+      else
+      {
+        filt->execute();
+      }
+      filt->flushProgressMessage();
       disconnectFilterNotifications((*filter).get());
       filt->setDataContainerArray(DataContainerArray::NullPointer());
       err = filt->getErrorCondition();
@@ -708,6 +973,338 @@ DataContainerArray::Pointer FilterPipeline::execute()
   return m_Dca;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::buildDataflowGraph(QVector<QVector<int>>& predecessors, QVector<QVector<DataArrayPath>>& footprints)
+{
+  const int count = m_Pipeline.size();
+  predecessors.clear();
+  predecessors.resize(count);
+  footprints.clear();
+  footprints.resize(count);
+
+  // Preflight every enabled filter against a scratch DataContainerArray and record
+  // the paths it looks up, creates or removes. Those paths are the filter's footprint.
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  int enabledCount = 0;
+  bool valid = true;
+  for(int i = 0; i < count && valid; i++)
+  {
+    AbstractFilter::Pointer filter = m_Pipeline[i];
+    if(!filter->getEnabled())
+    {
+      continue;
+    }
+    enabledCount++;
+    filter->setDataContainerArray(dca);
+    QVector<DataArrayPath>* previous = dca->setAccessRecorder(&footprints[i]);
+    filter->preflight();
+    dca->setAccessRecorder(previous);
+    filter->setDataContainerArray(DataContainerArray::NullPointer());
+    filter->setCancel(false);
+    if(filter->getErrorCondition() < 0)
+    {
+      valid = false;
+    }
+    // A filter that reads or writes files depends on every filter that touches the same
+    // files, which the footprint cannot see. The same holds for a filter that never went
+    // through the DataContainerArray or whose footprint misses one of the paths it was
+    // given, so all of them are treated as barriers. Arrays read on demand from a file
+    // are loaded by whichever filter touches them first; those reads take the HDF5 lock
+    // of H5LazyFileHandle, and the barriers keep the other HDF5 readers and writers
+    // from running next to them.
+    if(footprints[i].isEmpty() || UsesFileSystem(filter) || !FootprintCoversParameters(filter, footprints[i]))
+    {
+      footprints[i].push_back(DataArrayPath());
+    }
+  }
+
+  if(!valid || enabledCount < 2)
+  {
+    return false;
+  }
+
+  // A filter depends on every earlier filter whose footprint overlaps its own
+  for(int i = 0; i < count; i++)
+  {
+    if(!m_Pipeline[i]->getEnabled())
+    {
+      continue;
+    }
+    for(int j = 0; j < i; j++)
+    {
+      if(m_Pipeline[j]->getEnabled() && FootprintsOverlap(footprints[i], footprints[j]))
+      {
+        predecessors[i].push_back(j);
+      }
+    }
+  }
+  return true;
+}
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer FilterPipeline::executeDataflow(const QVector<QVector<int>>& predecessors)
+{
+  // Clear pipeline cancel state
+  setCancel(false);
+
+  connectSignalsSlots();
+
+  m_Dca = DataContainerArray::New();
+
+  // Connect this object to anything that wants to know about PipelineMessages
+  for(int i = 0; i < m_MessageReceivers.size(); i++)
+  {
+    connect(this, SIGNAL(pipelineGeneratedMessage(const PipelineMessage&)), m_MessageReceivers.at(i), SLOT(processPipelineMessage(const PipelineMessage&)));
+  }
+
+  const std::vector<AbstractFilter::Pointer> filters(m_Pipeline.begin(), m_Pipeline.end());
+  const int count = static_cast<int>(filters.size());
+
+  std::vector<QVector<int>> successors(count);
+  std::vector<int> pending(count, 0);
+  for(int i = 0; i < count; i++)
+  {
+    pending[i] = predecessors[i].size();
+    for(int p : predecessors[i])
+    {
+      successors[p].push_back(i);
+    }
+  }
+
+  // The worker threads queue what happens to each filter and this thread forwards it
+  // to the observers in pipeline order, see the event loop below.
+  std::mutex mutex;
+  std::condition_variable eventCondition;
+  std::deque<DataflowEvent> events;
+
+  std::vector<QMetaObject::Connection> connections(count);
+  for(int i = 0; i < count; i++)
+  {
+    AbstractFilter::Pointer filt = filters[i];
+    QString ss = QObject::tr("[%1/%2] %3 ").arg(i + 1).arg(count).arg(filt->getHumanLabel());
+    filt->setMessagePrefix(ss);
+    filt->setDataContainerArray(m_Dca);
+    connections[i] = connect(filt.get(), &Observable::filterGeneratedMessage, [i, &mutex, &events, &eventCondition](const PipelineMessage& msg) {
+      std::lock_guard<std::mutex> lock(mutex);
+      events.push_back({DataflowEvent::Type::Message, i, msg});
+      eventCondition.notify_all();
+    });
+  }
+
+  std::vector<int> errors(count, 0);
+  int running = 0;
+  int firstError = count;
+
+  tbb::task_arena arena;
+  std::function<void(int)> schedule;
+  std::function<void(int)> markFinished;
+  std::function<void(int)> runFilter;
+
+  // schedule() and markFinished() must be called with the mutex held
+  markFinished = [&](int index) {
+    events.push_back({DataflowEvent::Type::Finished, index, PipelineMessage()});
+    eventCondition.notify_all();
+    if(errors[index] < 0)
+    {
+      return;
+    }
+    for(int successor : successors[index])
+    {
+      if(--pending[successor] == 0)
+      {
+        schedule(successor);
+      }
+    }
+  };
+  schedule = [&](int index) {
+    // Nothing past the first failing filter would have run serially
+    if(index >= firstError || getCancel())
+    {
+      return;
+    }
+    if(!filters[index]->getEnabled())
+    {
+      events.push_back({DataflowEvent::Type::Started, index, PipelineMessage()});
+      markFinished(index);
+      return;
+    }
+    running++;
+    arena.enqueue([&runFilter, index]() { runFilter(index); });
+  };
+  runFilter = [&](int index) {
+    AbstractFilter::Pointer filt = filters[index];
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      events.push_back({DataflowEvent::Type::Started, index, PipelineMessage()});
+      eventCondition.notify_all();
+    }
+
+    // Filters running at the same time never write an array another one reads, so the
+    // pointers they hold can not change values shared by a copy made here
+    DataArrayStorage::ReleaseWritablePointers();
+    filt->execute();
+    filt->flushProgressMessage();
+    filt->setDataContainerArray(DataContainerArray::NullPointer());
+    int err = filt->getErrorCondition();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    running--;
+    errors[index] = err;
+    if(err < 0)
+    {
+      firstError = std::min(firstError, index);
+    }
+    markFinished(index);
+  };
+
+  m_DataflowRunning = true;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    for(int i = 0; i < count; i++)
+    {
+      if(pending[i] == 0)
+      {
+        schedule(i);
+      }
+    }
+  }
+
+  int failedIndex = count;
+  PipelineMessage progValue("", "", 0, PipelineMessage::MessageType::ProgressValue, -1);
+  auto forwardEvent = [&](const DataflowEvent& event) {
+    AbstractFilter::Pointer filt = filters[event.index];
+    if(event.type == DataflowEvent::Type::Started)
+    {
+      setCurrentFilter(filt);
+      progValue.setType(PipelineMessage::MessageType::ProgressValue);
+      progValue.setProgressValue(static_cast<int>(static_cast<float>(event.index + 1) / (count + 1) * 100.0f));
+      emit pipelineGeneratedMessage(progValue);
+
+      QString ss = QObject::tr("[%1/%2] %3 ").arg(event.index + 1).arg(count).arg(filt->getHumanLabel());
+      progValue.setType(PipelineMessage::MessageType::StatusMessage);
+      progValue.setText(ss);
+      emit pipelineGeneratedMessage(progValue);
+      emit filt->filterInProgress(filt.get());
+    }
+    else if(event.type == DataflowEvent::Type::Message)
+    {
+      emit pipelineGeneratedMessage(event.message);
+    }
+    else if(filt->getEnabled() && errors[event.index] < 0)
+    {
+      failedIndex = event.index;
+      progValue.setFilterClassName(filt->getNameOfClass());
+      progValue.setFilterHumanLabel(filt->getHumanLabel());
+      progValue.setType(PipelineMessage::MessageType::Error);
+      progValue.setProgressValue(100);
+      QString ss = QObject::tr("[%1/%2] %3 caused an error during execution.").arg(event.index + 1).arg(count).arg(filt->getHumanLabel());
+      progValue.setText(ss);
+      progValue.setPipelineIndex(filt->getPipelineIndex());
+      progValue.setCode(errors[event.index]);
+      emit pipelineGeneratedMessage(progValue);
+      emit filt->filterCompleted(filt.get());
+    }
+    else
+    {
+      // Emit that the filter is completed for those objects that care, even the disabled ones.
+      emit filt->filterCompleted(filt.get());
+    }
+  };
+
+  // Each filter's events are buffered and released in pipeline order: the events of filter
+  // i are only forwarded once every filter before it has been forwarded up to its Finished
+  // event. The observers therefore see the same sequence as a serial execution, while the
+  // earliest unfinished filter still reports its progress live. Nothing past the first
+  // failing filter is forwarded, just as it would never have run serially.
+  std::vector<std::vector<DataflowEvent>> buffered(count);
+  int released = 0;
+  auto releaseEvents = [&]() {
+    while(released < count && failedIndex == count)
+    {
+      bool finished = false;
+      for(const DataflowEvent& event : buffered[released])
+      {
+        forwardEvent(event);
+        finished = (event.type == DataflowEvent::Type::Finished);
+        if(failedIndex < count)
+        {
+          break;
+        }
+      }
+      buffered[released].clear();
+      if(!finished)
+      {
+        return;
+      }
+      released++;
+    }
+  };
+
+  // Collect the events until every scheduled filter has finished
+  while(true)
+  {
+    std::deque<DataflowEvent> batch;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      eventCondition.wait(lock, [&]() { return !events.empty() || running == 0; });
+      if(events.empty())
+      {
+        break;
+      }
+      batch.swap(events);
+    }
+
+    for(const DataflowEvent& event : batch)
+    {
+      buffered[event.index].push_back(event);
+    }
+    releaseEvents();
+  }
+
+  // A cancel leaves filters that were never scheduled in front of ones that ran; forward
+  // what the later ones reported, still in pipeline order.
+  for(; released < count && failedIndex == count; released++)
+  {
+    for(const DataflowEvent& event : buffered[released])
+    {
+      forwardEvent(event);
+    }
+  }
+  m_DataflowRunning = false;
+
+  for(int i = 0; i < count; i++)
+  {
+    disconnect(connections[i]);
+    filters[i]->setDataContainerArray(DataContainerArray::NullPointer());
+    // Clear cancel filter state
+    filters[i]->setCancel(false);
+  }
+
+  bool failed = (failedIndex < count);
+  if(failed)
+  {
+    setErrorCondition(errors[failedIndex]);
+  }
+
+  emit pipelineFinished();
+
+  disconnectSignalsSlots();
+
+  if(!failed)
+  {
+    PipelineMessage completeMessage("", "Pipeline Complete", 0, PipelineMessage::MessageType::StatusMessage, -1);
+    emit pipelineGeneratedMessage(completeMessage);
+  }
+
+  return m_Dca;
+}
+#endif
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
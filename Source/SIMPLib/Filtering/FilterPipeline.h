@@ -35,6 +35,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <vector>
+
 #include <QtCore/QJsonObject>
 #include <QtCore/QList>
 #include <QtCore/QObject>
@@ -44,6 +47,7 @@
 #include "SIMPLib/Common/Observer.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/PipelineProfiler.h"
 #include "SIMPLib/SIMPLib.h"
 
 class IObserver;
@@ -66,6 +70,7 @@ class SIMPLib_EXPORT FilterPipeline : public QObject
   PYB11_PROPERTY(AbstractFilter CurrentFilter READ getCurrentFilter WRITE setCurrentFilter)
   PYB11_PROPERTY(bool Cancel READ getCancel WRITE setCancel)
   PYB11_PROPERTY(QString Name READ getName WRITE setName)
+  PYB11_PROPERTY(bool DataflowExecution READ getDataflowExecution WRITE setDataflowExecution)
   
   PYB11_METHOD(DataContainerArray::Pointer run)
   PYB11_METHOD(void preflightPipeline)
@@ -87,9 +92,40 @@ public:
 
   typedef QList<AbstractFilter::Pointer> FilterContainerType;
 
+  /**
+   * @brief The PreflightSnapshot struct holds the preflight state of the pipeline right after
+   * one filter was preflighted, along with what is needed to tell whether that filter changed since.
+   */
+  struct PreflightSnapshot
+  {
+    AbstractFilter::WeakPointer filter;
+    QJsonObject parameters;
+    bool enabled = true;
+    int errorCondition = 0;
+    int warningCondition = 0;
+    QVector<PipelineMessage> messages;
+    DataContainerArray::Pointer dca;
+    DataArrayPath::RenameContainer renamedPaths;
+    DataArrayPath::RenameContainer filterRenamedPaths;
+  };
+  using PreflightCache = QVector<PreflightSnapshot>;
+
   SIMPL_INSTANCE_PROPERTY(int, ErrorCondition)
   SIMPL_INSTANCE_PROPERTY(AbstractFilter::Pointer, CurrentFilter)
 
+  /**
+   * @brief When enabled, execute() schedules filters that touch disjoint parts of the
+   * DataContainerArray concurrently. Messages are still delivered in pipeline order. The
+   * mode is opt-in and falls back to serial execution whenever the pipeline does not preflight.
+   */
+  SIMPL_INSTANCE_PROPERTY(bool, DataflowExecution)
+
+  /**
+   * @brief When a profiler is set, execute() records the statistics of every executed filter into it.
+   * Profiled pipelines always run their filters one after another so the numbers can be attributed.
+   */
+  SIMPL_INSTANCE_PROPERTY(PipelineProfiler::Pointer, Profiler)
+
   /**
    * @brief Cancel the operation
    */
@@ -108,6 +144,17 @@ public:
    */
   virtual int preflightPipeline();
 
+  /**
+   * @brief Incremental version of preflightPipeline(). Filters at the front of the pipeline that are
+   * unchanged since the cache was recorded are not preflighted again; their results are restored from
+   * the cache and preflighting resumes from the first filter that was edited, moved or toggled.
+   * @param cache Snapshots from the previous call. Updated on return.
+   * @param cancel Optional flag polled between filters so another thread can abandon a stale preflight.
+   * The cache only holds the filters that completed when the preflight stops early.
+   * @return
+   */
+  virtual int incrementalPreflightPipeline(PreflightCache& cache, const std::atomic<bool>* cancel = nullptr);
+
   /**
    * @brief
    */
@@ -225,7 +272,8 @@ signals:
   void pipelineNameChanged(QString oldName, QString newName);
 
 private:
-  bool m_Cancel;
+  std::atomic<bool> m_Cancel;
+  std::atomic<bool> m_DataflowRunning;
   FilterContainerType m_Pipeline;
   QString m_PipelineName;
 
@@ -236,6 +284,51 @@ private:
   void connectSignalsSlots();
   void disconnectSignalsSlots();
 
+  /**
+   * @brief Returns true if the snapshot was recorded for this filter with its current parameters
+   * @param snapshot
+   * @param filter
+   * @return
+   */
+  bool isSnapshotCurrent(const PreflightSnapshot& snapshot, const AbstractFilter::Pointer& filter);
+
+  /**
+   * @brief The DataflowEvent struct is something that happened to a filter during a dataflow
+   * execution, queued by the worker thread and forwarded to the observers by the pipeline thread
+   * in pipeline order
+   */
+  struct DataflowEvent
+  {
+    enum class Type
+    {
+      Started,
+      Message,
+      Finished
+    };
+    Type type;
+    int index;
+    PipelineMessage message;
+  };
+
+  /**
+   * @brief Preflights the enabled filters while recording which DataArrayPaths each one
+   * touches and derives, for every filter, the earlier filters it must wait for. Filters
+   * that read or write files, or whose footprint misses a path selected by one of their
+   * parameters, wait for, and are waited on by, every other filter.
+   * @param predecessors Output list of predecessor indices for each filter
+   * @param footprints Output list of the paths each filter touched during preflight
+   * @return False if the pipeline cannot be scheduled out of order
+   */
+  bool buildDataflowGraph(QVector<QVector<int>>& predecessors, QVector<QVector<DataArrayPath>>& footprints);
+
+  /**
+   * @brief Executes the pipeline by running each filter as soon as its predecessors finish.
+   * The observers receive the messages of each filter in pipeline order.
+   * @param predecessors Dependency lists produced by buildDataflowGraph()
+   * @return
+   */
+  DataContainerArray::Pointer executeDataflow(const QVector<QVector<int>>& predecessors);
+
   FilterPipeline(const FilterPipeline&) = delete; // Copy Constructor Not Implemented
   void operator=(const FilterPipeline&) = delete; // Move assignment Not Implemented
 };
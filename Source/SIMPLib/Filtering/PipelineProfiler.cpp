@@ -0,0 +1,439 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineProfiler.h"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#include <sys/time.h>
+#endif
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+namespace
+{
+thread_local PipelineProfiler* s_CurrentProfiler = nullptr;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ProcessCpuSeconds()
+{
+#ifdef _WIN32
+  FILETIME creationTime, exitTime, kernelTime, userTime;
+  if(GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime) == 0)
+  {
+    return 0.0;
+  }
+  ULARGE_INTEGER kernel;
+  kernel.LowPart = kernelTime.dwLowDateTime;
+  kernel.HighPart = kernelTime.dwHighDateTime;
+  ULARGE_INTEGER user;
+  user.LowPart = userTime.dwLowDateTime;
+  user.HighPart = userTime.dwHighDateTime;
+  // FILETIME counts 100 nanosecond intervals
+  return static_cast<double>(kernel.QuadPart + user.QuadPart) * 1.0E-7;
+#else
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0.0;
+  }
+  return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) + static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1.0E-6;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// Bytes the process has read and written so far, or zero where the OS does not
+// expose the counters.
+// -----------------------------------------------------------------------------
+void ProcessIoBytes(uint64_t& bytesRead, uint64_t& bytesWritten)
+{
+  bytesRead = 0;
+  bytesWritten = 0;
+#if defined(_WIN32)
+  IO_COUNTERS counters;
+  if(GetProcessIoCounters(GetCurrentProcess(), &counters) != 0)
+  {
+    bytesRead = counters.ReadTransferCount;
+    bytesWritten = counters.WriteTransferCount;
+  }
+#elif defined(__linux__)
+  std::ifstream in("/proc/self/io");
+  std::string key;
+  uint64_t value = 0;
+  while(in >> key >> value)
+  {
+    if(key == "rchar:")
+    {
+      bytesRead = value;
+    }
+    else if(key == "wchar:")
+    {
+      bytesWritten = value;
+    }
+  }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t ArrayBytes(const IDataArray::Pointer& array)
+{
+  if(nullptr == array.get())
+  {
+    return 0;
+  }
+  return static_cast<uint64_t>(array->getSize()) * static_cast<uint64_t>(array->getTypeSize());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t AttributeMatrixBytes(const AttributeMatrix::Pointer& am)
+{
+  uint64_t bytes = 0;
+  if(nullptr == am.get())
+  {
+    return bytes;
+  }
+  QList<QString> names = am->getAttributeArrayNames();
+  for(const QString& name : names)
+  {
+    bytes += ArrayBytes(am->getAttributeArray(name));
+  }
+  return bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t DataContainerBytes(const DataContainer::Pointer& dc)
+{
+  uint64_t bytes = 0;
+  if(nullptr == dc.get())
+  {
+    return bytes;
+  }
+  DataContainer::AttributeMatrixMap_t& matrices = dc->getAttributeMatrices();
+  for(DataContainer::AttributeMatrixMap_t::iterator iter = matrices.begin(); iter != matrices.end(); ++iter)
+  {
+    bytes += AttributeMatrixBytes(iter.value());
+  }
+  return bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t PathBytes(const DataContainerArray::Pointer& dca, const DataArrayPath& path)
+{
+  if(path.getAttributeMatrixName().isEmpty())
+  {
+    return DataContainerBytes(dca->getDataContainer(path.getDataContainerName()));
+  }
+  AttributeMatrix::Pointer am = dca->getAttributeMatrix(path);
+  if(path.getDataArrayName().isEmpty())
+  {
+    return AttributeMatrixBytes(am);
+  }
+  return (nullptr != am.get()) ? ArrayBytes(am->getAttributeArray(path.getDataArrayName())) : 0;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfiler::PipelineProfiler() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfiler::~PipelineProfiler() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProfiler::clear()
+{
+  m_Records.clear();
+  m_BoundaryPeakBytes = 0;
+  m_ScopeDepth = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProfiler::beginFilter(AbstractFilter* filter, const DataContainerArray::Pointer& dca)
+{
+  FilterRecord record;
+  record.pipelineIndex = filter->getPipelineIndex();
+  record.filterClassName = filter->getNameOfClass();
+  record.humanLabel = filter->getHumanLabel();
+  m_Records.push_back(record);
+
+  m_ScopeDepth = 0;
+  m_FilterStartBytes = TotalArrayBytes(dca);
+  m_BoundaryPeakBytes = std::max(m_BoundaryPeakBytes, m_FilterStartBytes);
+  ProcessIoBytes(m_FilterStartRead, m_FilterStartWritten);
+  m_FilterStartCpu = ProcessCpuSeconds();
+  m_FilterStart = std::chrono::steady_clock::now();
+  s_CurrentProfiler = this;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProfiler::endFilter(AbstractFilter* filter, const DataContainerArray::Pointer& dca)
+{
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  double cpu = ProcessCpuSeconds();
+  uint64_t bytesRead = 0;
+  uint64_t bytesWritten = 0;
+  ProcessIoBytes(bytesRead, bytesWritten);
+  s_CurrentProfiler = nullptr;
+
+  if(m_Records.isEmpty())
+  {
+    return;
+  }
+
+  FilterRecord& record = m_Records.back();
+  record.wallSeconds = std::chrono::duration<double>(end - m_FilterStart).count();
+  record.cpuSeconds = cpu - m_FilterStartCpu;
+  record.bytesRead = bytesRead - m_FilterStartRead;
+  record.bytesWritten = bytesWritten - m_FilterStartWritten;
+
+  uint64_t totalBytes = TotalArrayBytes(dca);
+  record.allocatedBytes = static_cast<int64_t>(totalBytes) - static_cast<int64_t>(m_FilterStartBytes);
+  m_BoundaryPeakBytes = std::max(m_BoundaryPeakBytes, totalBytes);
+  record.boundaryPeakBytes = m_BoundaryPeakBytes;
+
+  if(nullptr != dca.get())
+  {
+    std::list<DataArrayPath> createdPaths = filter->getCreatedPaths();
+    for(const DataArrayPath& path : createdPaths)
+    {
+      record.createdBytes += PathBytes(dca, path);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QVector<PipelineProfiler::FilterRecord>& PipelineProfiler::getFilterRecords() const
+{
+  return m_Records;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double PipelineProfiler::getTotalWallSeconds() const
+{
+  double total = 0.0;
+  for(const FilterRecord& record : m_Records)
+  {
+    total += record.wallSeconds;
+  }
+  return total;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineProfiler::toJson() const
+{
+  QJsonArray filters;
+  for(const FilterRecord& record : m_Records)
+  {
+    QJsonObject obj;
+    obj["PipelineIndex"] = record.pipelineIndex;
+    obj["FilterClassName"] = record.filterClassName;
+    obj["HumanLabel"] = record.humanLabel;
+    obj["WallSeconds"] = record.wallSeconds;
+    obj["CpuSeconds"] = record.cpuSeconds;
+    obj["CreatedBytes"] = static_cast<double>(record.createdBytes);
+    obj["AllocatedBytes"] = static_cast<double>(record.allocatedBytes);
+    obj["BoundaryPeakBytes"] = static_cast<double>(record.boundaryPeakBytes);
+    obj["BytesRead"] = static_cast<double>(record.bytesRead);
+    obj["BytesWritten"] = static_cast<double>(record.bytesWritten);
+
+    QJsonArray scopes;
+    for(const ScopeRecord& scope : record.scopes)
+    {
+      QJsonObject scopeObj;
+      scopeObj["Name"] = scope.name;
+      scopeObj["Depth"] = scope.depth;
+      scopeObj["WallSeconds"] = scope.wallSeconds;
+      scopes.append(scopeObj);
+    }
+    obj["Scopes"] = scopes;
+    filters.append(obj);
+  }
+
+  QJsonObject json;
+  json["TotalWallSeconds"] = getTotalWallSeconds();
+  json["Filters"] = filters;
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineProfiler::writeJson(const QString& filePath) const
+{
+  QFile outputFile(filePath);
+  if(!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    return false;
+  }
+  QJsonDocument doc(toJson());
+  return outputFile.write(doc.toJson()) >= 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProfiler::printTable(QTextStream& out) const
+{
+  double total = getTotalWallSeconds();
+  out << QString("%1 %2 %3 %4 %5 %6 %7 %8\n")
+             .arg("#", 4)
+             .arg("Filter", -40)
+             .arg("Wall (s)", 10)
+             .arg("CPU (s)", 10)
+             .arg("% Time", 7)
+             .arg("Created (MB)", 13)
+             .arg("Read (MB)", 10)
+             .arg("Written (MB)", 13);
+  const double megabyte = 1024.0 * 1024.0;
+  for(const FilterRecord& record : m_Records)
+  {
+    double percent = (total > 0.0) ? record.wallSeconds / total * 100.0 : 0.0;
+    out << QString("%1 %2 %3 %4 %5 %6 %7 %8\n")
+               .arg(record.pipelineIndex + 1, 4)
+               .arg(record.humanLabel.left(40), -40)
+               .arg(record.wallSeconds, 10, 'f', 3)
+               .arg(record.cpuSeconds, 10, 'f', 3)
+               .arg(percent, 7, 'f', 1)
+               .arg(static_cast<double>(record.createdBytes) / megabyte, 13, 'f', 2)
+               .arg(static_cast<double>(record.bytesRead) / megabyte, 10, 'f', 2)
+               .arg(static_cast<double>(record.bytesWritten) / megabyte, 13, 'f', 2);
+    for(const ScopeRecord& scope : record.scopes)
+    {
+      QString name = QString(2 * (scope.depth + 1), ' ') + scope.name;
+      out << QString("%1 %2 %3\n").arg("", 4).arg(name.left(40), -40).arg(scope.wallSeconds, 10, 'f', 3);
+    }
+  }
+  out << QString("Total wall time: %1 s\n").arg(total, 0, 'f', 3);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfiler* PipelineProfiler::Current()
+{
+  return s_CurrentProfiler;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t PipelineProfiler::TotalArrayBytes(const DataContainerArray::Pointer& dca)
+{
+  uint64_t bytes = 0;
+  if(nullptr == dca.get())
+  {
+    return bytes;
+  }
+  QList<DataContainer::Pointer>& containers = dca->getDataContainers();
+  for(const DataContainer::Pointer& dc : containers)
+  {
+    bytes += DataContainerBytes(dc);
+  }
+  return bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfiler::Scope::Scope(const QString& name)
+: m_Profiler(PipelineProfiler::Current())
+{
+  if(nullptr == m_Profiler || m_Profiler->m_Records.isEmpty())
+  {
+    m_Profiler = nullptr;
+    return;
+  }
+  ScopeRecord record;
+  record.name = name;
+  record.depth = m_Profiler->m_ScopeDepth++;
+  QVector<ScopeRecord>& scopes = m_Profiler->m_Records.back().scopes;
+  m_Index = scopes.size();
+  scopes.push_back(record);
+  m_Start = std::chrono::steady_clock::now();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfiler::Scope::~Scope()
+{
+  if(nullptr == m_Profiler)
+  {
+    return;
+  }
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  m_Profiler->m_Records.back().scopes[m_Index].wallSeconds = std::chrono::duration<double>(end - m_Start).count();
+  m_Profiler->m_ScopeDepth--;
+}
@@ -0,0 +1,198 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+#include <QtCore/QTextStream>
+#include <QtCore/QVector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/SIMPLib.h"
+
+class AbstractFilter;
+
+/**
+ * @brief The PipelineProfiler class records wall time, CPU time, memory and I/O statistics for
+ * every filter that a FilterPipeline executes. Attach one with FilterPipeline::setProfiler() before
+ * executing the pipeline.
+ *
+ * CPU time and I/O byte counts are sampled from the process counters of the operating system, so they
+ * include any work other threads of the process do while the filter runs. Memory figures are derived
+ * from the attribute arrays held in the DataContainerArray.
+ */
+class SIMPLib_EXPORT PipelineProfiler
+{
+public:
+  SIMPL_SHARED_POINTERS(PipelineProfiler)
+  SIMPL_STATIC_NEW_MACRO(PipelineProfiler)
+  SIMPL_TYPE_MACRO(PipelineProfiler)
+
+  virtual ~PipelineProfiler();
+
+  /**
+   * @brief Timing of a named scope that a filter opened with PipelineProfiler::Scope
+   */
+  struct ScopeRecord
+  {
+    QString name;
+    int depth = 0;
+    double wallSeconds = 0.0;
+  };
+
+  /**
+   * @brief Statistics recorded for a single filter
+   */
+  struct FilterRecord
+  {
+    int pipelineIndex = -1;
+    QString filterClassName;
+    QString humanLabel;
+    double wallSeconds = 0.0;
+    double cpuSeconds = 0.0;
+    uint64_t createdBytes = 0;
+    int64_t allocatedBytes = 0;
+    // Largest attribute array total seen at any filter boundary so far. Memory is only sampled
+    // before and after each filter, so temporary allocations inside a filter are not included.
+    uint64_t boundaryPeakBytes = 0;
+    uint64_t bytesRead = 0;
+    uint64_t bytesWritten = 0;
+    QVector<ScopeRecord> scopes;
+  };
+
+  /**
+   * @brief The Scope class times a block of code inside a filter. The timing is attached to the filter
+   * that is being profiled on the calling thread and is ignored when no profiler is active.
+   */
+  class SIMPLib_EXPORT Scope
+  {
+  public:
+    explicit Scope(const QString& name);
+    ~Scope();
+
+  private:
+    PipelineProfiler* m_Profiler = nullptr;
+    int m_Index = -1;
+    std::chrono::steady_clock::time_point m_Start;
+
+    Scope(const Scope&) = delete;           // Copy Constructor Not Implemented
+    void operator=(const Scope&) = delete;  // Move assignment Not Implemented
+  };
+
+  /**
+   * @brief Removes all recorded statistics
+   */
+  void clear();
+
+  /**
+   * @brief Starts recording statistics for a filter. Called by FilterPipeline right before the filter executes.
+   * @param filter
+   * @param dca The DataContainerArray the filter operates on
+   */
+  void beginFilter(AbstractFilter* filter, const DataContainerArray::Pointer& dca);
+
+  /**
+   * @brief Finishes recording statistics for the filter passed to beginFilter()
+   * @param filter
+   * @param dca The DataContainerArray the filter operated on
+   */
+  void endFilter(AbstractFilter* filter, const DataContainerArray::Pointer& dca);
+
+  /**
+   * @brief Returns the statistics of every profiled filter in execution order
+   * @return
+   */
+  const QVector<FilterRecord>& getFilterRecords() const;
+
+  /**
+   * @brief Returns the summed wall time of all profiled filters in seconds
+   * @return
+   */
+  double getTotalWallSeconds() const;
+
+  /**
+   * @brief Returns the recorded statistics as a JSON object
+   * @return
+   */
+  QJsonObject toJson() const;
+
+  /**
+   * @brief Writes toJson() to a file
+   * @param filePath
+   * @return False if the file could not be written
+   */
+  bool writeJson(const QString& filePath) const;
+
+  /**
+   * @brief Prints the statistics as a plain text table
+   * @param out
+   */
+  void printTable(QTextStream& out) const;
+
+  /**
+   * @brief Returns the profiler that is recording a filter on the calling thread, if any
+   * @return
+   */
+  static PipelineProfiler* Current();
+
+  /**
+   * @brief Returns the number of bytes held by all attribute arrays in a DataContainerArray
+   * @param dca
+   * @return
+   */
+  static uint64_t TotalArrayBytes(const DataContainerArray::Pointer& dca);
+
+protected:
+  PipelineProfiler();
+
+private:
+  QVector<FilterRecord> m_Records;
+  std::chrono::steady_clock::time_point m_FilterStart;
+  double m_FilterStartCpu = 0.0;
+  uint64_t m_FilterStartRead = 0;
+  uint64_t m_FilterStartWritten = 0;
+  uint64_t m_FilterStartBytes = 0;
+  uint64_t m_BoundaryPeakBytes = 0;
+  int m_ScopeDepth = 0;
+
+  PipelineProfiler(const PipelineProfiler&) = delete; // Copy Constructor Not Implemented
+  void operator=(const PipelineProfiler&) = delete;   // Move assignment Not Implemented
+};
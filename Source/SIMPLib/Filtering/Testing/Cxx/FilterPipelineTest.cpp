@@ -33,17 +33,27 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
 #include <QtCore/QPluginLoader>
 
 //#include "Applications/DREAM3D/DREAM3DApplication.h"
 
 #include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/CoreFilters/CreateAttributeMatrix.h"
+#include "SIMPLib/CoreFilters/CreateDataArray.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineProfiler.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/SIMPLib.h"
 
@@ -58,6 +68,75 @@
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
 
+/**
+ * @brief The RendezvousFilter class creates a single array and, during execution, waits for a number
+ * of peers to arrive at the same point so a test can tell whether its instances ran concurrently.
+ */
+class RendezvousFilter : public AbstractFilter
+{
+public:
+  SIMPL_SHARED_POINTERS(RendezvousFilter)
+  SIMPL_TYPE_MACRO_SUPER_OVERRIDE(RendezvousFilter, AbstractFilter)
+
+  static Pointer New(const DataArrayPath& path, std::atomic<int>* arrived, int peers)
+  {
+    Pointer sharedPtr(new RendezvousFilter(path, arrived, peers));
+    return sharedPtr;
+  }
+
+  ~RendezvousFilter() override = default;
+
+  bool getSawPeers() const
+  {
+    return m_SawPeers;
+  }
+
+  void preflight() override
+  {
+    setInPreflight(true);
+    dataCheck();
+    setInPreflight(false);
+  }
+
+  void execute() override
+  {
+    setErrorCondition(0);
+    dataCheck();
+    if(getErrorCondition() < 0)
+    {
+      return;
+    }
+
+    // Wait a bounded time for the other instances; they only arrive if they run at the same time
+    (*m_Arrived)++;
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while(m_Arrived->load() < m_Peers && std::chrono::steady_clock::now() < deadline)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    m_SawPeers = (m_Arrived->load() >= m_Peers);
+  }
+
+protected:
+  RendezvousFilter(const DataArrayPath& path, std::atomic<int>* arrived, int peers)
+  : m_Path(path)
+  , m_Arrived(arrived)
+  , m_Peers(peers)
+  {
+  }
+
+  void dataCheck()
+  {
+    getDataContainerArray()->createNonPrereqArrayFromPath<Int32ArrayType, AbstractFilter, int32_t>(this, m_Path, 0, QVector<size_t>(1, 1));
+  }
+
+private:
+  DataArrayPath m_Path;
+  std::atomic<int>* m_Arrived = nullptr;
+  int m_Peers = 0;
+  bool m_SawPeers = false;
+};
+
 class FilterPipelineTest
 {
 public:
@@ -154,6 +233,263 @@ public:
 #endif
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  CreateDataArray::Pointer createArrayFilter(const QString& name, const QString& value)
+  {
+    CreateDataArray::Pointer filter = CreateDataArray::New();
+    filter->setScalarType(SIMPL::ScalarTypes::Type::Int32);
+    filter->setNumberOfComponents(1);
+    filter->setNewArray(DataArrayPath("DataContainer", "CellData", name));
+    filter->setInitializationType(CreateDataArray::Manual);
+    filter->setInitializationValue(value);
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPipelineDataflowExecution()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    pipeline->setDataflowExecution(true);
+
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName("DataContainer");
+    pipeline->pushBack(createDc);
+
+    CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+    createAm->setCreatedAttributeMatrix(DataArrayPath("DataContainer", "CellData", ""));
+    createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+    std::vector<std::vector<double>> tupleDims = {{1000.0}};
+    createAm->setTupleDimensions(DynamicTableData(tupleDims));
+    pipeline->pushBack(createAm);
+
+    // These filters only touch their own arrays and may run concurrently
+    const int32_t arrayCount = 6;
+    for(int32_t i = 0; i < arrayCount; i++)
+    {
+      pipeline->pushBack(createArrayFilter(QString("Array_%1").arg(i), QString::number(i * 10)));
+    }
+
+    // The observers must see each filter start and complete in pipeline order, as in a serial run
+    QVector<int> notifications;
+    int index = 0;
+    for(const AbstractFilter::Pointer& filter : pipeline->getFilterContainer())
+    {
+      QObject::connect(filter.get(), &AbstractFilter::filterInProgress, [&notifications, index](AbstractFilter*) { notifications.push_back(2 * index); });
+      QObject::connect(filter.get(), &AbstractFilter::filterCompleted, [&notifications, index](AbstractFilter*) { notifications.push_back(2 * index + 1); });
+      index++;
+    }
+
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCondition(), 0)
+    DREAM3D_REQUIRE_VALID_POINTER(dca.get())
+    DREAM3D_REQUIRE_EQUAL(notifications.size(), 2 * index)
+    for(int i = 0; i < notifications.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(notifications[i], i)
+    }
+
+    AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath("DataContainer", "CellData", ""));
+    DREAM3D_REQUIRE_VALID_POINTER(am.get())
+    DREAM3D_REQUIRE_EQUAL(am->getNumAttributeArrays(), arrayCount)
+    for(int32_t i = 0; i < arrayCount; i++)
+    {
+      Int32ArrayType::Pointer array = std::dynamic_pointer_cast<Int32ArrayType>(am->getAttributeArray(QString("Array_%1").arg(i)));
+      DREAM3D_REQUIRE_VALID_POINTER(array.get())
+      DREAM3D_REQUIRE_EQUAL(array->getNumberOfTuples(), 1000)
+      DREAM3D_REQUIRE_EQUAL(array->getValue(999), i * 10)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPipelineDataflowConcurrency()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    pipeline->setDataflowExecution(true);
+
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName("DataContainer");
+    pipeline->pushBack(createDc);
+
+    CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+    createAm->setCreatedAttributeMatrix(DataArrayPath("DataContainer", "CellData", ""));
+    createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+    std::vector<std::vector<double>> tupleDims = {{1.0}};
+    createAm->setTupleDimensions(DynamicTableData(tupleDims));
+    pipeline->pushBack(createAm);
+
+    // Each filter only finishes its rendezvous if the other one is executing at the same time
+    const int peers = 2;
+    std::atomic<int> arrived(0);
+    QVector<RendezvousFilter::Pointer> rendezvousFilters;
+    for(int i = 0; i < peers; i++)
+    {
+      RendezvousFilter::Pointer filter = RendezvousFilter::New(DataArrayPath("DataContainer", "CellData", QString("Rendezvous_%1").arg(i)), &arrived, peers);
+      rendezvousFilters.push_back(filter);
+      pipeline->pushBack(filter);
+    }
+
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCondition(), 0)
+    DREAM3D_REQUIRE_VALID_POINTER(dca.get())
+    DREAM3D_REQUIRE_EQUAL(arrived.load(), peers)
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(std::thread::hardware_concurrency() > 1)
+    {
+      for(const RendezvousFilter::Pointer& filter : rendezvousFilters)
+      {
+        DREAM3D_REQUIRE(filter->getSawPeers())
+      }
+    }
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCoalescedProgress()
+  {
+    AbstractFilter::Pointer filter = AbstractFilter::New();
+    QVector<PipelineMessage> messages;
+    QObject::connect(filter.get(), &Observable::filterGeneratedMessage, [&messages](const PipelineMessage& msg) { messages.push_back(msg); });
+
+    // Most of the increments fall inside an update interval, but the 100% update must still arrive last
+    const uint64_t total = 100000;
+    const uint64_t threadCount = 4;
+    filter->initializeProgress("", "Progress", "Counting", total);
+    std::vector<std::thread> threads;
+    for(uint64_t t = 0; t < threadCount; t++)
+    {
+      threads.emplace_back([filter, total, threadCount]() {
+        for(uint64_t i = 0; i < total / threadCount; i++)
+        {
+          filter->incrementProgress();
+        }
+      });
+    }
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+    DREAM3D_REQUIRE_EQUAL(filter->getProgressCount(), total)
+    DREAM3D_REQUIRE(messages.size() > 0)
+    DREAM3D_REQUIRE(static_cast<uint64_t>(messages.size()) < total)
+    DREAM3D_REQUIRE_EQUAL(messages.back().getProgressValue(), 100)
+    DREAM3D_REQUIRE(messages.back().getText().contains("100%"))
+
+    // The completed counter was already reported, so flushing adds nothing
+    int messageCount = messages.size();
+    filter->flushProgressMessage();
+    DREAM3D_REQUIRE_EQUAL(messages.size(), messageCount)
+
+    // Coalesced messages that are not due are dropped and the flush does not bring them back.
+    // Setting the rate starts a new interval, so the first message is always due.
+    messages.clear();
+    filter->setProgressUpdateRate(10);
+    const int stepCount = 1000;
+    for(int i = 0; i <= stepCount; i++)
+    {
+      filter->notifyCoalescedProgressMessage("", "Progress", QString("Step %1").arg(i), i * 100 / stepCount);
+    }
+    DREAM3D_REQUIRE(messages.size() > 0)
+    DREAM3D_REQUIRE(messages.size() <= stepCount)
+    messageCount = messages.size();
+    filter->flushProgressMessage();
+    DREAM3D_REQUIRE_EQUAL(messages.size(), messageCount)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestIncrementalPreflight()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName("DataContainer");
+    pipeline->pushBack(createDc);
+
+    CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+    createAm->setCreatedAttributeMatrix(DataArrayPath("DataContainer", "CellData", ""));
+    createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+    std::vector<std::vector<double>> tupleDims = {{10.0}};
+    createAm->setTupleDimensions(DynamicTableData(tupleDims));
+    pipeline->pushBack(createAm);
+
+    CreateDataArray::Pointer createArray = createArrayFilter("Array_0", "1");
+    pipeline->pushBack(createArray);
+
+    FilterPipeline::PreflightCache cache;
+    int err = pipeline->incrementalPreflightPipeline(cache);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE_EQUAL(cache.size(), 3)
+
+    // Only the edited filter is preflighted again and it sees the cached structure
+    createArray->setNewArray(DataArrayPath("DataContainer", "Missing", "Array_0"));
+    err = pipeline->incrementalPreflightPipeline(cache);
+    DREAM3D_REQUIRE(err < 0)
+    DREAM3D_REQUIRE_EQUAL(createAm->getErrorCondition(), 0)
+    DREAM3D_REQUIRE(createArray->getErrorCondition() < 0)
+
+    createArray->setNewArray(DataArrayPath("DataContainer", "CellData", "Array_0"));
+    err = pipeline->incrementalPreflightPipeline(cache);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DataContainerArray::Pointer dca = createArray->getDataContainerArray();
+    DREAM3D_REQUIRE(dca->doesAttributeArrayExist(DataArrayPath("DataContainer", "CellData", "Array_0")))
+
+    // Disabling a filter earlier in the pipeline invalidates everything after it
+    createAm->setEnabled(false);
+    err = pipeline->incrementalPreflightPipeline(cache);
+    DREAM3D_REQUIRE(err < 0)
+    DREAM3D_REQUIRE_EQUAL(cache.size(), 3)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPipelineProfiler()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName("DataContainer");
+    pipeline->pushBack(createDc);
+
+    CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+    createAm->setCreatedAttributeMatrix(DataArrayPath("DataContainer", "CellData", ""));
+    createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+    std::vector<std::vector<double>> tupleDims = {{1000.0}};
+    createAm->setTupleDimensions(DynamicTableData(tupleDims));
+    pipeline->pushBack(createAm);
+
+    pipeline->pushBack(createArrayFilter("Array_0", "5"));
+
+    PipelineProfiler::Pointer profiler = PipelineProfiler::New();
+    pipeline->setProfiler(profiler);
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCondition(), 0)
+
+    const QVector<PipelineProfiler::FilterRecord>& records = profiler->getFilterRecords();
+    DREAM3D_REQUIRE_EQUAL(records.size(), 3)
+    DREAM3D_REQUIRE_EQUAL(records[2].filterClassName, QString("CreateDataArray"))
+    DREAM3D_REQUIRE_EQUAL(records[2].createdBytes, 1000 * sizeof(int32_t))
+    DREAM3D_REQUIRE_EQUAL(records[2].allocatedBytes, static_cast<int64_t>(1000 * sizeof(int32_t)))
+    DREAM3D_REQUIRE_EQUAL(records[2].boundaryPeakBytes, 1000 * sizeof(int32_t))
+    for(const PipelineProfiler::FilterRecord& record : records)
+    {
+      DREAM3D_REQUIRE(record.wallSeconds >= 0.0)
+    }
+
+    QJsonObject json = profiler->toJson();
+    DREAM3D_REQUIRE_EQUAL(json["Filters"].toArray().size(), 3)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -168,6 +504,11 @@ public:
 #endif
 
     DREAM3D_REGISTER_TEST(TestPipelinePushPop());
+    DREAM3D_REGISTER_TEST(TestPipelineDataflowExecution());
+    DREAM3D_REGISTER_TEST(TestPipelineDataflowConcurrency());
+    DREAM3D_REGISTER_TEST(TestCoalescedProgress());
+    DREAM3D_REGISTER_TEST(TestIncrementalPreflight());
+    DREAM3D_REGISTER_TEST(TestPipelineProfiler());
 
 #if REMOVE_TEST_FILES
 //  DREAM3D_REGISTER_TEST( RemoveTestFiles() );
@@ -460,13 +460,44 @@ void EdgeGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int EdgeGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf))
+int64_t EdgeGeom::findCell(const float coords[3])
+{
+  ElementSpatialIndex::Pointer index = getElementSpatialIndex();
+  if(nullptr == index.get())
+  {
+    return -1;
+  }
+  const float* vertices = m_VertexList->getConstPointer(0);
+  const int64_t* edges = m_EdgeList->getConstPointer(0);
+  float tolerance = index->getTolerance();
+  return index->findElement(coords, [&](int64_t edgeId) {
+    const int64_t* edge = edges + 2 * edgeId;
+    return GeometryHelpers::Search::PointOnEdge(coords, vertices + 3 * edge[0], vertices + 3 * edge[1], tolerance);
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementSpatialIndex::Pointer EdgeGeom::createElementSpatialIndex()
+{
+  if(nullptr == m_VertexList.get() || nullptr == m_EdgeList.get())
+  {
+    return ElementSpatialIndex::NullPointer();
+  }
+  return ElementSpatialIndex::New(m_VertexList, m_EdgeList);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int EdgeGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf), const H5DatasetCreationPolicy& policy)
 {
   herr_t err = 0;
 
   if(m_VertexList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VertexList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VertexList, policy);
     if(err < 0)
     {
       return err;
@@ -475,7 +506,7 @@ int EdgeGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf)
 
   if(m_EdgeList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_EdgeList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_EdgeList, policy);
     if(err < 0)
     {
       return err;
@@ -484,7 +515,7 @@ int EdgeGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf)
 
   if(m_EdgeCentroids.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_EdgeCentroids);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_EdgeCentroids, policy);
     if(err < 0)
     {
       return err;
@@ -493,7 +524,7 @@ int EdgeGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf)
 
   if(m_EdgeSizes.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_EdgeSizes);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_EdgeSizes, policy);
     if(err < 0)
     {
       return err;
@@ -503,7 +534,7 @@ int EdgeGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf)
   if(m_EdgeNeighbors.get() != nullptr)
   {
     size_t numEdges = static_cast<size_t>(getNumberOfEdges());
-    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_EdgeNeighbors, numEdges, SIMPL::StringConstants::EdgeNeighbors);
+    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_EdgeNeighbors, numEdges, SIMPL::StringConstants::EdgeNeighbors, policy);
     if(err < 0)
     {
       return err;
@@ -513,7 +544,7 @@ int EdgeGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf)
   if(m_EdgesContainingVert.get() != nullptr)
   {
     size_t numVerts = static_cast<size_t>(getNumberOfVertices());
-    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_EdgesContainingVert, numVerts, SIMPL::StringConstants::EdgesContainingVert);
+    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_EdgesContainingVert, numVerts, SIMPL::StringConstants::EdgesContainingVert, policy);
     if(err < 0)
     {
       return err;
@@ -0,0 +1,320 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ElementSpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+namespace
+{
+const size_t k_MaxBinsPerDim = 1024;
+const float k_RelativeTolerance = 1.0e-5f;
+}
+
+/**
+ * @brief The ElementBoxesImpl class computes the padded bounding box of each element
+ */
+class ElementBoxesImpl
+{
+public:
+  ElementBoxesImpl(const float* vertices, const int64_t* elements, size_t numVertsPerElem, float tolerance, float* boxes)
+  : m_Vertices(vertices)
+  , m_Elements(elements)
+  , m_NumVertsPerElem(numVertsPerElem)
+  , m_Tolerance(tolerance)
+  , m_Boxes(boxes)
+  {
+  }
+  virtual ~ElementBoxesImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      float* box = m_Boxes + 6 * i;
+      for(size_t j = 0; j < m_NumVertsPerElem; j++)
+      {
+        int64_t vertId = (nullptr == m_Elements) ? static_cast<int64_t>(i) : m_Elements[m_NumVertsPerElem * i + j];
+        const float* coords = m_Vertices + 3 * vertId;
+        for(size_t k = 0; k < 3; k++)
+        {
+          if(j == 0 || coords[k] < box[k])
+          {
+            box[k] = coords[k];
+          }
+          if(j == 0 || coords[k] > box[k + 3])
+          {
+            box[k + 3] = coords[k];
+          }
+        }
+      }
+      for(size_t k = 0; k < 3; k++)
+      {
+        box[k] -= m_Tolerance;
+        box[k + 3] += m_Tolerance;
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const float* m_Vertices;
+  const int64_t* m_Elements;
+  size_t m_NumVertsPerElem;
+  float m_Tolerance;
+  float* m_Boxes;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementSpatialIndex::ElementSpatialIndex()
+: m_NumElements(0)
+, m_Tolerance(0.0f)
+{
+  for(size_t i = 0; i < 3; i++)
+  {
+    m_Min[i] = 0.0f;
+    m_Max[i] = 0.0f;
+    m_BinSize[i] = 1.0f;
+    m_NumBins[i] = 1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementSpatialIndex::~ElementSpatialIndex() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementSpatialIndex::Pointer ElementSpatialIndex::New(FloatArrayType::Pointer vertices, Int64ArrayType::Pointer elements)
+{
+  if(nullptr == vertices.get())
+  {
+    return NullPointer();
+  }
+  Pointer sharedPtr(new ElementSpatialIndex());
+  sharedPtr->build(vertices, elements);
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ElementSpatialIndex::getNumberOfElements() const
+{
+  return m_NumElements;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float ElementSpatialIndex::getTolerance() const
+{
+  return m_Tolerance;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ElementSpatialIndex::getBounds(float ll[3], float ur[3]) const
+{
+  for(size_t i = 0; i < 3; i++)
+  {
+    ll[i] = m_Min[i];
+    ur[i] = m_Max[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ElementSpatialIndex::findBinRange(float lo, float hi, size_t dim, size_t& first, size_t& last) const
+{
+  float lower = std::max((lo - m_Min[dim]) / m_BinSize[dim], 0.0f);
+  float upper = std::max((hi - m_Min[dim]) / m_BinSize[dim], 0.0f);
+  first = std::min(static_cast<size_t>(lower), m_NumBins[dim] - 1);
+  last = std::min(static_cast<size_t>(upper), m_NumBins[dim] - 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ElementSpatialIndex::build(FloatArrayType::Pointer vertices, Int64ArrayType::Pointer elements)
+{
+  size_t numVerts = vertices->getNumberOfTuples();
+  size_t numVertsPerElem = (nullptr == elements.get()) ? 1 : elements->getNumberOfComponents();
+  m_NumElements = (nullptr == elements.get()) ? numVerts : elements->getNumberOfTuples();
+  if(numVerts == 0 || m_NumElements == 0)
+  {
+    m_NumElements = 0;
+    m_BinOffsets.assign(2, 0);
+    return;
+  }
+
+  const float* vertex = vertices->getConstPointer(0);
+  const int64_t* elems = (nullptr == elements.get()) ? nullptr : elements->getConstPointer(0);
+
+  // The tolerance is taken relative to the extent of the whole geometry so it scales with the data
+  for(size_t i = 0; i < 3; i++)
+  {
+    m_Min[i] = std::numeric_limits<float>::max();
+    m_Max[i] = std::numeric_limits<float>::lowest();
+  }
+  for(size_t v = 0; v < numVerts; v++)
+  {
+    for(size_t i = 0; i < 3; i++)
+    {
+      m_Min[i] = std::min(m_Min[i], vertex[3 * v + i]);
+      m_Max[i] = std::max(m_Max[i], vertex[3 * v + i]);
+    }
+  }
+  float maxExtent = std::max(std::max(m_Max[0] - m_Min[0], m_Max[1] - m_Min[1]), m_Max[2] - m_Min[2]);
+  m_Tolerance = k_RelativeTolerance * maxExtent;
+  if(m_Tolerance <= 0.0f)
+  {
+    m_Tolerance = k_RelativeTolerance;
+  }
+  for(size_t i = 0; i < 3; i++)
+  {
+    m_Min[i] -= m_Tolerance;
+    m_Max[i] += m_Tolerance;
+  }
+
+  m_Boxes.resize(6 * m_NumElements);
+  ElementBoxesImpl impl(vertex, elems, numVertsPerElem, m_Tolerance, m_Boxes.data());
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_NumElements), impl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    impl.compute(0, m_NumElements);
+  }
+
+  // Size the bins so there is about one element per bin. Flat axes, such as the normal of a
+  // planar surface mesh, only get a single bin.
+  double volume = 1.0;
+  int numSpanned = 0;
+  for(size_t i = 0; i < 3; i++)
+  {
+    double extent = static_cast<double>(m_Max[i] - m_Min[i]);
+    if(extent > 4.0 * m_Tolerance)
+    {
+      volume *= extent;
+      numSpanned++;
+    }
+  }
+  double binSize = (numSpanned == 0) ? 1.0 : std::pow(volume / static_cast<double>(m_NumElements), 1.0 / numSpanned);
+  for(size_t i = 0; i < 3; i++)
+  {
+    double extent = static_cast<double>(m_Max[i] - m_Min[i]);
+    m_NumBins[i] = 1;
+    if(extent > 4.0 * m_Tolerance && binSize > 0.0)
+    {
+      m_NumBins[i] = std::min(static_cast<size_t>(std::ceil(extent / binSize)), k_MaxBinsPerDim);
+      m_NumBins[i] = std::max(m_NumBins[i], static_cast<size_t>(1));
+    }
+    m_BinSize[i] = static_cast<float>(extent / static_cast<double>(m_NumBins[i]));
+  }
+
+  // Count the elements overlapping each bin, then fill the bins in element order
+  size_t numBins = m_NumBins[0] * m_NumBins[1] * m_NumBins[2];
+  m_BinOffsets.assign(numBins + 1, 0);
+  size_t first[3] = {0, 0, 0};
+  size_t last[3] = {0, 0, 0};
+  for(size_t e = 0; e < m_NumElements; e++)
+  {
+    const float* box = m_Boxes.data() + 6 * e;
+    for(size_t i = 0; i < 3; i++)
+    {
+      findBinRange(box[i], box[i + 3], i, first[i], last[i]);
+    }
+    for(size_t z = first[2]; z <= last[2]; z++)
+    {
+      for(size_t y = first[1]; y <= last[1]; y++)
+      {
+        for(size_t x = first[0]; x <= last[0]; x++)
+        {
+          m_BinOffsets[(z * m_NumBins[1] + y) * m_NumBins[0] + x + 1]++;
+        }
+      }
+    }
+  }
+  for(size_t b = 0; b < numBins; b++)
+  {
+    m_BinOffsets[b + 1] += m_BinOffsets[b];
+  }
+
+  m_BinElements.resize(m_BinOffsets[numBins]);
+  std::vector<size_t> fill(m_BinOffsets.begin(), m_BinOffsets.end() - 1);
+  for(size_t e = 0; e < m_NumElements; e++)
+  {
+    const float* box = m_Boxes.data() + 6 * e;
+    for(size_t i = 0; i < 3; i++)
+    {
+      findBinRange(box[i], box[i + 3], i, first[i], last[i]);
+    }
+    for(size_t z = first[2]; z <= last[2]; z++)
+    {
+      for(size_t y = first[1]; y <= last[1]; y++)
+      {
+        for(size_t x = first[0]; x <= last[0]; x++)
+        {
+          m_BinElements[fill[(z * m_NumBins[1] + y) * m_NumBins[0] + x]++] = static_cast<int64_t>(e);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,168 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+
+/**
+ * @class ElementSpatialIndex ElementSpatialIndex.h SIMPLib/Geometry/ElementSpatialIndex.h
+ * @brief A uniform grid of bins over the bounding boxes of the elements of an unstructured
+ * geometry. Every bin lists the elements whose boxes overlap it, so locating a point only has
+ * to test the few elements listed in the bin the point falls in. The index is read only once
+ * built and may be queried from any number of threads at the same time.
+ */
+class SIMPLib_EXPORT ElementSpatialIndex
+{
+  public:
+    SIMPL_SHARED_POINTERS(ElementSpatialIndex)
+    SIMPL_TYPE_MACRO(ElementSpatialIndex)
+
+    /**
+     * @brief New Builds the index over the elements of a geometry
+     * @param vertices Shared vertex list of the geometry
+     * @param elements Element list of the geometry. If this is a nullptr every vertex is an element.
+     * @return
+     */
+    static Pointer New(FloatArrayType::Pointer vertices, Int64ArrayType::Pointer elements);
+
+    virtual ~ElementSpatialIndex();
+
+    /**
+     * @brief getNumberOfElements
+     * @return
+     */
+    size_t getNumberOfElements() const;
+
+    /**
+     * @brief getTolerance Returns the distance the element boxes were grown by. Points this close to
+     * an element are considered to touch it.
+     * @return
+     */
+    float getTolerance() const;
+
+    /**
+     * @brief getBounds Returns the bounding box of all the elements
+     * @param ll
+     * @param ur
+     */
+    void getBounds(float ll[3], float ur[3]) const;
+
+    /**
+     * @brief findElement Returns the first element whose box contains the point and for which
+     * the predicate returns true
+     * @param coords
+     * @param contains Callable taking an int64_t element Id that tests the exact element shape
+     * @return The element Id or -1 if no element contains the point
+     */
+    template <typename Predicate> int64_t findElement(const float coords[3], Predicate contains) const
+    {
+      if(m_NumElements == 0)
+      {
+        return -1;
+      }
+
+      size_t bin[3] = {0, 0, 0};
+      for(size_t i = 0; i < 3; i++)
+      {
+        // Written so that NaN coordinates are rejected too
+        if(!(coords[i] >= m_Min[i] && coords[i] <= m_Max[i]))
+        {
+          return -1;
+        }
+        bin[i] = static_cast<size_t>((coords[i] - m_Min[i]) / m_BinSize[i]);
+        if(bin[i] >= m_NumBins[i])
+        {
+          bin[i] = m_NumBins[i] - 1;
+        }
+      }
+
+      size_t binId = (bin[2] * m_NumBins[1] + bin[1]) * m_NumBins[0] + bin[0];
+      for(size_t i = m_BinOffsets[binId]; i < m_BinOffsets[binId + 1]; i++)
+      {
+        int64_t elemId = m_BinElements[i];
+        const float* box = m_Boxes.data() + 6 * elemId;
+        if(coords[0] < box[0] || coords[0] > box[3] || coords[1] < box[1] || coords[1] > box[4] || coords[2] < box[2] || coords[2] > box[5])
+        {
+          continue;
+        }
+        if(contains(elemId))
+        {
+          return elemId;
+        }
+      }
+      return -1;
+    }
+
+  protected:
+    ElementSpatialIndex();
+
+  private:
+    size_t m_NumElements;
+    float m_Tolerance;
+    float m_Min[3];
+    float m_Max[3];
+    float m_BinSize[3];
+    size_t m_NumBins[3];
+
+    std::vector<float> m_Boxes;
+    std::vector<size_t> m_BinOffsets;
+    std::vector<int64_t> m_BinElements;
+
+    /**
+     * @brief build Computes the element boxes and sorts the elements into the bins
+     * @param vertices
+     * @param elements
+     */
+    void build(FloatArrayType::Pointer vertices, Int64ArrayType::Pointer elements);
+
+    /**
+     * @brief findBinRange Returns the range of bins, inclusive, overlapped by the box along one axis
+     * @param lo
+     * @param hi
+     * @param dim
+     * @param first
+     * @param last
+     */
+    void findBinRange(float lo, float hi, size_t dim, size_t& first, size_t& last) const;
+
+    ElementSpatialIndex(const ElementSpatialIndex&) = delete; // Copy Constructor Not Implemented
+    void operator=(const ElementSpatialIndex&) = delete;      // Move assignment Not Implemented
+};
+
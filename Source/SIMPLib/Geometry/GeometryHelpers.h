@@ -33,13 +33,20 @@
 
 #include <math.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
 #include <map>
+#include <numeric>
 #include <set>
+#include <vector>
 
 #include <QtCore/QString>
 
 #include "H5Support/QH5Lite.h"
 #include "H5Support/H5ScopedErrorHandler.h"
+#include "H5Support/H5ScopedSentinel.h"
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
@@ -48,6 +55,13 @@
 #include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/MatrixMath.h"
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/partitioner.h>
+#endif
+
 /**
 * @brief This file contains a namespace with classes for manipulating IGeometry objects
 */
@@ -150,9 +164,10 @@ public:
    * @brief WriteListToHDF5
    * @param parentId
    * @param list
+   * @param policy The chunking/compression policy to create the dataset with
    * @return
    */
-  static int WriteListToHDF5(hid_t parentId, IDataArray::Pointer list)
+  static int WriteListToHDF5(hid_t parentId, IDataArray::Pointer list, const H5DatasetCreationPolicy& policy = H5DatasetCreationPolicy())
   {
     herr_t err = 0;
     if(list->getNumberOfTuples() == 0)
@@ -160,10 +175,75 @@ public:
       return err;
     }
     QVector<size_t> tDims(1, list->getNumberOfTuples());
-    err = list->writeH5Data(parentId, tDims);
+    err = list->writeH5Data(parentId, tDims, policy);
     return err;
   }
 
+  /**
+   * @brief WriteIdentityListToHDF5 Writes the ids 0 to numElems - 1 as a single component int64_t array.
+   * The ids are generated into a bounded block that is written with a hyperslab, so the list is never
+   * held in memory as a whole.
+   * @param parentId
+   * @param name
+   * @param numElems
+   * @param policy The chunking/compression policy to create the dataset with
+   * @return
+   */
+  static int WriteIdentityListToHDF5(hid_t parentId, const QString& name, size_t numElems, const H5DatasetCreationPolicy& policy = H5DatasetCreationPolicy())
+  {
+    herr_t err = 0;
+    if(numElems == 0)
+    {
+      return err;
+    }
+
+    hsize_t dims[2] = {static_cast<hsize_t>(numElems), 1};
+    hid_t dcpl = policy.createPropertyList(name, 2, dims, sizeof(int64_t));
+    H5PropertyListAutoCloser dcplCloser(&dcpl);
+
+    hid_t fileSpaceId = H5Screate_simple(2, dims, nullptr);
+    if(fileSpaceId < 0)
+    {
+      return -101;
+    }
+    hid_t datasetId = H5Dcreate(parentId, name.toLatin1().data(), H5T_NATIVE_INT64, fileSpaceId, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    if(datasetId < 0)
+    {
+      H5Sclose(fileSpaceId);
+      return -104;
+    }
+
+    const size_t blockSize = 1024 * 1024;
+    std::vector<int64_t> block(std::min(blockSize, numElems));
+    for(size_t first = 0; first < numElems && err >= 0; first += blockSize)
+    {
+      size_t numIds = std::min(blockSize, numElems - first);
+      std::iota(block.begin(), block.begin() + numIds, static_cast<int64_t>(first));
+
+      hsize_t start[2] = {static_cast<hsize_t>(first), 0};
+      hsize_t count[2] = {static_cast<hsize_t>(numIds), 1};
+      hid_t memSpaceId = H5Screate_simple(2, count, nullptr);
+      err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, start, nullptr, count, nullptr);
+      if(err >= 0)
+      {
+        err = H5Dwrite(datasetId, H5T_NATIVE_INT64, memSpaceId, fileSpaceId, H5P_DEFAULT, block.data());
+      }
+      H5Sclose(memSpaceId);
+    }
+    H5Dclose(datasetId);
+    H5Sclose(fileSpaceId);
+    if(err < 0)
+    {
+      return -102;
+    }
+
+    // The attributes only need the name and shape, so they come from an array that holds no values
+    QVector<size_t> tDims(1, numElems);
+    QVector<size_t> cDims(1, 1);
+    DataArray<int64_t>::Pointer ids = DataArray<int64_t>::CreateArray(numElems, cDims, name, false);
+    return H5DataArrayWriter::writeDataArrayAttributes<DataArray<int64_t>>(parentId, ids.get(), tDims, cDims);
+  }
+
   /**
    * @brief ReadDynamicListFromHDF5
    * @param dynamicListName
@@ -213,46 +293,326 @@ public:
    * @param dynamicList
    * @param numElems
    * @param name
+   * @param policy The chunking/compression policy to create the dataset with
    * @return
    */
-  template <typename T, typename K> static int WriteDynamicListToHDF5(hid_t parentId, typename DynamicListArray<T, K>::Pointer dynamicList, size_t numElems, const QString& name)
+  template <typename T, typename K>
+  static int WriteDynamicListToHDF5(hid_t parentId, typename DynamicListArray<T, K>::Pointer dynamicList, size_t numElems, const QString& name,
+                                    const H5DatasetCreationPolicy& policy = H5DatasetCreationPolicy())
   {
     herr_t err = 0;
     if(numElems == 0)
     {
       return err;
     }
-    int32_t rank = 0;
-    hsize_t dims[2] = {0, 2ULL};
-    size_t total = 0;
-    for(size_t v = 0; v < numElems; ++v)
+
+    // The file stores each list as its count followed by its values. The lists are serialized
+    // straight from the flat value array into a bounded staging block that is written with a
+    // hyperslab, so the whole structure is never repacked in memory at once.
+    const size_t* offsets = dynamicList->getOffsetsPointer();
+    size_t totalBytes = numElems * sizeof(T) + offsets[numElems] * sizeof(K);
+
+    hsize_t dims[1] = {static_cast<hsize_t>(totalBytes)};
+    hid_t dcpl = policy.createPropertyList(name, 1, dims, sizeof(uint8_t));
+    H5PropertyListAutoCloser dcplCloser(&dcpl);
+
+    hid_t fileSpaceId = H5Screate_simple(1, dims, nullptr);
+    if(fileSpaceId < 0)
+    {
+      return -101;
+    }
+    hid_t datasetId = H5Dcreate(parentId, name.toLatin1().data(), H5T_NATIVE_UINT8, fileSpaceId, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    if(datasetId < 0)
+    {
+      H5Sclose(fileSpaceId);
+      return -104;
+    }
+
+    const size_t blockSize = 4 * 1024 * 1024;
+    std::vector<uint8_t> block;
+    block.reserve(blockSize);
+    hsize_t fileOffset = 0;
+    const K* values = dynamicList->getValuesPointer();
+
+    for(size_t v = 0; v < numElems && err >= 0; ++v)
     {
-      total += dynamicList->getNumberOfElements(v);
+      T nelems = static_cast<T>(offsets[v + 1] - offsets[v]);
+      const uint8_t* countBytes = reinterpret_cast<const uint8_t*>(&nelems);
+      const uint8_t* valueBytes = reinterpret_cast<const uint8_t*>(values + offsets[v]);
+      block.insert(block.end(), countBytes, countBytes + sizeof(T));
+      block.insert(block.end(), valueBytes, valueBytes + nelems * sizeof(K));
+
+      if(block.size() >= blockSize || v == numElems - 1)
+      {
+        hsize_t start[1] = {fileOffset};
+        hsize_t count[1] = {static_cast<hsize_t>(block.size())};
+        hid_t memSpaceId = H5Screate_simple(1, count, nullptr);
+        err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, start, nullptr, count, nullptr);
+        if(err >= 0)
+        {
+          err = H5Dwrite(datasetId, H5T_NATIVE_UINT8, memSpaceId, fileSpaceId, H5P_DEFAULT, block.data());
+        }
+        H5Sclose(memSpaceId);
+        fileOffset += count[0];
+        block.clear();
+      }
     }
 
-    size_t totalBytes = numElems * sizeof(T) + total * sizeof(K);
+    if(err < 0)
+    {
+      err = -102;
+    }
+    H5Dclose(datasetId);
+    H5Sclose(fileSpaceId);
+    return err;
+  }
+};
 
-    // Allocate a flat array to copy the data into
-    QVector<uint8_t> buffer(totalBytes, 0);
-    uint8_t* bufPtr = &(buffer.front());
-    size_t offset = 0;
+/**
+ * @brief The CountElementsContainingVertImpl class counts, for a range of elements, how many times each vertex is referenced
+ */
+template <typename T, typename K> class CountElementsContainingVertImpl
+{
+public:
+  CountElementsContainingVertImpl(const K* elems, size_t numVertsPerElem, std::atomic<T>* linkCount)
+  : m_Elems(elems)
+  , m_NumVertsPerElem(numVertsPerElem)
+  , m_LinkCount(linkCount)
+  {
+  }
 
-    for(size_t v = 0; v < numElems; ++v)
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t elemId = start; elemId < end; elemId++)
     {
-      T nelems = dynamicList->getNumberOfElements(v);
-      K* elems = dynamicList->getElementListPointer(v);
-      ::memcpy(bufPtr + offset, &nelems, sizeof(T));
-      offset += sizeof(T);
-      ::memcpy(bufPtr + offset, elems, nelems * sizeof(K));
-      offset += nelems * sizeof(K);
+      const K* verts = m_Elems + elemId * m_NumVertsPerElem;
+      for(size_t j = 0; j < m_NumVertsPerElem; j++)
+      {
+        m_LinkCount[verts[j]].fetch_add(1, std::memory_order_relaxed);
+      }
     }
+  }
 
-    rank = 1;
-    dims[0] = totalBytes;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
 
-    err = QH5Lite::writePointerDataset(parentId, name, rank, dims, bufPtr);
-    return err;
+private:
+  const K* m_Elems;
+  size_t m_NumVertsPerElem;
+  std::atomic<T>* m_LinkCount;
+};
+
+/**
+ * @brief The FillElementsContainingVertImpl class inserts a range of elements into the lists of the vertices they reference
+ */
+template <typename T, typename K> class FillElementsContainingVertImpl
+{
+public:
+  FillElementsContainingVertImpl(const K* elems, size_t numVertsPerElem, std::atomic<T>* linkLoc, DynamicListArray<T, K>* dynamicList)
+  : m_Elems(elems)
+  , m_NumVertsPerElem(numVertsPerElem)
+  , m_LinkLoc(linkLoc)
+  , m_DynamicList(dynamicList)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t elemId = start; elemId < end; elemId++)
+    {
+      const K* verts = m_Elems + elemId * m_NumVertsPerElem;
+      for(size_t j = 0; j < m_NumVertsPerElem; j++)
+      {
+        T pos = m_LinkLoc[verts[j]].fetch_add(1, std::memory_order_relaxed);
+        m_DynamicList->insertCellReference(verts[j], pos, elemId);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const K* m_Elems;
+  size_t m_NumVertsPerElem;
+  std::atomic<T>* m_LinkLoc;
+  DynamicListArray<T, K>* m_DynamicList;
+};
+
+/**
+ * @brief The SortElementListsImpl class sorts a range of lists so that the result does not depend on the order
+ * in which threads inserted their elements
+ */
+template <typename T, typename K> class SortElementListsImpl
+{
+public:
+  SortElementListsImpl(DynamicListArray<T, K>* dynamicList)
+  : m_DynamicList(dynamicList)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      K* list = m_DynamicList->getElementListPointer(i);
+      std::sort(list, list + m_DynamicList->getNumberOfElements(i));
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  DynamicListArray<T, K>* m_DynamicList;
+};
+
+/**
+ * @brief The FindElementNeighborsImpl class finds the neighbors of a range of elements. It runs in two passes:
+ * the first pass only records the number of neighbors of each element, and the second pass writes the neighbors
+ * into the lists that were allocated from those counts.
+ */
+template <typename T, typename K> class FindElementNeighborsImpl
+{
+public:
+  FindElementNeighborsImpl(const K* elems, size_t numVertsPerElem, size_t numSharedVerts, DynamicListArray<T, K>* elemsContainingVert, T* linkCount, DynamicListArray<T, K>* neighbors)
+  : m_Elems(elems)
+  , m_NumVertsPerElem(numVertsPerElem)
+  , m_NumSharedVerts(numSharedVerts)
+  , m_ElemsContainingVert(elemsContainingVert)
+  , m_LinkCount(linkCount)
+  , m_Neighbors(neighbors)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    // Scratch space is reused for every element in the range
+    std::vector<K> candidates;
+    std::vector<K> sortedCandidates;
+    std::vector<K> found;
+
+    for(size_t t = start; t < end; t++)
+    {
+      // Gather every element that shares at least one vertex with the seed element. An element that
+      // shares n vertices with the seed shows up exactly n times.
+      candidates.clear();
+      const K* seedElem = m_Elems + t * m_NumVertsPerElem;
+      for(size_t v = 0; v < m_NumVertsPerElem; v++)
+      {
+        T nEs = m_ElemsContainingVert->getNumberOfElements(seedElem[v]);
+        K* vertIdxs = m_ElemsContainingVert->getElementListPointer(seedElem[v]);
+        for(T vt = 0; vt < nEs; vt++)
+        {
+          if(vertIdxs[vt] != static_cast<K>(t))
+          {
+            candidates.push_back(vertIdxs[vt]);
+          }
+        }
+      }
+
+      sortedCandidates.assign(candidates.begin(), candidates.end());
+      std::sort(sortedCandidates.begin(), sortedCandidates.end());
+
+      // Keep the candidates in the order they were found, skipping the ones that were already added
+      found.clear();
+      for(const K& candidate : candidates)
+      {
+        auto range = std::equal_range(sortedCandidates.begin(), sortedCandidates.end(), candidate);
+        if(static_cast<size_t>(range.second - range.first) != m_NumSharedVerts)
+        {
+          continue;
+        }
+        if(std::find(found.begin(), found.end(), candidate) == found.end())
+        {
+          found.push_back(candidate);
+        }
+      }
+
+      if(nullptr == m_Neighbors)
+      {
+        m_LinkCount[t] = static_cast<T>(found.size());
+      }
+      else
+      {
+        std::copy(found.begin(), found.end(), m_Neighbors->getElementListPointer(t));
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const K* m_Elems;
+  size_t m_NumVertsPerElem;
+  size_t m_NumSharedVerts;
+  DynamicListArray<T, K>* m_ElemsContainingVert;
+  T* m_LinkCount;
+  DynamicListArray<T, K>* m_Neighbors;
+};
+
+/**
+ * @brief The GatherSubElementsImpl class writes the sorted vertex ids of every edge or face of a range of
+ * elements into a flat key array, so that duplicates can be found by sorting the keys
+ */
+template <typename T, size_t N> class GatherSubElementsImpl
+{
+public:
+  GatherSubElementsImpl(const T* elems, size_t numVertsPerElem, const std::vector<std::array<size_t, N>>& subElems, std::array<T, N>* keys)
+  : m_Elems(elems)
+  , m_NumVertsPerElem(numVertsPerElem)
+  , m_SubElems(subElems)
+  , m_Keys(keys)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    size_t numSubElems = m_SubElems.size();
+    for(size_t i = start; i < end; i++)
+    {
+      const T* verts = m_Elems + i * m_NumVertsPerElem;
+      for(size_t j = 0; j < numSubElems; j++)
+      {
+        std::array<T, N>& key = m_Keys[i * numSubElems + j];
+        for(size_t k = 0; k < N; k++)
+        {
+          key[k] = verts[m_SubElems[j][k]];
+        }
+        std::sort(key.begin(), key.end());
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
   }
+#endif
+
+private:
+  const T* m_Elems;
+  size_t m_NumVertsPerElem;
+  const std::vector<std::array<size_t, N>>& m_SubElems;
+  std::array<T, N>* m_Keys;
 };
 
 /**
@@ -274,38 +634,49 @@ public:
   {
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
+    const K* elems = elemList->getPointer(0);
 
-    // Allocate the basic structures
-    QVector<T> linkCount(numVerts, 0);
-    size_t elemId = 0;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+#endif
 
-    // Fill out lists with number of references to cells
-    typename DataArray<K>::Pointer linkLocPtr = DataArray<K>::CreateArray(numVerts, "_INTERNAL_USE_ONLY_Vertices");
-    linkLocPtr->initializeWithValue(0);
-    K* linkLoc = linkLocPtr->getPointer(0);
-    K* verts = nullptr;
-
-    // vtkPolyData *pdata = static_cast<vtkPolyData *>(data);
     // Traverse data to determine number of uses of each point
-    for(elemId = 0; elemId < numElems; elemId++)
+    std::vector<std::atomic<T>> linkCount(numVerts);
+    CountElementsContainingVertImpl<T, K> countImpl(elems, numVertsPerElem, linkCount.data());
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel == true)
     {
-      verts = elemList->getTuplePointer(elemId);
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        linkCount[verts[j]]++;
-      }
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), countImpl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      countImpl.compute(0, numElems);
     }
 
     // Now allocate storage for the links
-    dynamicList->allocateLists(linkCount);
+    QVector<T> linkCounts(numVerts, 0);
+    for(size_t v = 0; v < numVerts; v++)
+    {
+      linkCounts[v] = linkCount[v].load(std::memory_order_relaxed);
+      linkCount[v].store(0, std::memory_order_relaxed);
+    }
+    dynamicList->allocateLists(linkCounts);
 
-    for(elemId = 0; elemId < numElems; elemId++)
+    // Fill out lists with the references to each element, reusing the counts as the insert position
+    FillElementsContainingVertImpl<T, K> fillImpl(elems, numVertsPerElem, linkCount.data(), dynamicList.get());
+    SortElementListsImpl<T, K> sortImpl(dynamicList.get());
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel == true)
     {
-      verts = elemList->getTuplePointer(elemId);
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        dynamicList->insertCellReference(verts[j], (linkLoc[verts[j]])++, elemId);
-      }
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), fillImpl, tbb::auto_partitioner());
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numVerts), sortImpl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      // Serial inserts already arrive in ascending element order, so no sorting is needed
+      fillImpl.compute(0, numElems);
     }
   }
 
@@ -364,246 +735,188 @@ public:
       return -1;
     }
 
-    dynamicList->allocateLists(linkCount);
-
-    // Allocate an array of bools that we use each iteration so that we don't put duplicates into the array
-    typename DataArray<bool>::Pointer visitedPtr = DataArray<bool>::CreateArray(numElems, "_INTERNAL_USE_ONLY_Visited");
-    visitedPtr->initializeWithValue(false);
-    bool* visited = visitedPtr->getPointer(0);
+    const K* elems = elemList->getPointer(0);
 
-    // Reuse this vector for each loop. Avoids re-allocating the memory each time through the loop
-    QVector<K> loop_neighbors(32, 0);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+#endif
 
-    // Build up the element adjacency list now that we have the element links
-    for(size_t t = 0; t < numElems; ++t)
+    // First pass counts the neighbors of each element so every list can be sized exactly
+    FindElementNeighborsImpl<T, K> countImpl(elems, numVertsPerElem, numSharedVerts, elemsContainingVert.get(), linkCount.data(), nullptr);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel == true)
     {
-      //   qDebug() << "Analyzing Cell " << t << "\n";
-      K* seedElem = elemList->getTuplePointer(t);
-      for(size_t v = 0; v < numVertsPerElem; ++v)
-      {
-        //   qDebug() << " vert " << v << "\n";
-        T nEs = elemsContainingVert->getNumberOfElements(seedElem[v]);
-        K* vertIdxs = elemsContainingVert->getElementListPointer(seedElem[v]);
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), countImpl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      countImpl.compute(0, numElems);
+    }
 
-        for(T vt = 0; vt < nEs; ++vt)
-        {
-          if(vertIdxs[vt] == static_cast<K>(t))
-          {
-            continue;
-          } // This is the same element as our "source"
-          if(visited[vertIdxs[vt]] == true)
-          {
-            continue;
-          } // We already added this element so loop again
-          //      qDebug() << "   Comparing Element " << vertIdxs[vt] << "\n";
-          K* vertCell = elemList->getTuplePointer(vertIdxs[vt]);
-          size_t vCount = 0;
-          // Loop over all the vertex indices of this element and try to match numSharedVerts of them to the current loop element
-          // If there is numSharedVerts match then that element is a neighbor of the source. If there are more than numVertsPerElem
-          // matches then there is a real problem with the mesh and the program is going to return an error.
-          for(size_t i = 0; i < numVertsPerElem; i++)
-          {
-            for(size_t j = 0; j < numVertsPerElem; j++)
-            {
-              if(seedElem[i] == vertCell[j])
-              {
-                vCount++;
-              }
-            }
-          }
+    dynamicList->allocateLists(linkCount);
 
-          // So if our vertex match count is numSharedVerts and we have not visited the element in question then add this element index
-          // into the list of vertex indices as neighbors for the source element.
-          if(vCount == numSharedVerts)
-          {
-            // qDebug() << "       Neighbor: " << vertIdxs[vt] << "\n";
-            // Use the current count of neighbors as the index
-            // into the loop_neighbors vector and place the value of the vertex element at that index
-            loop_neighbors[linkCount[t]] = vertIdxs[vt];
-            linkCount[t]++; // Increment the count for the next time through
-            if(linkCount[t] >= loop_neighbors.size())
-            {
-              loop_neighbors.resize(loop_neighbors.size() + 10);
-            }
-            visited[vertIdxs[vt]] = true; // Set this element as visited so we do NOT add it again
-          }
-        }
-      }
-      // Reset all the visited cell indexs back to false (zero)
-      for(int64_t k = 0; k < linkCount[t]; ++k)
-      {
-        visited[loop_neighbors[k]] = false;
-      }
-      // Allocate the array storage for the current edge to hold its vertex list
-      dynamicList->setElementList(t, linkCount[t], &(loop_neighbors[0]));
+    // Second pass writes the neighbors straight into the allocated lists
+    FindElementNeighborsImpl<T, K> fillImpl(elems, numVertsPerElem, numSharedVerts, elemsContainingVert.get(), linkCount.data(), dynamicList.get());
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), fillImpl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      fillImpl.compute(0, numElems);
     }
 
     return err;
   }
 
   /**
-   * @brief Find2DElementEdges
+   * @brief FindUniqueSubElements Collects the edges or faces of every element, described by subElems as local
+   * vertex indices, and writes the distinct ones to subElemList in ascending order of their sorted vertex ids.
+   * The keys are deduplicated by sorting a flat array instead of inserting into a tree, which avoids an
+   * allocation per key and lets both the gather and the sort run in parallel.
    * @param elemList
-   * @param edgeList
+   * @param subElems
+   * @param unsharedOnly If true, only the edges or faces that belong to exactly one element are kept
+   * @param subElemList
    */
-  template <typename T> static void Find2DElementEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
+  template <typename T, size_t N>
+  static void FindUniqueSubElements(typename DataArray<T>::Pointer elemList, const std::vector<std::array<size_t, N>>& subElems, bool unsharedOnly, typename DataArray<T>::Pointer subElemList)
   {
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
-    T v0 = 0;
-    T v1 = 0;
 
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
+    std::vector<std::array<T, N>> keys(numElems * subElems.size());
+    GatherSubElementsImpl<T, N> gatherImpl(elemList->getPointer(0), numVertsPerElem, subElems, keys.data());
 
-    for(size_t i = 0; i < numElems; i++)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+    if(doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), gatherImpl, tbb::auto_partitioner());
+      tbb::parallel_sort(keys.begin(), keys.end());
+    }
+    else
+#endif
     {
-      T* verts = elemList->getTuplePointer(i);
+      gatherImpl.compute(0, numElems);
+      std::sort(keys.begin(), keys.end());
+    }
 
-      for(size_t j = 0; j < numVertsPerElem; j++)
+    // Compact the sorted keys in place, keeping each distinct key once or only the keys that occur once
+    size_t numKeys = keys.size();
+    size_t count = 0;
+    for(size_t i = 0; i < numKeys;)
+    {
+      size_t next = i + 1;
+      while(next < numKeys && keys[next] == keys[i])
       {
-        if(j == (numVertsPerElem - 1))
-        {
-          if(verts[j] > verts[0])
-          {
-            v0 = verts[0];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[0];
-          }
-        }
-        else
-        {
-          if(verts[j] > verts[j + 1])
-          {
-            v0 = verts[j + 1];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[j + 1];
-          }
-        }
-        edge = std::make_pair(v0, v1);
-        edgeSet.insert(edge);
+        next++;
+      }
+      if(!unsharedOnly || next - i == 1)
+      {
+        keys[count] = keys[i];
+        count++;
       }
+      i = next;
     }
 
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resize(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
+    subElemList->resize(count);
+    T* uSubElems = subElemList->getPointer(0);
+    for(size_t i = 0; i < count; i++)
     {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
+      for(size_t k = 0; k < N; k++)
+      {
+        uSubElems[N * i + k] = keys[i][k];
+      }
     }
   }
 
   /**
-   * @brief FindTetEdges
-   * @param tetList
-   * @param edgeList
+   * @brief Get2DElementEdges Returns the local vertex indices of the edges of a polygon with numVertsPerElem vertices
+   * @param numVertsPerElem
+   * @return
    */
-  template <typename T> static void FindTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
+  static std::vector<std::array<size_t, 2>> Get2DElementEdges(size_t numVertsPerElem)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
-
-    for(size_t i = 0; i < numElems; i++)
+    std::vector<std::array<size_t, 2>> edges(numVertsPerElem);
+    for(size_t j = 0; j < numVertsPerElem; j++)
     {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[0], verts[2]};
-      std::vector<T> edge2 = {verts[1], verts[2]};
-      std::vector<T> edge3 = {verts[0], verts[3]};
-      std::vector<T> edge4 = {verts[1], verts[3]};
-      std::vector<T> edge5 = {verts[2], verts[3]};
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeSet.insert(edge);
-      }
+      edges[j] = {{j, (j + 1) % numVertsPerElem}};
     }
+    return edges;
+  }
 
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resize(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
+  /**
+   * @brief GetTetEdges Returns the local vertex indices of the edges of a tetrahedron
+   * @return
+   */
+  static const std::vector<std::array<size_t, 2>>& GetTetEdges()
+  {
+    static const std::vector<std::array<size_t, 2>> edges = {{{0, 1}}, {{0, 2}}, {{1, 2}}, {{0, 3}}, {{1, 3}}, {{2, 3}}};
+    return edges;
+  }
 
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+  /**
+   * @brief GetHexEdges Returns the local vertex indices of the edges of a hexahedron
+   * @return
+   */
+  static const std::vector<std::array<size_t, 2>>& GetHexEdges()
+  {
+    static const std::vector<std::array<size_t, 2>> edges = {{{0, 1}}, {{1, 2}}, {{2, 3}}, {{3, 0}}, {{0, 4}}, {{1, 5}}, {{2, 6}}, {{3, 7}}, {{4, 5}}, {{5, 6}}, {{6, 7}}, {{7, 4}}};
+    return edges;
   }
 
   /**
-  * @brief FindHexEdges
-  * @param hexList
-  * @param edgeList
-  */
-  template <typename T> static void FindHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer edgeList)
+   * @brief GetTetFaces Returns the local vertex indices of the faces of a tetrahedron
+   * @return
+   */
+  static const std::vector<std::array<size_t, 3>>& GetTetFaces()
   {
-    size_t numElems = hexList->getNumberOfTuples();
+    static const std::vector<std::array<size_t, 3>> faces = {{{0, 1, 2}}, {{1, 2, 3}}, {{0, 2, 3}}, {{0, 1, 3}}};
+    return faces;
+  }
 
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
+  /**
+   * @brief GetHexFaces Returns the local vertex indices of the faces of a hexahedron
+   * @return
+   */
+  static const std::vector<std::array<size_t, 4>>& GetHexFaces()
+  {
+    static const std::vector<std::array<size_t, 4>> faces = {{{0, 1, 5, 4}}, {{1, 2, 6, 5}}, {{2, 3, 7, 6}}, {{3, 0, 4, 7}}, {{0, 1, 2, 3}}, {{4, 5, 6, 7}}};
+    return faces;
+  }
 
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[1], verts[2]};
-      std::vector<T> edge2 = {verts[2], verts[3]};
-      std::vector<T> edge3 = {verts[3], verts[0]};
-
-      std::vector<T> edge4 = {verts[0], verts[4]};
-      std::vector<T> edge5 = {verts[1], verts[5]};
-      std::vector<T> edge6 = {verts[2], verts[6]};
-      std::vector<T> edge7 = {verts[3], verts[7]};
-
-      std::vector<T> edge8 =  {verts[4], verts[5]};
-      std::vector<T> edge9 =  {verts[5], verts[6]};
-      std::vector<T> edge10 = {verts[6], verts[7]};
-      std::vector<T> edge11 = {verts[7], verts[4]};
-
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5,
-                                            edge6, edge7, edge8, edge9, edge10, edge11};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeSet.insert(edge);
-      }
-    }
+  /**
+   * @brief Find2DElementEdges
+   * @param elemList
+   * @param edgeList
+   */
+  template <typename T> static void Find2DElementEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
+  {
+    FindUniqueSubElements<T, 2>(elemList, Get2DElementEdges(elemList->getNumberOfComponents()), false, edgeList);
+  }
 
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resize(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
+  /**
+   * @brief FindTetEdges
+   * @param tetList
+   * @param edgeList
+   */
+  template <typename T> static void FindTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
+  {
+    FindUniqueSubElements<T, 2>(tetList, GetTetEdges(), false, edgeList);
+  }
 
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+  /**
+  * @brief FindHexEdges
+  * @param hexList
+  * @param edgeList
+  */
+  template <typename T> static void FindHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer edgeList)
+  {
+    FindUniqueSubElements<T, 2>(hexList, GetHexEdges(), false, edgeList);
   }
 
   /**
@@ -613,41 +926,7 @@ public:
    */
   template <typename T> static void FindTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::tuple<T, T, T> face;
-    std::set<std::tuple<T, T, T>> faceSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> tri0 = {verts[0], verts[1], verts[2]};
-      std::vector<T> tri1 = {verts[1], verts[2], verts[3]};
-      std::vector<T> tri2 = {verts[0], verts[2], verts[3]};
-      std::vector<T> tri3 = {verts[0], verts[1], verts[3]};
-      std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
-
-      for(auto&& tri : triList)
-      {
-        std::sort(tri.begin(), tri.end());
-        face = std::make_tuple(tri[0], tri[1], tri[2]);
-        faceSet.insert(face);
-      }
-    }
-
-    typename std::set<std::tuple<T, T, T>>::iterator setIter;
-    faceList->resize(faceSet.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
-    {
-      uFaces[3 * index] = std::get<0>(*setIter);
-      uFaces[3 * index + 1] = std::get<1>(*setIter);
-      uFaces[3 * index + 2] = std::get<2>(*setIter);
-      ++index;
-    }
+    FindUniqueSubElements<T, 3>(tetList, GetTetFaces(), false, faceList);
   }
 
   /**
@@ -657,45 +936,7 @@ public:
   */
   template <typename T> static void FindHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::tuple<T, T, T, T> face;
-    std::set<std::tuple<T, T, T, T>> faceSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> quad0 = {verts[0], verts[1], verts[5], verts[4]};
-      std::vector<T> quad1 = {verts[1], verts[2], verts[6], verts[5]};
-      std::vector<T> quad2 = {verts[2], verts[3], verts[7], verts[6]};
-      std::vector<T> quad3 = {verts[3], verts[0], verts[4], verts[7]};
-      std::vector<T> quad4 = {verts[0], verts[1], verts[2], verts[3]};
-      std::vector<T> quad5 = {verts[4], verts[5], verts[6], verts[7]};
-
-      std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
-
-      for(auto&& quad : quadList)
-      {
-        std::sort(quad.begin(), quad.end());
-        face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-        faceSet.insert(face);
-      }
-    }
-
-    typename std::set<std::tuple<T, T, T, T>>::iterator setIter;
-    faceList->resize(faceSet.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
-    {
-      uFaces[4 * index] = std::get<0>(*setIter);
-      uFaces[4 * index + 1] = std::get<1>(*setIter);
-      uFaces[4 * index + 2] = std::get<2>(*setIter);
-      uFaces[4 * index + 3] = std::get<3>(*setIter);
-      ++index;
-    }
+    FindUniqueSubElements<T, 4>(hexList, GetHexFaces(), false, faceList);
   }
 
   /**
@@ -705,75 +946,7 @@ public:
    */
   template <typename T> static void Find2DUnsharedEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = elemList->getNumberOfTuples();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
-    T v0 = 0;
-    T v1 = 0;
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = elemList->getTuplePointer(i);
-
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        if(j == (numVertsPerElem - 1))
-        {
-          if(verts[j] > verts[0])
-          {
-            v0 = verts[0];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[0];
-          }
-        }
-        else
-        {
-          if(verts[j] > verts[j + 1])
-          {
-            v0 = verts[j + 1];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[j + 1];
-          }
-        }
-        edge = std::make_pair(v0, v1);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resize(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    FindUniqueSubElements<T, 2>(elemList, Get2DElementEdges(elemList->getNumberOfComponents()), true, edgeList);
   }
 
   /**
@@ -783,55 +956,7 @@ public:
   */
   template <typename T> static void FindUnsharedTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[0], verts[2]};
-      std::vector<T> edge2 = {verts[1], verts[2]};
-      std::vector<T> edge3 = {verts[0], verts[3]};
-      std::vector<T> edge4 = {verts[1], verts[3]};
-      std::vector<T> edge5 = {verts[2], verts[3]};
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resize(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    FindUniqueSubElements<T, 2>(tetList, GetTetEdges(), true, edgeList);
   }
 
   /**
@@ -841,184 +966,385 @@ public:
   */
   template <typename T> static void FindUnsharedHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
+    FindUniqueSubElements<T, 2>(hexList, GetHexEdges(), true, edgeList);
+  }
 
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[1], verts[2]};
-      std::vector<T> edge2 = {verts[2], verts[3]};
-      std::vector<T> edge3 = {verts[3], verts[0]};
+  /**
+   * @brief FindUnsharedTetFaces
+   * @param tetList
+   * @param edgeList
+   */
+  template <typename T> static void FindUnsharedTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
+  {
+    FindUniqueSubElements<T, 3>(tetList, GetTetFaces(), true, faceList);
+  }
 
-      std::vector<T> edge4 = {verts[0], verts[4]};
-      std::vector<T> edge5 = {verts[1], verts[5]};
-      std::vector<T> edge6 = {verts[2], verts[6]};
-      std::vector<T> edge7 = {verts[3], verts[7]};
+  /**
+  * @brief FindUnsharedHexFaces
+  * @param hexList
+  * @param edgeList
+  */
+  template <typename T> static void FindUnsharedHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
+  {
+    FindUniqueSubElements<T, 4>(hexList, GetHexFaces(), true, faceList);
+  }
+};
 
-      std::vector<T> edge8 = {verts[4], verts[5]};
-      std::vector<T> edge9 = {verts[5], verts[6]};
-      std::vector<T> edge10 = {verts[6], verts[7]};
-      std::vector<T> edge11 = {verts[7], verts[4]};
+/**
+ * @brief The ElementCoordsBlock struct holds the vertex coordinates of a block of elements with
+ * one array per element vertex and axis. Once gathered, the per element arithmetic runs over
+ * contiguous lanes with no indirection, which the compiler can vectorize.
+ */
+template <size_t N> struct ElementCoordsBlock
+{
+  static const size_t k_Size = 64;
 
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5,
-                                            edge6, edge7, edge8, edge9, edge10, edge11};
+  float x[N][k_Size];
+  float y[N][k_Size];
+  float z[N][k_Size];
+  size_t count = 0;
 
-      for(auto&& uEdge : edgeList)
+  template <typename T> void gather(const T* elems, const float* vertex, size_t start, size_t end)
+  {
+    count = end - start;
+    for(size_t e = 0; e < count; e++)
+    {
+      const T* elem = elems + N * (start + e);
+      for(size_t v = 0; v < N; v++)
       {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeMap[edge]++;
+        const float* coords = vertex + 3 * elem[v];
+        x[v][e] = coords[0];
+        y[v][e] = coords[1];
+        z[v][e] = coords[2];
       }
     }
+  }
 
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
+  /**
+   * @brief determinant Returns the determinant of the edge vectors b - a, c - a and d - a of one lane,
+   * six times the signed volume of that tetrahedron
+   */
+  float determinant(size_t a, size_t b, size_t c, size_t d, size_t e) const
+  {
+    float g00 = x[b][e] - x[a][e];
+    float g01 = x[c][e] - x[a][e];
+    float g02 = x[d][e] - x[a][e];
+    float g10 = y[b][e] - y[a][e];
+    float g11 = y[c][e] - y[a][e];
+    float g12 = y[d][e] - y[a][e];
+    float g20 = z[b][e] - z[a][e];
+    float g21 = z[c][e] - z[a][e];
+    float g22 = z[d][e] - z[a][e];
+    return (g00 * (g11 * g22 - g12 * g21)) - (g01 * (g10 * g22 - g12 * g20)) + (g02 * (g10 * g21 - g11 * g20));
+  }
+};
 
-    while(mapIter != edgeMap.end())
+/**
+ * @brief The FindElementCentroidsImpl class averages the vertex coordinates of a range of elements
+ */
+template <typename T> class FindElementCentroidsImpl
+{
+public:
+  FindElementCentroidsImpl(const T* elems, size_t numVertsPerElem, const float* vertex, float* centroids)
+  : m_Elems(elems)
+  , m_NumVertsPerElem(numVertsPerElem)
+  , m_Vertex(vertex)
+  , m_Centroids(centroids)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
     {
-      if((*mapIter).second > 1)
+      const T* elem = m_Elems + i * m_NumVertsPerElem;
+      float centroid[3] = {0.0f, 0.0f, 0.0f};
+      for(size_t k = 0; k < m_NumVertsPerElem; k++)
       {
-        edgeMap.erase(mapIter++);
+        const float* coords = m_Vertex + 3 * elem[k];
+        centroid[0] += coords[0];
+        centroid[1] += coords[1];
+        centroid[2] += coords[2];
       }
-      else
+      for(size_t d = 0; d < 3; d++)
       {
-        ++mapIter;
+        m_Centroids[3 * i + d] = centroid[d] / static_cast<float>(m_NumVertsPerElem);
       }
     }
+  }
 
-    edgeList->resize(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const T* m_Elems;
+  size_t m_NumVertsPerElem;
+  const float* m_Vertex;
+  float* m_Centroids;
+};
+
+/**
+ * @brief The FindTriangleAreasImpl class computes the areas of a range of triangles from the length of their normals
+ */
+template <typename T> class FindTriangleAreasImpl
+{
+public:
+  FindTriangleAreasImpl(const T* tris, const float* vertex, float* areas)
+  : m_Tris(tris)
+  , m_Vertex(vertex)
+  , m_Areas(areas)
+  {
+  }
 
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
+  void compute(size_t start, size_t end) const
+  {
+    ElementCoordsBlock<3> block;
+    for(size_t first = start; first < end; first += ElementCoordsBlock<3>::k_Size)
     {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
+      block.gather(m_Tris, m_Vertex, first, std::min(first + ElementCoordsBlock<3>::k_Size, end));
+      float* areas = m_Areas + first;
+      for(size_t e = 0; e < block.count; e++)
+      {
+        float ax = block.x[1][e] - block.x[0][e];
+        float ay = block.y[1][e] - block.y[0][e];
+        float az = block.z[1][e] - block.z[0][e];
+        float bx = block.x[2][e] - block.x[0][e];
+        float by = block.y[2][e] - block.y[0][e];
+        float bz = block.z[2][e] - block.z[0][e];
+        float nx = ay * bz - az * by;
+        float ny = az * bx - ax * bz;
+        float nz = ax * by - ay * bx;
+        areas[e] = 0.5f * sqrtf(nx * nx + ny * ny + nz * nz);
+      }
     }
   }
 
-  /**
-   * @brief FindUnsharedTetFaces
-   * @param tetList
-   * @param edgeList
-   */
-  template <typename T> static void FindUnsharedTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
   {
-    size_t numElems = tetList->getNumberOfTuples();
+    compute(r.begin(), r.end());
+  }
+#endif
 
-    std::tuple<T, T, T> face;
-    std::map<std::tuple<T, T, T>, T> faceMap;
+private:
+  const T* m_Tris;
+  const float* m_Vertex;
+  float* m_Areas;
+};
 
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
+/**
+ * @brief The FindPolygonAreasImpl class computes the areas of a range of polygons by projecting each
+ * onto the coordinate plane most aligned with it
+ */
+template <typename T> class FindPolygonAreasImpl
+{
+public:
+  FindPolygonAreasImpl(const T* elems, int64_t numVertsPerElem, const float* vertex, float* areas)
+  : m_Elems(elems)
+  , m_NumVertsPerElem(numVertsPerElem)
+  , m_Vertex(vertex)
+  , m_Areas(areas)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    std::vector<float> coords(3 * m_NumVertsPerElem, 0.0f);
+    float* coordinates = coords.data();
+    float normal[3] = {0.0f, 0.0f, 0.0f};
 
-      std::vector<T> tri0 = {verts[0], verts[1], verts[2]};
-      std::vector<T> tri1 = {verts[1], verts[2], verts[3]};
-      std::vector<T> tri2 = {verts[0], verts[2], verts[3]};
-      std::vector<T> tri3 = {verts[0], verts[1], verts[3]};
-      std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
+    for(size_t i = start; i < end; i++)
+    {
+      const T* elem = m_Elems + i * m_NumVertsPerElem;
 
-      for(auto&& tri : triList)
+      // Create a contiguous vertex coordinates list
+      // This simplifies the pointer arithmetic a bit
+      for(int64_t j = 0; j < m_NumVertsPerElem; j++)
       {
-        std::sort(tri.begin(), tri.end());
-        face = std::make_tuple(tri[0], tri[1], tri[2]);
-        faceMap[face]++;
+        std::copy(m_Vertex + (3 * elem[j]), m_Vertex + (3 * elem[j] + 3), coordinates + (3 * j));
       }
-    }
 
-    typename std::map<std::tuple<T, T, T>, T>::iterator mapIter = faceMap.begin();
+      GeometryMath::FindPolygonNormal(coordinates, m_NumVertsPerElem, normal);
+      MatrixMath::Normalize3x1(normal);
 
-    while(mapIter != faceMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        faceMap.erase(mapIter++);
-      }
-      else
+      float nx = (normal[0] > 0.0 ? normal[0] : -normal[0]);
+      float ny = (normal[1] > 0.0 ? normal[1] : -normal[1]);
+      float nz = (normal[2] > 0.0 ? normal[2] : -normal[2]);
+      int32_t projection = (nx > ny ? (nx > nz ? 0 : 2) : (ny > nz ? 1 : 2));
+      size_t u = (projection == 0) ? 1 : 0;
+      size_t v = (projection == 2) ? 1 : 2;
+
+      float area = 0.0f;
+      for(int64_t j = 0; j < m_NumVertsPerElem; j++)
       {
-        ++mapIter;
+        const float* next = coordinates + 3 * ((j + 1) % m_NumVertsPerElem);
+        const float* nextNext = coordinates + 3 * ((j + 2) % m_NumVertsPerElem);
+        area += next[u] * (nextNext[v] - coordinates[3 * j + v]);
       }
-    }
-
-    faceList->resize(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
 
-    for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
-    {
-      uFaces[3 * index] = std::get<0>((*mapIter).first);
-      uFaces[3 * index + 1] = std::get<1>((*mapIter).first);
-      uFaces[3 * index + 2] = std::get<2>((*mapIter).first);
-      ++index;
+      float projected = (projection == 0) ? nx : ((projection == 1) ? ny : nz);
+      area /= (2.0f * projected);
+      m_Areas[i] = fabsf(area);
     }
   }
 
-  /**
-  * @brief FindUnsharedHexFaces
-  * @param hexList
-  * @param edgeList
-  */
-  template <typename T> static void FindUnsharedHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::tuple<T, T, T, T> face;
-    std::map<std::tuple<T, T, T, T>, T> faceMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
+    compute(r.begin(), r.end());
+  }
+#endif
 
-      std::vector<T> quad0 = {verts[0], verts[1], verts[5], verts[4]};
-      std::vector<T> quad1 = {verts[1], verts[2], verts[6], verts[5]};
-      std::vector<T> quad2 = {verts[2], verts[3], verts[7], verts[6]};
-      std::vector<T> quad3 = {verts[3], verts[0], verts[4], verts[7]};
-      std::vector<T> quad4 = {verts[0], verts[1], verts[2], verts[3]};
-      std::vector<T> quad5 = {verts[4], verts[5], verts[6], verts[7]};
+private:
+  const T* m_Elems;
+  int64_t m_NumVertsPerElem;
+  const float* m_Vertex;
+  float* m_Areas;
+};
 
-      std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
+/**
+ * @brief The FindTetMeasuresImpl class computes the volumes, Jacobians or minimum dihedral angles of a range of tetrahedra
+ */
+template <typename T> class FindTetMeasuresImpl
+{
+public:
+  enum class Measure
+  {
+    Volume,
+    Jacobian,
+    MinDihedralAngle
+  };
+
+  FindTetMeasuresImpl(const T* tets, const float* vertex, float* values, Measure measure)
+  : m_Tets(tets)
+  , m_Vertex(vertex)
+  , m_Values(values)
+  , m_Measure(measure)
+  {
+  }
 
-      for(auto&& quad : quadList)
+  void compute(size_t start, size_t end) const
+  {
+    ElementCoordsBlock<4> block;
+    for(size_t first = start; first < end; first += ElementCoordsBlock<4>::k_Size)
+    {
+      block.gather(m_Tets, m_Vertex, first, std::min(first + ElementCoordsBlock<4>::k_Size, end));
+      float* values = m_Values + first;
+      switch(m_Measure)
       {
-        std::sort(quad.begin(), quad.end());
-        face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-        faceMap[face]++;
+      case Measure::Volume:
+        for(size_t e = 0; e < block.count; e++)
+        {
+          values[e] = block.determinant(0, 1, 2, 3, e) / 6.0f;
+        }
+        break;
+      case Measure::Jacobian:
+        for(size_t e = 0; e < block.count; e++)
+        {
+          values[e] = block.determinant(0, 1, 2, 3, e);
+        }
+        break;
+      case Measure::MinDihedralAngle:
+        findMinDihedralAngles(block, values);
+        break;
       }
     }
+  }
 
-    typename std::map<std::tuple<T, T, T, T>, T>::iterator mapIter = faceMap.begin();
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
 
-    while(mapIter != faceMap.end())
+private:
+  const T* m_Tets;
+  const float* m_Vertex;
+  float* m_Values;
+  Measure m_Measure;
+
+  static void findMinDihedralAngles(const ElementCoordsBlock<4>& block, float* minAngles)
+  {
+    for(size_t e = 0; e < block.count; e++)
     {
-      if((*mapIter).second > 1)
-      {
-        faceMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
+      // find 5 edges needed to find 4 face normals
+      float v10[3] = {block.x[1][e] - block.x[0][e], block.y[1][e] - block.y[0][e], block.z[1][e] - block.z[0][e]};
+      float v20[3] = {block.x[2][e] - block.x[0][e], block.y[2][e] - block.y[0][e], block.z[2][e] - block.z[0][e]};
+      float v30[3] = {block.x[3][e] - block.x[0][e], block.y[3][e] - block.y[0][e], block.z[3][e] - block.z[0][e]};
+      float v21[3] = {block.x[2][e] - block.x[1][e], block.y[2][e] - block.y[1][e], block.z[2][e] - block.z[1][e]};
+      float v31[3] = {block.x[3][e] - block.x[1][e], block.y[3][e] - block.y[1][e], block.z[3][e] - block.z[1][e]};
+      // find 4 face-to-face normals
+      float norm1[3] = {(v10[1] * v20[2] - v10[2] * v20[1]), (v10[2] * v20[0] - v10[0] * v20[2]), (v10[0] * v20[1] - v10[1] * v20[0])};
+      float norm2[3] = {(v30[1] * v10[2] - v30[2] * v10[1]), (v30[2] * v10[0] - v30[0] * v10[2]), (v30[0] * v10[1] - v30[1] * v10[0])};
+      float norm3[3] = {(v20[1] * v30[2] - v20[2] * v30[1]), (v20[2] * v30[0] - v20[0] * v30[2]), (v20[0] * v30[1] - v20[1] * v30[0])};
+      float norm4[3] = {(v31[1] * v21[2] - v31[2] * v21[1]), (v31[2] * v21[0] - v31[0] * v21[2]), (v31[0] * v21[1] - v31[1] * v21[0])};
+      // find the magnitudes of each normal
+      float norm1mag = sqrtf(norm1[0] * norm1[0] + norm1[1] * norm1[1] + norm1[2] * norm1[2]);
+      float norm2mag = sqrtf(norm2[0] * norm2[0] + norm2[1] * norm2[1] + norm2[2] * norm2[2]);
+      float norm3mag = sqrtf(norm3[0] * norm3[0] + norm3[1] * norm3[1] + norm3[2] * norm3[2]);
+      float norm4mag = sqrtf(norm4[0] * norm4[0] + norm4[1] * norm4[1] + norm4[2] * norm4[2]);
+      // find angles between faces
+      float ang1 = (norm1[0] * norm2[0] + norm1[1] * norm2[1] + norm1[2] * norm2[2]) / (norm1mag * norm2mag);
+      float ang2 = (norm1[0] * norm3[0] + norm1[1] * norm3[1] + norm1[2] * norm3[2]) / (norm1mag * norm3mag);
+      float ang3 = (norm1[0] * norm4[0] + norm1[1] * norm4[1] + norm1[2] * norm4[2]) / (norm1mag * norm4mag);
+      float ang4 = (norm2[0] * norm3[0] + norm2[1] * norm3[1] + norm2[2] * norm3[2]) / (norm2mag * norm3mag);
+      float ang5 = (norm2[0] * norm4[0] + norm2[1] * norm4[1] + norm2[2] * norm4[2]) / (norm2mag * norm4mag);
+      float ang6 = (norm3[0] * norm4[0] + norm3[1] * norm4[1] + norm3[2] * norm4[2]) / (norm3mag * norm4mag);
+      // find the maximum ang value, which will be the minimum angle after the acos
+      float minAng = std::max(std::max(std::max(std::max(std::max(ang1, ang2), ang3), ang4), ang5), ang6);
+      minAngles[e] = SIMPLib::Constants::k_180OverPi * acosf(minAng);
     }
+  }
+};
 
-    faceList->resize(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
+/**
+ * @brief The FindHexVolumesImpl class computes the volumes of a range of hexahedra by splitting each into five tetrahedra
+ */
+template <typename T> class FindHexVolumesImpl
+{
+public:
+  FindHexVolumesImpl(const T* hexas, const float* vertex, float* volumes)
+  : m_Hexas(hexas)
+  , m_Vertex(vertex)
+  , m_Volumes(volumes)
+  {
+  }
 
-    for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
+  void compute(size_t start, size_t end) const
+  {
+    ElementCoordsBlock<8> block;
+    for(size_t first = start; first < end; first += ElementCoordsBlock<8>::k_Size)
     {
-      uFaces[4 * index] = std::get<0>((*mapIter).first);
-      uFaces[4 * index + 1] = std::get<1>((*mapIter).first);
-      uFaces[4 * index + 2] = std::get<2>((*mapIter).first);
-      uFaces[4 * index + 3] = std::get<3>((*mapIter).first);
-      ++index;
+      block.gather(m_Hexas, m_Vertex, first, std::min(first + ElementCoordsBlock<8>::k_Size, end));
+      float* volumes = m_Volumes + first;
+      for(size_t e = 0; e < block.count; e++)
+      {
+        float volume = block.determinant(0, 1, 3, 4, e) / 6.0f;
+        volume += block.determinant(1, 4, 5, 6, e) / 6.0f;
+        volume += block.determinant(1, 4, 6, 3, e) / 6.0f;
+        volume += block.determinant(1, 3, 6, 2, e) / 6.0f;
+        volume += block.determinant(3, 6, 7, 4, e) / 6.0f;
+        volumes[e] = volume;
+      }
     }
   }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const T* m_Hexas;
+  const float* m_Vertex;
+  float* m_Volumes;
 };
 
 /**
@@ -1040,23 +1366,22 @@ public:
   {
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
-    size_t numDims = 3;
-    float* elementCentroids = centroids->getPointer(0);
-    float* vertex = vertices->getPointer(0);
+    if(numElems == 0)
+    {
+      return;
+    }
+    FindElementCentroidsImpl<T> impl(elemList->getConstPointer(0), numVertsPerElem, vertices->getConstPointer(0), centroids->getPointer(0));
 
-    for(size_t i = 0; i < numDims; i++)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+    if(doParallel == true)
     {
-      for(size_t j = 0; j < numElems; j++)
-      {
-        T* Elem = elemList->getTuplePointer(j);
-        float vertPos = 0.0;
-        for(size_t k = 0; k < numVertsPerElem; k++)
-        {
-          vertPos += vertex[3 * Elem[k] + i];
-        }
-        vertPos /= static_cast<float>(numVertsPerElem);
-        elementCentroids[numDims * j + i] = vertPos;
-      }
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), impl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      impl.compute(0, numElems);
     }
   }
 
@@ -1068,88 +1393,45 @@ public:
    */
   template <typename T> static void Find2DElementAreas(typename DataArray<T>::Pointer elemList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer areas)
   {
-    float nx, ny, nz;
-    int32_t projection;
-
     size_t numElems = elemList->getNumberOfTuples();
     int64_t numVertsPerElem = static_cast<int64_t>(elemList->getNumberOfComponents());
-    if(numVertsPerElem < 3)
+    if(numVertsPerElem < 3 || numElems == 0)
     {
       return;
     }
-    float* vertex = vertices->getPointer(0);
+    const T* elems = elemList->getConstPointer(0);
+    const float* vertex = vertices->getConstPointer(0);
     float* elemAreas = areas->getPointer(0);
-    float normal[3] = {0.0f, 0.0f, 0.0f};
-    std::vector<float> coords(3 * numVertsPerElem, 0.0f);
-    float vert0[3] = {0.0f, 0.0f, 0.0f};
-    float vert1[3] = {0.0f, 0.0f, 0.0f};
-    float vert2[3] = {0.0f, 0.0f, 0.0f};
 
-    for(size_t i = 0; i < numElems; i++)
+    // Triangles are always planar, so their area comes straight from the cross product
+    if(numVertsPerElem == 3)
     {
-      float area = 0.0f;
-      T* elem = elemList->getTuplePointer(i);
-
-      // Create a contiguous vertex coordinates list
-      // This simplifies the pointer arithmetic a bit
-      for(int64_t j = 0; j < numVertsPerElem; j++)
+      FindTriangleAreasImpl<T> impl(elems, vertex, elemAreas);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      bool doParallel = true;
+      if(doParallel == true)
       {
-        std::copy(vertex + (3 * elem[j]), vertex + (3 * elem[j] + 3), coords.begin() + (3 * j));
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), impl, tbb::auto_partitioner());
       }
-
-      float* coordinates = coords.data();
-      GeometryMath::FindPolygonNormal(coordinates, numVertsPerElem, normal);
-      MatrixMath::Normalize3x1(normal);
-
-      nx = (normal[0] > 0.0 ? normal[0] : -normal[0]);
-      ny = (normal[1] > 0.0 ? normal[1] : -normal[1]);
-      nz = (normal[2] > 0.0 ? normal[2] : -normal[2]);
-      projection = (nx > ny ? (nx > nz ? 0 : 2) : (ny > nz ? 1 : 2));
-
-      for(int64_t j = 0; j < numVertsPerElem; j++)
+      else
+#endif
       {
-        std::copy(coordinates + (3 * j), coordinates + (3 * j + 3), vert0);
-        std::copy(coordinates + (3 * ((j + 1) % numVertsPerElem)), coordinates + (3 * ((j + 1) % numVertsPerElem) + 3), vert1);
-        std::copy(coordinates + (3 * ((j + 2) % numVertsPerElem)), coordinates + (3 * ((j + 2) % numVertsPerElem) + 3), vert2);
-
-        switch(projection)
-        {
-        case 0:
-        {
-          area += coordinates[3 * ((j + 1) % numVertsPerElem) + 1] * (coordinates[3 * ((j + 2) % numVertsPerElem) + 2] - coordinates[3 * j + 2]);
-          continue;
-        }
-        case 1:
-        {
-          area += coordinates[3 * ((j + 1) % numVertsPerElem) + 0] * (coordinates[3 * ((j + 2) % numVertsPerElem) + 2] - coordinates[3 * j + 2]);
-          continue;
-        }
-        case 2:
-        {
-          area += coordinates[3 * ((j + 1) % numVertsPerElem) + 0] * (coordinates[3 * ((j + 2) % numVertsPerElem) + 1] - coordinates[3 * j + 1]);
-          continue;
-        }
-        }
+        impl.compute(0, numElems);
       }
+      return;
+    }
 
-      switch(projection)
-      {
-      case 0:
-      {
-        area /= (2.0f * nx);
-        break;
-      }
-      case 1:
-      {
-        area /= (2.0f * ny);
-        break;
-      }
-      case 2:
-      {
-        area /= (2.0f * nz);
-      }
-      }
-      elemAreas[i] = fabsf(area);
+    FindPolygonAreasImpl<T> impl(elems, numVertsPerElem, vertex, elemAreas);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+    if(doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), impl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      impl.compute(0, numElems);
     }
   }
 
@@ -1161,24 +1443,7 @@ public:
    */
   template <typename T> static void FindTetVolumes(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer volumes)
   {
-    size_t numTets = tetList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
-    float* volumePtr = volumes->getPointer(0);
-
-    for(size_t i = 0; i < numTets; i++)
-    {
-      T* tet = tetList->getTuplePointer(i);
-      float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-      float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-      float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-      float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-
-      float vertMatrix[3][3] = {{vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0]},
-                                {vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1]},
-                                {vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2]}};
-
-      volumePtr[i] = (MatrixMath::Determinant3x3(vertMatrix) / 6.0f);
-    }
+    FindTetMeasures<T>(tetList, vertices, volumes, FindTetMeasuresImpl<T>::Measure::Volume);
   }
 
   /**
@@ -1190,62 +1455,22 @@ public:
   template <typename T> static void FindHexVolumes(typename DataArray<T>::Pointer hexList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer volumes)
   {
     size_t numHexas = hexList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
-    float* volumePtr = volumes->getPointer(0);
-
-    for(size_t i = 0; i < numHexas; i++)
-    {
-      // Subdivide each hexahedron into 5 tetrahedra & sum their volumes
-      std::vector<std::vector<int64_t>> subTets(5, std::vector<int64_t>(4, 0));
-      T* hex = hexList->getTuplePointer(i);
-
-      // First tetrahedron from hexahedron vertices (0, 1, 3, 4);
-      subTets[0][0] = hex[0];
-      subTets[0][1] = hex[1];
-      subTets[0][2] = hex[3];
-      subTets[0][3] = hex[4];
-
-      // Second tetrahedron from hexahedron vertices (1, 4, 5, 6);
-      subTets[1][0] = hex[1];
-      subTets[1][1] = hex[4];
-      subTets[1][2] = hex[5];
-      subTets[1][3] = hex[6];
-
-      // Third tetrahedron from hexahedron vertices (1, 4, 6, 3);
-      subTets[2][0] = hex[1];
-      subTets[2][1] = hex[3];
-      subTets[2][2] = hex[6];
-      subTets[2][3] = hex[3];
-
-      // Fourth tetrahedron from hexahedron vertices (1, 3, 6, 2);
-      subTets[3][0] = hex[1];
-      subTets[3][1] = hex[3];
-      subTets[3][2] = hex[6];
-      subTets[3][3] = hex[2];
-
-      // Fifth tetrahedron from hexahedron vertices (3, 6, 7, 4);
-      subTets[4][0] = hex[3];
-      subTets[4][1] = hex[6];
-      subTets[4][2] = hex[7];
-      subTets[4][3] = hex[4];
-
-      float volume = 0.0f;
-
-      for(auto&& tet : subTets)
-      {
-        float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-        float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-        float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-        float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-
-        float vertMatrix[3][3] = {{vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0]},
-                                  {vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1]},
-                                   {vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2]}};
-
-        volume += (MatrixMath::Determinant3x3(vertMatrix) / 6.0f);
-      }
+    if(numHexas == 0)
+    {
+      return;
+    }
+    FindHexVolumesImpl<T> impl(hexList->getConstPointer(0), vertices->getConstPointer(0), volumes->getPointer(0));
 
-      volumePtr[i] = volume;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+    if(doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numHexas), impl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      impl.compute(0, numHexas);
     }
   }
 
@@ -1257,25 +1482,7 @@ public:
   */
   template <typename T> static void FindTetJacobians(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer jacobians)
   {
-	  size_t numTets = tetList->getNumberOfTuples();
-	  float* vertex = vertices->getPointer(0);
-	  float* jacobianPtr = jacobians->getPointer(0);
-
-	  for (size_t i = 0; i < numTets; i++)
-	  {
-		  T* tet = tetList->getTuplePointer(i);
-		  //get vert positions
-		  float vert0[3] = { vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2] };
-		  float vert1[3] = { vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2] };
-		  float vert2[3] = { vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2] };
-		  float vert3[3] = { vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2] };
-		  //build jacobian matrix
-		  float vertMatrix[3][3] = { { vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0] },
-		  { vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1] },
-		  { vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2] } };
-		  //find jacobian, which is determinant of the jacobian matrix
-		  jacobianPtr[i] = MatrixMath::Determinant3x3(vertMatrix);
-	  }
+    FindTetMeasures<T>(tetList, vertices, jacobians, FindTetMeasuresImpl<T>::Measure::Jacobian);
   }
 
   /**
@@ -1286,52 +1493,320 @@ public:
   */
   template <typename T> static void FindTetMinDihedralAngles(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer minAngles)
   {
-	  size_t numTets = tetList->getNumberOfTuples();
-	  float* vertex = vertices->getPointer(0);
-	  float* minAnglesPtr = minAngles->getPointer(0);
-
-	  for (size_t i = 0; i < numTets; i++)
-	  {
-		  T* tet = tetList->getTuplePointer(i);
-		  //get vert positions
-		  float vert0[3] = { vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2] };
-		  float vert1[3] = { vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2] };
-		  float vert2[3] = { vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2] };
-		  float vert3[3] = { vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2] };
-		  //find 5 edges needed to find 4 face normals
-		  float v10[3] = { (vert1[0] - vert0[0]), (vert1[1] - vert0[1]), (vert1[2] - vert0[2]) };
-		  float v20[3] = { (vert2[0] - vert0[0]), (vert2[1] - vert0[1]), (vert2[2] - vert0[2]) };
-		  float v30[3] = { (vert3[0] - vert0[0]), (vert3[1] - vert0[1]), (vert3[2] - vert0[2]) };
-		  float v21[3] = { (vert2[0] - vert1[0]), (vert2[1] - vert1[1]), (vert2[2] - vert1[2]) };
-		  float v31[3] = { (vert3[0] - vert1[0]), (vert3[1] - vert1[1]), (vert3[2] - vert1[2]) };
-		  //find 4 face-to-face normals
-		  float norm1[3] = { (v10[1] * v20[2] - v10[2] * v20[1]), (v10[2] * v20[0] - v10[0] * v20[2]), (v10[0] * v20[1] - v10[1] * v20[0]) };
-		  float norm2[3] = { (v30[1] * v10[2] - v30[2] * v10[1]), (v30[2] * v10[0] - v30[0] * v10[2]), (v30[0] * v10[1] - v30[1] * v10[0]) };
-		  float norm3[3] = { (v20[1] * v30[2] - v20[2] * v30[1]), (v20[2] * v30[0] - v20[0] * v30[2]), (v20[0] * v30[1] - v20[1] * v30[0]) };
-		  float norm4[3] = { (v31[1] * v21[2] - v31[2] * v21[1]), (v31[2] * v21[0] - v31[0] * v21[2]), (v31[0] * v21[1] - v31[1] * v21[0]) };
-		  //find the magnitudes of each normal
-		  float norm1mag = sqrtf(norm1[0] * norm1[0] + norm1[1] * norm1[1] + norm1[2] * norm1[2]);
-		  float norm2mag = sqrtf(norm2[0] * norm2[0] + norm2[1] * norm2[1] + norm2[2] * norm2[2]);
-		  float norm3mag = sqrtf(norm3[0] * norm3[0] + norm3[1] * norm3[1] + norm3[2] * norm3[2]);
-		  float norm4mag = sqrtf(norm4[0] * norm4[0] + norm4[1] * norm4[1] + norm4[2] * norm4[2]);
-		  //find angles between faces
-		  float ang1 = (norm1[0] * norm2[0] + norm1[1] * norm2[1] + norm1[2] * norm2[2]) / (norm1mag * norm2mag);
-		  float ang2 = (norm1[0] * norm3[0] + norm1[1] * norm3[1] + norm1[2] * norm3[2]) / (norm1mag * norm3mag);
-		  float ang3 = (norm1[0] * norm4[0] + norm1[1] * norm4[1] + norm1[2] * norm4[2]) / (norm1mag * norm4mag);
-		  float ang4 = (norm2[0] * norm3[0] + norm2[1] * norm3[1] + norm2[2] * norm3[2]) / (norm2mag * norm3mag);
-		  float ang5 = (norm2[0] * norm4[0] + norm2[1] * norm4[1] + norm2[2] * norm4[2]) / (norm2mag * norm4mag);
-		  float ang6 = (norm3[0] * norm4[0] + norm3[1] * norm4[1] + norm3[2] * norm4[2]) / (norm3mag * norm4mag);
-		  //find the maximum ang value, which will be the minimum angle after the acos
-		  float minAng = ang1;
-		  if (ang2 > minAng) { minAng = ang2; }
-		  if (ang3 > minAng) { minAng = ang3; }
-		  if (ang4 > minAng) { minAng = ang4; }
-		  if (ang5 > minAng) { minAng = ang5; }
-		  if (ang6 > minAng) { minAng = ang6; }
-
-		  minAnglesPtr[i] = SIMPLib::Constants::k_180OverPi * acosf(minAng);
-	  }
+    FindTetMeasures<T>(tetList, vertices, minAngles, FindTetMeasuresImpl<T>::Measure::MinDihedralAngle);
+  }
+
+private:
+  /**
+   * @brief FindTetMeasures Computes one per tetrahedron measure for every tetrahedron in the list
+   * @param tetList
+   * @param vertices
+   * @param values
+   * @param measure
+   */
+  template <typename T>
+  static void FindTetMeasures(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer values, typename FindTetMeasuresImpl<T>::Measure measure)
+  {
+    size_t numTets = tetList->getNumberOfTuples();
+    if(numTets == 0)
+    {
+      return;
+    }
+    FindTetMeasuresImpl<T> impl(tetList->getConstPointer(0), vertices->getConstPointer(0), values->getPointer(0), measure);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+    if(doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numTets), impl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      impl.compute(0, numTets);
+    }
+  }
+};
+
+/**
+ * @brief The Search class holds the tests used to decide whether an element contains a point.
+ * Points within the given tolerance of an element, or within a small parametric tolerance of
+ * its faces, count as inside so that points on shared faces are always found.
+ */
+class Search
+{
+public:
+  Search() = default;
+  virtual ~Search() = default;
+
+  /**
+   * @brief PointOnEdge
+   * @param p
+   * @param v0
+   * @param v1
+   * @param tolerance Largest distance between the point and the edge
+   * @return
+   */
+  static bool PointOnEdge(const float* p, const float* v0, const float* v1, float tolerance)
+  {
+    double d[3] = {double(v1[0]) - v0[0], double(v1[1]) - v0[1], double(v1[2]) - v0[2]};
+    double w[3] = {double(p[0]) - v0[0], double(p[1]) - v0[1], double(p[2]) - v0[2]};
+    double dd = d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+    double t = 0.0;
+    if(dd > 0.0)
+    {
+      t = (w[0] * d[0] + w[1] * d[1] + w[2] * d[2]) / dd;
+      if(t < -ParametricTolerance() || t > 1.0 + ParametricTolerance())
+      {
+        return false;
+      }
+      t = std::min(std::max(t, 0.0), 1.0);
+    }
+    double dist2 = 0.0;
+    for(size_t i = 0; i < 3; i++)
+    {
+      double diff = w[i] - t * d[i];
+      dist2 += diff * diff;
+    }
+    return dist2 <= double(tolerance) * tolerance;
+  }
+
+  /**
+   * @brief PointInTriangle
+   * @param p
+   * @param v0
+   * @param v1
+   * @param v2
+   * @param tolerance Largest distance between the point and the plane of the triangle
+   * @return
+   */
+  static bool PointInTriangle(const float* p, const float* v0, const float* v1, const float* v2, float tolerance)
+  {
+    double e0[3] = {double(v1[0]) - v0[0], double(v1[1]) - v0[1], double(v1[2]) - v0[2]};
+    double e1[3] = {double(v2[0]) - v0[0], double(v2[1]) - v0[1], double(v2[2]) - v0[2]};
+    double w[3] = {double(p[0]) - v0[0], double(p[1]) - v0[1], double(p[2]) - v0[2]};
+    double n[3] = {e0[1] * e1[2] - e0[2] * e1[1], e0[2] * e1[0] - e0[0] * e1[2], e0[0] * e1[1] - e0[1] * e1[0]};
+    double nn = n[0] * n[0] + n[1] * n[1] + n[2] * n[2];
+    if(nn <= 0.0)
+    {
+      return false;
+    }
+    double dist = (w[0] * n[0] + w[1] * n[1] + w[2] * n[2]) / std::sqrt(nn);
+    if(std::fabs(dist) > tolerance)
+    {
+      return false;
+    }
+    // Barycentric weights of v1 and v2 for the projection of the point onto the plane
+    double u = ((w[1] * e1[2] - w[2] * e1[1]) * n[0] + (w[2] * e1[0] - w[0] * e1[2]) * n[1] + (w[0] * e1[1] - w[1] * e1[0]) * n[2]) / nn;
+    double v = ((e0[1] * w[2] - e0[2] * w[1]) * n[0] + (e0[2] * w[0] - e0[0] * w[2]) * n[1] + (e0[0] * w[1] - e0[1] * w[0]) * n[2]) / nn;
+    return u >= -ParametricTolerance() && v >= -ParametricTolerance() && u + v <= 1.0 + ParametricTolerance();
+  }
+
+  /**
+   * @brief PointInQuad Tests the two triangles (v0, v1, v2) and (v0, v2, v3) of the quadrilateral
+   * @param p
+   * @param v0
+   * @param v1
+   * @param v2
+   * @param v3
+   * @param tolerance Largest distance between the point and the plane of the quadrilateral
+   * @return
+   */
+  static bool PointInQuad(const float* p, const float* v0, const float* v1, const float* v2, const float* v3, float tolerance)
+  {
+    return PointInTriangle(p, v0, v1, v2, tolerance) || PointInTriangle(p, v0, v2, v3, tolerance);
+  }
+
+  /**
+   * @brief PointInTet
+   * @param p
+   * @param v0
+   * @param v1
+   * @param v2
+   * @param v3
+   * @return
+   */
+  static bool PointInTet(const float* p, const float* v0, const float* v1, const float* v2, const float* v3)
+  {
+    double e1[3] = {double(v1[0]) - v0[0], double(v1[1]) - v0[1], double(v1[2]) - v0[2]};
+    double e2[3] = {double(v2[0]) - v0[0], double(v2[1]) - v0[1], double(v2[2]) - v0[2]};
+    double e3[3] = {double(v3[0]) - v0[0], double(v3[1]) - v0[1], double(v3[2]) - v0[2]};
+    double w[3] = {double(p[0]) - v0[0], double(p[1]) - v0[1], double(p[2]) - v0[2]};
+    double det = Determinant(e1, e2, e3);
+    if(det == 0.0)
+    {
+      return false;
+    }
+    double l1 = Determinant(w, e2, e3) / det;
+    double l2 = Determinant(e1, w, e3) / det;
+    double l3 = Determinant(e1, e2, w) / det;
+    double l0 = 1.0 - l1 - l2 - l3;
+    return l0 >= -ParametricTolerance() && l1 >= -ParametricTolerance() && l2 >= -ParametricTolerance() && l3 >= -ParametricTolerance();
+  }
+
+  /**
+   * @brief PointInHex Splits the hexahedron into five tetrahedra and tests each. The vertices
+   * follow the VTK ordering, with 0-3 on the bottom face and 4-7 above them.
+   * @param p
+   * @param v Pointers to the coordinates of the eight vertices
+   * @return
+   */
+  static bool PointInHex(const float* p, const float* const v[8])
+  {
+    return PointInTet(p, v[1], v[3], v[4], v[6]) || PointInTet(p, v[0], v[1], v[3], v[4]) || PointInTet(p, v[1], v[2], v[3], v[6]) || PointInTet(p, v[1], v[4], v[5], v[6]) ||
+           PointInTet(p, v[3], v[4], v[6], v[7]);
+  }
+
+private:
+  /**
+   * @brief ParametricTolerance
+   * @return How far outside the [0, 1] range a parametric coordinate may fall
+   */
+  static double ParametricTolerance()
+  {
+    return 1.0e-5;
+  }
+
+  /**
+   * @brief Determinant Returns the determinant of the matrix with columns a, b and c
+   */
+  static double Determinant(const double* a, const double* b, const double* c)
+  {
+    return a[0] * (b[1] * c[2] - b[2] * c[1]) - b[0] * (a[1] * c[2] - a[2] * c[1]) + c[0] * (a[1] * b[2] - a[2] * b[1]);
+  }
+};
+
+/**
+ * @brief The AverageVertexArrayValuesImpl class averages a vertex array over the vertices of a range of elements.
+ * When distances are given, each vertex value is weighted by its distance to the element centroid.
+ */
+template <typename T, typename K> class AverageVertexArrayValuesImpl
+{
+public:
+  AverageVertexArrayValuesImpl(const T* elems, size_t numVertsPerElem, const K* vertArray, size_t numComps, float* elemArray, const float* vertex = nullptr, const float* centroids = nullptr)
+  : m_Elems(elems)
+  , m_NumVertsPerElem(numVertsPerElem)
+  , m_VertArray(vertArray)
+  , m_NumComps(numComps)
+  , m_ElemArray(elemArray)
+  , m_Vertex(vertex)
+  , m_Centroids(centroids)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    if(nullptr == m_Vertex)
+    {
+      for(size_t j = start; j < end; j++)
+      {
+        const T* elem = m_Elems + j * m_NumVertsPerElem;
+        for(size_t i = 0; i < m_NumComps; i++)
+        {
+          float vertValue = 0.0;
+          for(size_t k = 0; k < m_NumVertsPerElem; k++)
+          {
+            vertValue += m_VertArray[m_NumComps * elem[k] + i];
+          }
+          vertValue /= static_cast<float>(m_NumVertsPerElem);
+          m_ElemArray[m_NumComps * j + i] = vertValue;
+        }
+      }
+      return;
+    }
+
+    std::vector<float> vertCentDist(m_NumVertsPerElem, 0.0f);
+    for(size_t j = start; j < end; j++)
+    {
+      const T* elem = m_Elems + j * m_NumVertsPerElem;
+      const float* centroid = m_Centroids + 3 * j;
+      float sumDist = 0.0;
+      for(size_t k = 0; k < m_NumVertsPerElem; k++)
+      {
+        const float* coords = m_Vertex + 3 * elem[k];
+        float dist = 0.0f;
+        for(size_t d = 0; d < 3; d++)
+        {
+          dist += (coords[d] - centroid[d]) * (coords[d] - centroid[d]);
+        }
+        vertCentDist[k] = sqrtf(dist);
+        sumDist += vertCentDist[k];
+      }
+      for(size_t i = 0; i < m_NumComps; i++)
+      {
+        float vertValue = 0.0;
+        for(size_t k = 0; k < m_NumVertsPerElem; k++)
+        {
+          vertValue += m_VertArray[m_NumComps * elem[k] + i] * vertCentDist[k];
+        }
+        vertValue /= sumDist;
+        m_ElemArray[m_NumComps * j + i] = vertValue;
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const T* m_Elems;
+  size_t m_NumVertsPerElem;
+  const K* m_VertArray;
+  size_t m_NumComps;
+  float* m_ElemArray;
+  const float* m_Vertex;
+  const float* m_Centroids;
+};
+
+/**
+ * @brief The AverageCellArrayValuesImpl class averages a cell array over the elements that contain each vertex of a range
+ */
+template <typename T, typename K, typename L, typename M> class AverageCellArrayValuesImpl
+{
+public:
+  AverageCellArrayValuesImpl(DynamicListArray<L, T>* elemsContainingVert, const K* elemArray, size_t numComps, M* vertArray)
+  : m_ElemsContainingVert(elemsContainingVert)
+  , m_ElemArray(elemArray)
+  , m_NumComps(numComps)
+  , m_VertArray(vertArray)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t j = start; j < end; j++)
+    {
+      L numElemsPerVert = m_ElemsContainingVert->getNumberOfElements(j);
+      T* elemIdxs = m_ElemsContainingVert->getElementListPointer(j);
+      double weight = 1.0 / numElemsPerVert;
+      for(size_t i = 0; i < m_NumComps; i++)
+      {
+        M vertValue = 0.0;
+        for(size_t k = 0; k < numElemsPerVert; k++)
+        {
+          vertValue += static_cast<M>(m_ElemArray[m_NumComps * elemIdxs[k] + i] * weight);
+        }
+        m_VertArray[m_NumComps * j + i] = vertValue;
+      }
+    }
   }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  DynamicListArray<L, T>* m_ElemsContainingVert;
+  const K* m_ElemArray;
+  size_t m_NumComps;
+  M* m_VertArray;
 };
 
 /**
@@ -1354,26 +1829,25 @@ public:
     Q_ASSERT(outElemArray->getComponentDimensions() == inVertexArray->getComponentDimensions());
     Q_ASSERT(elemList->getNumberOfTuples() == outElemArray->getNumberOfTuples());
 
-    K* vertArray = inVertexArray->getPointer(0);
-    float* elemArray = outElemArray->getPointer(0);
-
     size_t numElems = outElemArray->getNumberOfTuples();
     size_t numDims = inVertexArray->getNumberOfComponents();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
+    if(numElems == 0)
+    {
+      return;
+    }
+    AverageVertexArrayValuesImpl<T, K> impl(elemList->getConstPointer(0), numVertsPerElem, inVertexArray->getConstPointer(0), numDims, outElemArray->getPointer(0));
 
-    for(size_t i = 0; i < numDims; i++)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+    if(doParallel == true)
     {
-      for(size_t j = 0; j < numElems; j++)
-      {
-        T* Elem = elemList->getTuplePointer(j);
-        float vertValue = 0.0;
-        for(size_t k = 0; k < numVertsPerElem; k++)
-        {
-          vertValue += vertArray[numDims * Elem[k] + i];
-        }
-        vertValue /= static_cast<float>(numVertsPerElem);
-        elemArray[numDims * j + i] = vertValue;
-      }
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), impl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      impl.compute(0, numElems);
     }
   }
 
@@ -1392,47 +1866,26 @@ public:
     Q_ASSERT(outElemArray->getNumberOfTuples() == elemList->getNumberOfTuples());
     Q_ASSERT(outElemArray->getComponentDimensions() == inVertexArray->getComponentDimensions());
 
-    K* vertArray = inVertexArray->getPointer(0);
-    float* elemArray = outElemArray->getPointer(0);
-    float* elementCentroids = centroids->getPointer(0);
-    float* vertex = vertices->getPointer(0);
-
     size_t numElems = outElemArray->getNumberOfTuples();
     size_t cDims = inVertexArray->getNumberOfComponents();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
-    size_t numDims = 3;
-
-    // Vector to hold vertex-centroid distances, 4 per cell
-    std::vector<float> vertCentDist(numElems * numVertsPerElem);
-
-    for(size_t i = 0; i < numElems; i++)
+    if(numElems == 0)
     {
-      T* Elem = elemList->getTuplePointer(i);
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        for(size_t k = 0; k < numDims; k++)
-        {
-          vertCentDist[numVertsPerElem * i + j] += (vertex[numDims * Elem[j] + k] - elementCentroids[numDims * i + k]) * (vertex[numDims * Elem[j] + k] - elementCentroids[numDims * i + k]);
-        }
-        vertCentDist[numVertsPerElem * i + j] = sqrtf(vertCentDist[numVertsPerElem * i + j]);
-      }
+      return;
     }
+    AverageVertexArrayValuesImpl<T, K> impl(elemList->getConstPointer(0), numVertsPerElem, inVertexArray->getConstPointer(0), cDims, outElemArray->getPointer(0), vertices->getConstPointer(0),
+                                            centroids->getConstPointer(0));
 
-    for(size_t i = 0; i < cDims; i++)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+    if(doParallel == true)
     {
-      for(size_t j = 0; j < numElems; j++)
-      {
-        T* Elem = elemList->getTuplePointer(j);
-        float vertValue = 0.0;
-        float sumDist = 0.0;
-        for(size_t k = 0; k < numVertsPerElem; k++)
-        {
-          vertValue += vertArray[cDims * Elem[k] + i] * vertCentDist[numVertsPerElem * j + k];
-          sumDist += vertCentDist[numVertsPerElem * j + k];
-        }
-        vertValue /= static_cast<float>(sumDist);
-        elemArray[cDims * j + i] = vertValue;
-      }
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), impl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      impl.compute(0, numElems);
     }
   }
 
@@ -1443,26 +1896,24 @@ public:
     Q_ASSERT(outVertexArray->getNumberOfTuples() == vertices->getNumberOfTuples());
     Q_ASSERT(outVertexArray->getComponentDimensions() == inElemArray->getComponentDimensions());
 
-    K* elemArray = inElemArray->getPointer(0);
-    M* vertArray = outVertexArray->getPointer(0);
-
     size_t numVerts = vertices->getNumberOfTuples();
     size_t cDims = inElemArray->getNumberOfComponents();
+    if(numVerts == 0)
+    {
+      return;
+    }
+    AverageCellArrayValuesImpl<T, K, L, M> impl(elemsContainingVert.get(), inElemArray->getConstPointer(0), cDims, outVertexArray->getPointer(0));
 
-    for(size_t i = 0; i < cDims; i++)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    bool doParallel = true;
+    if(doParallel == true)
     {
-      for(size_t j = 0; j < numVerts; j++)
-      {
-        L numElemsPerVert = elemsContainingVert->getNumberOfElements(j);
-        T* elemIdxs = elemsContainingVert->getElementListPointer(j);
-        M vertValue = 0.0;
-        double weight = 1.0 / numElemsPerVert;
-        for(size_t k = 0; k < numElemsPerVert; k++)
-        {
-          vertValue += static_cast<M>(elemArray[cDims * elemIdxs[k] + i] * weight);
-        }
-        vertArray[cDims * j + i] = vertValue;
-      }
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numVerts), impl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      impl.compute(0, numVerts);
     }
   }
 };
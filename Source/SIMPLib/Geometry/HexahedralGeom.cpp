@@ -585,13 +585,48 @@ void HexahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArray
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int HexahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf))
+int64_t HexahedralGeom::findCell(const float coords[3])
+{
+  ElementSpatialIndex::Pointer index = getElementSpatialIndex();
+  if(nullptr == index.get())
+  {
+    return -1;
+  }
+  const float* vertices = m_VertexList->getConstPointer(0);
+  const int64_t* hexas = m_HexList->getConstPointer(0);
+  return index->findElement(coords, [&](int64_t hexId) {
+    const int64_t* hex = hexas + 8 * hexId;
+    const float* verts[8];
+    for(size_t i = 0; i < 8; i++)
+    {
+      verts[i] = vertices + 3 * hex[i];
+    }
+    return GeometryHelpers::Search::PointInHex(coords, verts);
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementSpatialIndex::Pointer HexahedralGeom::createElementSpatialIndex()
+{
+  if(nullptr == m_VertexList.get() || nullptr == m_HexList.get())
+  {
+    return ElementSpatialIndex::NullPointer();
+  }
+  return ElementSpatialIndex::New(m_VertexList, m_HexList);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int HexahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf), const H5DatasetCreationPolicy& policy)
 {
   herr_t err = 0;
 
   if(m_VertexList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VertexList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VertexList, policy);
     if(err < 0)
     {
       return err;
@@ -600,7 +635,7 @@ int HexahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writ
 
   if(m_EdgeList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_EdgeList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_EdgeList, policy);
     if(err < 0)
     {
       return err;
@@ -609,7 +644,7 @@ int HexahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writ
 
   if(m_QuadList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_QuadList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_QuadList, policy);
     if(err < 0)
     {
       return err;
@@ -618,7 +653,7 @@ int HexahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writ
 
   if(m_HexList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_HexList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_HexList, policy);
     if(err < 0)
     {
       return err;
@@ -627,7 +662,7 @@ int HexahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writ
 
   if(m_UnsharedEdgeList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedEdgeList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedEdgeList, policy);
     if(err < 0)
     {
       return err;
@@ -636,7 +671,7 @@ int HexahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writ
 
   if(m_UnsharedQuadList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedQuadList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedQuadList, policy);
     if(err < 0)
     {
       return err;
@@ -645,7 +680,7 @@ int HexahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writ
 
   if(m_HexCentroids.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_HexCentroids);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_HexCentroids, policy);
     if(err < 0)
     {
       return err;
@@ -654,7 +689,7 @@ int HexahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writ
 
   if(m_HexSizes.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_HexSizes);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_HexSizes, policy);
     if(err < 0)
     {
       return err;
@@ -664,7 +699,7 @@ int HexahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writ
   if(m_HexNeighbors.get() != nullptr)
   {
     size_t numHexas = getNumberOfHexas();
-    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_HexNeighbors, numHexas, SIMPL::StringConstants::HexNeighbors);
+    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_HexNeighbors, numHexas, SIMPL::StringConstants::HexNeighbors, policy);
     if(err < 0)
     {
       return err;
@@ -674,7 +709,7 @@ int HexahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writ
   if(m_HexasContainingVert.get() != nullptr)
   {
     size_t numVerts = getNumberOfVertices();
-    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_HexasContainingVert, numVerts, SIMPL::StringConstants::HexasContainingVert);
+    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_HexasContainingVert, numVerts, SIMPL::StringConstants::HexasContainingVert, policy);
     if(err < 0)
     {
       return err;
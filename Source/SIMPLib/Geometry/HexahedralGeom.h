@@ -294,6 +294,13 @@ class SIMPLib_EXPORT HexahedralGeom : public IGeometry3D
      */
     void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr) override;
 
+    /**
+     * @brief findCell
+     * @param coords
+     * @return
+     */
+    int64_t findCell(const float coords[3]) override;
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -305,9 +312,10 @@ class SIMPLib_EXPORT HexahedralGeom : public IGeometry3D
      * @brief writeGeometryToHDF5
      * @param parentId
      * @param writeXdmf
+     * @param policy The chunking/compression policy used for the geometry lists
      * @return
      */
-    int writeGeometryToHDF5(hid_t parentId, bool writeXdmf) override;
+    int writeGeometryToHDF5(hid_t parentId, bool writeXdmf, const H5DatasetCreationPolicy& policy = H5DatasetCreationPolicy()) override;
 
     /**
      * @brief writeXdmf
@@ -491,6 +499,12 @@ class SIMPLib_EXPORT HexahedralGeom : public IGeometry3D
 
     HexahedralGeom();
 
+    /**
+     * @brief createElementSpatialIndex
+     * @return
+     */
+    ElementSpatialIndex::Pointer createElementSpatialIndex() override;
+
     /**
      * @brief setElementsContainingVert
      * @param elementsContainingVert
@@ -34,17 +34,62 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 #include "SIMPLib/Geometry/IGeometry.h"
+
+#include <QtCore/QMutexLocker>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
 #include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Utilities.h"
 #include "SIMPLib/Geometry/CompositeTransformContainer.h"
 #include "SIMPLib/Geometry/TransformContainer.h"
 
+/**
+ * @brief The FindCellsImpl class locates a range of points with IGeometry::findCell()
+ */
+class FindCellsImpl
+{
+public:
+  FindCellsImpl(IGeometry* geom, const float* coords, int64_t* cellIds)
+  : m_Geom(geom)
+  , m_Coords(coords)
+  , m_CellIds(cellIds)
+  {
+  }
+  virtual ~FindCellsImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      m_CellIds[i] = m_Geom->findCell(m_Coords + 3 * i);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  IGeometry* m_Geom;
+  const float* m_Coords;
+  int64_t* m_CellIds;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 IGeometry::IGeometry()
 : m_TimeValue(0.0f)
 , m_EnableTimeSeries(false)
+, m_HasElementSpatialIndex(false)
 {
 }
 
@@ -108,6 +153,80 @@ void IGeometry::sendThreadSafeProgressMessage(int64_t counter, int64_t max)
   m_Mutex.unlock();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t IGeometry::findCell(const float coords[3])
+{
+  (void)coords;
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometry::findCells(const float* coords, size_t numPoints, int64_t* cellIds)
+{
+  if(numPoints == 0)
+  {
+    return;
+  }
+
+  // The first query builds the spatial index and loads the geometry lists before the threads start
+  cellIds[0] = findCell(coords);
+
+  FindCellsImpl impl(this, coords, cellIds);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(1, numPoints), impl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    impl.compute(1, numPoints);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometry::deleteElementSpatialIndex()
+{
+  if(m_HasElementSpatialIndex.load(std::memory_order_acquire))
+  {
+    QMutexLocker locker(&m_SpatialIndexMutex);
+    m_ElementSpatialIndex = ElementSpatialIndex::NullPointer();
+    m_HasElementSpatialIndex.store(false, std::memory_order_release);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementSpatialIndex::Pointer IGeometry::getElementSpatialIndex()
+{
+  if(!m_HasElementSpatialIndex.load(std::memory_order_acquire))
+  {
+    QMutexLocker locker(&m_SpatialIndexMutex);
+    if(!m_HasElementSpatialIndex.load(std::memory_order_relaxed))
+    {
+      m_ElementSpatialIndex = createElementSpatialIndex();
+      m_HasElementSpatialIndex.store(true, std::memory_order_release);
+    }
+  }
+  return m_ElementSpatialIndex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementSpatialIndex::Pointer IGeometry::createElementSpatialIndex()
+{
+  return ElementSpatialIndex::NullPointer();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -222,7 +341,7 @@ AttributeMatrix::Pointer IGeometry::removeAttributeMatrix(const QString& name)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int IGeometry::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf))
+int IGeometry::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf), const H5DatasetCreationPolicy& SIMPL_NOT_USED(policy))
 {
   herr_t err = 0;
   if(m_TransformContainer)
@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include <QMutex>
 #include <QtCore/QMap>
 #include <QtCore/QString>
@@ -44,6 +46,7 @@
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/DynamicListArray.hpp"
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Geometry/ElementSpatialIndex.h"
 #include "SIMPLib/Geometry/ITransformContainer.h"
 #include "SIMPLib/SIMPLib.h"
 
@@ -246,6 +249,34 @@ class SIMPLib_EXPORT IGeometry : public Observable
      */
     virtual void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable) = 0;
 
+// -----------------------------------------------------------------------------
+// Spatial Queries
+// -----------------------------------------------------------------------------
+
+    /**
+     * @brief findCell Returns the element that contains the point. Unstructured geometries
+     * build a spatial index over their elements on the first call and reuse it afterwards;
+     * the index is dropped whenever the vertex or element lists are resized or replaced.
+     * Writing coordinates through the raw pointers requires calling deleteElementSpatialIndex().
+     * Geometries that do not support point location keep the default, which always returns -1.
+     * @param coords
+     * @return The element Id or -1 if the point lies outside the geometry
+     */
+    virtual int64_t findCell(const float coords[3]);
+
+    /**
+     * @brief findCells Locates a batch of points in parallel
+     * @param coords Point coordinates, 3 per point
+     * @param numPoints
+     * @param cellIds Output element Ids, -1 for the points outside the geometry
+     */
+    virtual void findCells(const float* coords, size_t numPoints, int64_t* cellIds);
+
+    /**
+     * @brief deleteElementSpatialIndex
+     */
+    virtual void deleteElementSpatialIndex() final;
+
 // -----------------------------------------------------------------------------
 // Generic
 // -----------------------------------------------------------------------------
@@ -345,9 +376,10 @@ class SIMPLib_EXPORT IGeometry : public Observable
      * @brief writeGeometryToHDF5
      * @param parentId
      * @param writeXdmf
+     * @param policy The chunking/compression policy used for the geometry lists
      * @return
      */
-    virtual int writeGeometryToHDF5(hid_t parentId, bool writeXdmf) = 0;
+    virtual int writeGeometryToHDF5(hid_t parentId, bool writeXdmf, const H5DatasetCreationPolicy& policy = H5DatasetCreationPolicy()) = 0;
 
     /**
      * @brief writeXdmf
@@ -412,6 +444,10 @@ class SIMPLib_EXPORT IGeometry : public Observable
     QMutex m_Mutex;
     int64_t m_ProgressCounter;
 
+    ElementSpatialIndex::Pointer m_ElementSpatialIndex;
+    std::atomic<bool> m_HasElementSpatialIndex;
+    QMutex m_SpatialIndexMutex;
+
     /**
      * @brief sendThreadSafeProgressMessage
      * @param counter
@@ -419,6 +455,20 @@ class SIMPLib_EXPORT IGeometry : public Observable
      */
     virtual void sendThreadSafeProgressMessage(int64_t counter, int64_t max) final;
 
+    /**
+     * @brief getElementSpatialIndex Returns the spatial index, building it on first use. Safe to
+     * call from several threads at once.
+     * @return
+     */
+    virtual ElementSpatialIndex::Pointer getElementSpatialIndex() final;
+
+    /**
+     * @brief createElementSpatialIndex Builds the spatial index over the elements of the geometry.
+     * Geometries that locate points arithmetically do not need one.
+     * @return
+     */
+    virtual ElementSpatialIndex::Pointer createElementSpatialIndex();
+
     /**
      * @brief setElementsContaingVert
      * @param elementsContaingVert
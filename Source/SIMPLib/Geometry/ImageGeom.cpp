@@ -52,6 +52,8 @@
 #include <tbb/task_scheduler_init.h>
 #endif
 
+#include <QtCore/QMutexLocker>
+
 #include "H5Support/H5Lite.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
@@ -417,6 +419,7 @@ ImageGeom::ImageGeom()
   m_Origin[1] = 0.0f;
   m_Origin[2] = 0.0f;
   m_VoxelSizes = FloatArrayType::NullPointer();
+  m_GeneratedElementSizes = false;
   m_ProgressCounter = 0;
 }
 
@@ -480,6 +483,23 @@ SIMPL::Tuple6FVec ImageGeom::getBoundingBox()
       );
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float ImageGeom::getElementSize(size_t SIMPL_NOT_USED(idx))
+{
+  return m_Resolution[0] * m_Resolution[1] * m_Resolution[2];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ImageGeom::hasGeneratedElementSizes()
+{
+  QMutexLocker locker(&m_ElementSizesMutex);
+  return m_GeneratedElementSizes;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -788,10 +808,13 @@ int ImageGeom::findElementSizes()
 
   if(res[0] <= 0.0f || res[1] <= 0.0f || res[2] <= 0.0f)
   {
+    deleteElementSizes();
     return -1;
   }
-  m_VoxelSizes = FloatArrayType::CreateArray(getNumberOfElements(), SIMPL::StringConstants::VoxelSizes);
-  m_VoxelSizes->initializeWithValue(res[0] * res[1] * res[2]);
+  // Every voxel has the same size, so the array is only created if someone asks for it
+  QMutexLocker locker(&m_ElementSizesMutex);
+  m_VoxelSizes = FloatArrayType::NullPointer();
+  m_GeneratedElementSizes = true;
   return 1;
 }
 
@@ -800,15 +823,37 @@ int ImageGeom::findElementSizes()
 // -----------------------------------------------------------------------------
 FloatArrayType::Pointer ImageGeom::getElementSizes()
 {
+  QMutexLocker locker(&m_ElementSizesMutex);
+  if(m_GeneratedElementSizes)
+  {
+    // The resolution and dimensions can change after findElementSizes(), so recreate a stale array
+    size_t numElements = getNumberOfElements();
+    if(nullptr == m_VoxelSizes.get() || m_VoxelSizes->getNumberOfTuples() != numElements || (numElements > 0 && m_VoxelSizes->getValue(0) != getElementSize(0)))
+    {
+      m_VoxelSizes = generateElementSizes();
+    }
+  }
   return m_VoxelSizes;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FloatArrayType::Pointer ImageGeom::generateElementSizes()
+{
+  FloatArrayType::Pointer voxelSizes = FloatArrayType::CreateArray(getNumberOfElements(), SIMPL::StringConstants::VoxelSizes);
+  voxelSizes->initializeWithValue(getElementSize(0));
+  return voxelSizes;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void ImageGeom::setElementSizes(FloatArrayType::Pointer elementSizes)
 {
+  QMutexLocker locker(&m_ElementSizesMutex);
   m_VoxelSizes = elementSizes;
+  m_GeneratedElementSizes = false;
 }
 
 // -----------------------------------------------------------------------------
@@ -816,7 +861,9 @@ void ImageGeom::setElementSizes(FloatArrayType::Pointer elementSizes)
 // -----------------------------------------------------------------------------
 void ImageGeom::deleteElementSizes()
 {
+  QMutexLocker locker(&m_ElementSizesMutex);
   m_VoxelSizes = FloatArrayType::NullPointer();
+  m_GeneratedElementSizes = false;
 }
 
 // -----------------------------------------------------------------------------
@@ -917,7 +964,30 @@ void ImageGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType:
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int ImageGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf))
+int64_t ImageGeom::findCell(const float coords[3])
+{
+  size_t cell[3] = {0, 0, 0};
+  for(size_t i = 0; i < 3; i++)
+  {
+    if(m_Dimensions[i] == 0 || m_Resolution[i] <= 0.0f)
+    {
+      return -1;
+    }
+    float offset = (coords[i] - m_Origin[i]) / m_Resolution[i];
+    if(!(offset >= 0.0f && offset <= static_cast<float>(m_Dimensions[i])))
+    {
+      return -1;
+    }
+    // Points on the upper boundary belong to the last cell
+    cell[i] = std::min(static_cast<size_t>(offset), m_Dimensions[i] - 1);
+  }
+  return static_cast<int64_t>((cell[2] * m_Dimensions[1] + cell[1]) * m_Dimensions[0] + cell[0]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ImageGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf), const H5DatasetCreationPolicy& policy)
 {
   herr_t err = 0;
   int64_t volDims[3] = {static_cast<int64_t>(getXPoints()), static_cast<int64_t>(getYPoints()), static_cast<int64_t>(getZPoints())};
@@ -944,14 +1014,27 @@ int ImageGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf
   {
     return err;
   }
-  if(m_VoxelSizes.get() != nullptr)
+  if(hasGeneratedElementSizes())
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VoxelSizes);
+    // Generated sizes are recreated from the spacing when the file is read
+    err = QH5Lite::writeScalarAttribute(parentId, ".", SIMPL::Geometry::GeneratedElementSizes, static_cast<int32_t>(1));
     if(err < 0)
     {
       return err;
     }
   }
+  else
+  {
+    FloatArrayType::Pointer elementSizes = getElementSizes();
+    if(nullptr != elementSizes.get())
+    {
+      err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, elementSizes, policy);
+      if(err < 0)
+      {
+        return err;
+      }
+    }
+  }
 
   err = H5Gclose(parentId);
 
@@ -1074,8 +1157,15 @@ IGeometry::Pointer ImageGeom::deepCopy(bool forceNoAllocate)
   imageCopy->setDimensions(volDims);
   imageCopy->setResolution(spacing);
   imageCopy->setOrigin(origin);
-  FloatArrayType::Pointer elementSizes = std::dynamic_pointer_cast<FloatArrayType>((getElementSizes().get() == nullptr) ? nullptr : getElementSizes()->deepCopy(forceNoAllocate));
-  imageCopy->setElementSizes(elementSizes);
+  if(hasGeneratedElementSizes())
+  {
+    imageCopy->findElementSizes();
+  }
+  else
+  {
+    FloatArrayType::Pointer elementSizes = std::dynamic_pointer_cast<FloatArrayType>((getElementSizes().get() == nullptr) ? nullptr : getElementSizes()->deepCopy(forceNoAllocate));
+    imageCopy->setElementSizes(elementSizes);
+  }
   imageCopy->setSpatialDimensionality(getSpatialDimensionality());
 
   return imageCopy;
@@ -1110,6 +1200,10 @@ int ImageGeom::gatherMetaData(hid_t parentId, size_t volDims[3], float spacing[3
   setResolution(spacing);
   setOrigin(origin);
   setElementSizes(voxelSizes);
+  if(nullptr == voxelSizes.get() && QH5Lite::findAttribute(parentId, SIMPL::Geometry::GeneratedElementSizes) == 1)
+  {
+    findElementSizes();
+  }
 
   return err;
 }
@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <QtCore/QMutex>
+
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Geometry/IGeometryGrid.h"
 
@@ -121,6 +123,22 @@ class SIMPLib_EXPORT ImageGeom : public IGeometryGrid
      */
     SIMPL::Tuple6FVec getBoundingBox();
 
+    /**
+     * @brief getElementSize Returns the size of a voxel straight from the resolution, without
+     * creating the element sizes array. Every voxel of an image has the same size.
+     * @param idx
+     * @return
+     */
+    float getElementSize(size_t idx);
+
+    /**
+     * @brief hasGeneratedElementSizes Returns true if the element sizes were found with findElementSizes().
+     * Generated sizes are only stored in memory once getElementSizes() is called and are written to
+     * HDF5 as a flag that recreates them from the resolution when the file is read.
+     * @return
+     */
+    bool hasGeneratedElementSizes();
+
 // -----------------------------------------------------------------------------
 // Inherited from IGeometry
 // -----------------------------------------------------------------------------
@@ -224,6 +242,13 @@ class SIMPLib_EXPORT ImageGeom : public IGeometryGrid
      */
     void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr) override;
 
+    /**
+     * @brief findCell
+     * @param coords
+     * @return
+     */
+    int64_t findCell(const float coords[3]) override;
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -235,9 +260,10 @@ class SIMPLib_EXPORT ImageGeom : public IGeometryGrid
      * @brief writeGeometryToHDF5
      * @param parentId
      * @param writeXdmf
+     * @param policy The chunking/compression policy used for the geometry lists
      * @return
      */
-    int writeGeometryToHDF5(hid_t parentId, bool writeXdmf) override;
+    int writeGeometryToHDF5(hid_t parentId, bool writeXdmf, const H5DatasetCreationPolicy& policy = H5DatasetCreationPolicy()) override;
 
     /**
      * @brief writeXdmf
@@ -387,6 +413,14 @@ class SIMPLib_EXPORT ImageGeom : public IGeometryGrid
 
   private:
     FloatArrayType::Pointer m_VoxelSizes;
+    bool m_GeneratedElementSizes;
+    QMutex m_ElementSizesMutex;
+
+    /**
+     * @brief generateElementSizes Creates the element sizes array from the current resolution
+     * @return
+     */
+    FloatArrayType::Pointer generateElementSizes();
 
     friend class FindImageDerivativesImpl;
 
@@ -528,13 +528,44 @@ void QuadGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int QuadGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf))
+int64_t QuadGeom::findCell(const float coords[3])
+{
+  ElementSpatialIndex::Pointer index = getElementSpatialIndex();
+  if(nullptr == index.get())
+  {
+    return -1;
+  }
+  const float* vertices = m_VertexList->getConstPointer(0);
+  const int64_t* quads = m_QuadList->getConstPointer(0);
+  float tolerance = index->getTolerance();
+  return index->findElement(coords, [&](int64_t quadId) {
+    const int64_t* quad = quads + 4 * quadId;
+    return GeometryHelpers::Search::PointInQuad(coords, vertices + 3 * quad[0], vertices + 3 * quad[1], vertices + 3 * quad[2], vertices + 3 * quad[3], tolerance);
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementSpatialIndex::Pointer QuadGeom::createElementSpatialIndex()
+{
+  if(nullptr == m_VertexList.get() || nullptr == m_QuadList.get())
+  {
+    return ElementSpatialIndex::NullPointer();
+  }
+  return ElementSpatialIndex::New(m_VertexList, m_QuadList);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int QuadGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf), const H5DatasetCreationPolicy& policy)
 {
   herr_t err = 0;
 
   if(m_VertexList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VertexList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VertexList, policy);
     if(err < 0)
     {
       return err;
@@ -543,7 +574,7 @@ int QuadGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf)
 
   if(m_EdgeList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_EdgeList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_EdgeList, policy);
     if(err < 0)
     {
       return err;
@@ -552,7 +583,7 @@ int QuadGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf)
 
   if(m_QuadList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_QuadList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_QuadList, policy);
     if(err < 0)
     {
       return err;
@@ -561,7 +592,7 @@ int QuadGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf)
 
   if(m_UnsharedEdgeList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedEdgeList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedEdgeList, policy);
     if(err < 0)
     {
       return err;
@@ -570,7 +601,7 @@ int QuadGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf)
 
   if(m_QuadCentroids.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_QuadCentroids);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_QuadCentroids, policy);
     if(err < 0)
     {
       return err;
@@ -579,7 +610,7 @@ int QuadGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf)
 
   if(m_QuadSizes.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_QuadSizes);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_QuadSizes, policy);
     if(err < 0)
     {
       return err;
@@ -589,7 +620,7 @@ int QuadGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf)
   if(m_QuadNeighbors.get() != nullptr)
   {
     size_t numQuads = getNumberOfQuads();
-    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_QuadNeighbors, numQuads, SIMPL::StringConstants::QuadNeighbors);
+    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_QuadNeighbors, numQuads, SIMPL::StringConstants::QuadNeighbors, policy);
     if(err < 0)
     {
       return err;
@@ -599,7 +630,7 @@ int QuadGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf)
   if(m_QuadsContainingVert.get() != nullptr)
   {
     size_t numVerts = getNumberOfVertices();
-    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_QuadsContainingVert, numVerts, SIMPL::StringConstants::QuadsContainingVert);
+    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_QuadsContainingVert, numVerts, SIMPL::StringConstants::QuadsContainingVert, policy);
     if(err < 0)
     {
       return err;
@@ -52,6 +52,8 @@
 #include <tbb/task_scheduler_init.h>
 #endif
 
+#include <QtCore/QMutexLocker>
+
 #include "H5Support/H5Lite.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
@@ -415,6 +417,7 @@ RectGridGeom::RectGridGeom()
   m_yBounds = FloatArrayType::NullPointer();
   m_zBounds = FloatArrayType::NullPointer();
   m_VoxelSizes = FloatArrayType::NullPointer();
+  m_GeneratedElementSizes = false;
   m_ProgressCounter = 0;
 }
 
@@ -451,6 +454,7 @@ void RectGridGeom::setXBounds(FloatArrayType::Pointer xBnds)
     }
   }
   m_xBounds = xBnds;
+  releaseGeneratedElementSizes();
 }
 
 // -----------------------------------------------------------------------------
@@ -466,6 +470,7 @@ void RectGridGeom::setYBounds(FloatArrayType::Pointer yBnds)
     }
   }
   m_yBounds = yBnds;
+  releaseGeneratedElementSizes();
 }
 
 // -----------------------------------------------------------------------------
@@ -481,6 +486,34 @@ void RectGridGeom::setZBounds(FloatArrayType::Pointer zBnds)
     }
   }
   m_zBounds = zBnds;
+  releaseGeneratedElementSizes();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float RectGridGeom::getElementSize(size_t idx)
+{
+  if(nullptr == m_xBounds.get() || nullptr == m_yBounds.get() || nullptr == m_zBounds.get())
+  {
+    return 0.0f;
+  }
+  size_t x = idx % m_Dimensions[0];
+  size_t y = (idx / m_Dimensions[0]) % m_Dimensions[1];
+  size_t z = idx / (m_Dimensions[0] * m_Dimensions[1]);
+  const float* xBnds = m_xBounds->getConstPointer(0);
+  const float* yBnds = m_yBounds->getConstPointer(0);
+  const float* zBnds = m_zBounds->getConstPointer(0);
+  return (zBnds[z + 1] - zBnds[z]) * (yBnds[y + 1] - yBnds[y]) * (xBnds[x + 1] - xBnds[x]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool RectGridGeom::hasGeneratedElementSizes()
+{
+  QMutexLocker locker(&m_ElementSizesMutex);
+  return m_GeneratedElementSizes;
 }
 
 // -----------------------------------------------------------------------------
@@ -811,44 +844,98 @@ void RectGridGeom::deleteElementCentroids()
 // -----------------------------------------------------------------------------
 int RectGridGeom::findElementSizes()
 {
-  m_VoxelSizes = FloatArrayType::CreateArray(getNumberOfElements(), SIMPL::StringConstants::VoxelSizes);
+  if(!hasIncreasingBounds())
+  {
+    deleteElementSizes();
+    return -1;
+  }
+  // The sizes are separable products of the 1-D spacings, so the array is only created if someone asks for it
+  QMutexLocker locker(&m_ElementSizesMutex);
+  m_VoxelSizes = FloatArrayType::NullPointer();
+  m_GeneratedElementSizes = true;
+  return 1;
+}
 
-  float* sizes = m_VoxelSizes->getPointer(0);
-  float* xBnds = m_xBounds->getPointer(0);
-  float* yBnds = m_yBounds->getPointer(0);
-  float* zBnds = m_zBounds->getPointer(0);
-  float xRes = 0.0f;
-  float yRes = 0.0f;
-  float zRes = 0.0f;
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FloatArrayType::Pointer RectGridGeom::getElementSizes()
+{
+  QMutexLocker locker(&m_ElementSizesMutex);
+  if(m_GeneratedElementSizes && nullptr == m_VoxelSizes.get())
+  {
+    m_VoxelSizes = generateElementSizes();
+  }
+  return m_VoxelSizes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool RectGridGeom::hasIncreasingBounds()
+{
+  FloatArrayType::Pointer bounds[3] = {m_xBounds, m_yBounds, m_zBounds};
+  for(size_t i = 0; i < 3; i++)
+  {
+    if(nullptr == bounds[i].get() || bounds[i]->getNumberOfTuples() < m_Dimensions[i] + 1)
+    {
+      return false;
+    }
+    const float* bnds = bounds[i]->getConstPointer(0);
+    for(size_t j = 0; j < m_Dimensions[i]; j++)
+    {
+      if(bnds[j + 1] - bnds[j] <= 0.0f)
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FloatArrayType::Pointer RectGridGeom::generateElementSizes()
+{
+  if(!hasIncreasingBounds())
+  {
+    return FloatArrayType::NullPointer();
+  }
+  FloatArrayType::Pointer voxelSizes = FloatArrayType::CreateArray(getNumberOfElements(), SIMPL::StringConstants::VoxelSizes);
+
+  float* sizes = voxelSizes->getPointer(0);
+  const float* xBnds = m_xBounds->getConstPointer(0);
+  const float* yBnds = m_yBounds->getConstPointer(0);
+  const float* zBnds = m_zBounds->getConstPointer(0);
 
   for(size_t z = 0; z < m_Dimensions[2]; z++)
   {
+    float zRes = zBnds[z + 1] - zBnds[z];
     for(size_t y = 0; y < m_Dimensions[1]; y++)
     {
+      float yzRes = zRes * (yBnds[y + 1] - yBnds[y]);
+      float* row = sizes + (m_Dimensions[0] * m_Dimensions[1] * z) + (m_Dimensions[0] * y);
       for(size_t x = 0; x < m_Dimensions[0]; x++)
       {
-        xRes = xBnds[x + 1] - xBnds[x];
-        yRes = yBnds[y + 1] - yBnds[y];
-        zRes = zBnds[z + 1] - zBnds[z];
-        if(xRes <= 0.0f || yRes <= 0.0f || zRes <= 0.0f)
-        {
-          m_VoxelSizes = FloatArrayType::NullPointer();
-          return -1;
-        }
-        sizes[(m_Dimensions[0] * m_Dimensions[1] * z) + (m_Dimensions[0] * y) + x] = zRes * yRes * xRes;
+        row[x] = yzRes * (xBnds[x + 1] - xBnds[x]);
       }
     }
   }
 
-  return 1;
+  return voxelSizes;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-FloatArrayType::Pointer RectGridGeom::getElementSizes()
+void RectGridGeom::releaseGeneratedElementSizes()
 {
-  return m_VoxelSizes;
+  QMutexLocker locker(&m_ElementSizesMutex);
+  if(m_GeneratedElementSizes)
+  {
+    m_VoxelSizes = FloatArrayType::NullPointer();
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -856,7 +943,9 @@ FloatArrayType::Pointer RectGridGeom::getElementSizes()
 // -----------------------------------------------------------------------------
 void RectGridGeom::setElementSizes(FloatArrayType::Pointer elementSizes)
 {
+  QMutexLocker locker(&m_ElementSizesMutex);
   m_VoxelSizes = elementSizes;
+  m_GeneratedElementSizes = false;
 }
 
 // -----------------------------------------------------------------------------
@@ -864,7 +953,9 @@ void RectGridGeom::setElementSizes(FloatArrayType::Pointer elementSizes)
 // -----------------------------------------------------------------------------
 void RectGridGeom::deleteElementSizes()
 {
+  QMutexLocker locker(&m_ElementSizesMutex);
   m_VoxelSizes = FloatArrayType::NullPointer();
+  m_GeneratedElementSizes = false;
 }
 
 // -----------------------------------------------------------------------------
@@ -962,7 +1053,37 @@ void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int RectGridGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf))
+int64_t RectGridGeom::findCell(const float coords[3])
+{
+  FloatArrayType::Pointer bounds[3] = {m_xBounds, m_yBounds, m_zBounds};
+  size_t cell[3] = {0, 0, 0};
+  for(size_t i = 0; i < 3; i++)
+  {
+    if(nullptr == bounds[i].get() || bounds[i]->getNumberOfTuples() < 2)
+    {
+      return -1;
+    }
+    size_t numBounds = bounds[i]->getNumberOfTuples();
+    const float* bnds = bounds[i]->getConstPointer(0);
+    if(!(coords[i] >= bnds[0] && coords[i] <= bnds[numBounds - 1]))
+    {
+      return -1;
+    }
+    // Points on the upper boundary belong to the last cell
+    size_t upper = static_cast<size_t>(std::upper_bound(bnds, bnds + numBounds, coords[i]) - bnds);
+    cell[i] = std::min(upper, numBounds - 1) - 1;
+    if(cell[i] >= m_Dimensions[i])
+    {
+      return -1;
+    }
+  }
+  return static_cast<int64_t>((cell[2] * m_Dimensions[1] + cell[1]) * m_Dimensions[0] + cell[0]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int RectGridGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf), const H5DatasetCreationPolicy& policy)
 {
   herr_t err = 0;
   int64_t volDims[3] = {static_cast<int64_t>(getXPoints()), static_cast<int64_t>(getYPoints()), static_cast<int64_t>(getZPoints())};
@@ -977,7 +1098,7 @@ int RectGridGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeX
   }
   if(m_xBounds.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_xBounds);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_xBounds, policy);
     if(err < 0)
     {
       return err;
@@ -985,7 +1106,7 @@ int RectGridGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeX
   }
   if(m_yBounds.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_yBounds);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_yBounds, policy);
     if(err < 0)
     {
       return err;
@@ -993,18 +1114,31 @@ int RectGridGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeX
   }
   if(m_zBounds.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_zBounds);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_zBounds, policy);
     if(err < 0)
     {
       return err;
     }
   }
-  if(m_VoxelSizes.get() != nullptr)
+  if(hasGeneratedElementSizes())
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VoxelSizes);
+    // Generated sizes are recreated from the bounds when the file is read
+    err = QH5Lite::writeScalarAttribute(parentId, ".", SIMPL::Geometry::GeneratedElementSizes, static_cast<int32_t>(1));
     if(err < 0)
     {
-       return err;
+      return err;
+    }
+  }
+  else
+  {
+    FloatArrayType::Pointer elementSizes = getElementSizes();
+    if(nullptr != elementSizes.get())
+    {
+      err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, elementSizes, policy);
+      if(err < 0)
+      {
+        return err;
+      }
     }
   }
 
@@ -1104,7 +1238,6 @@ IGeometry::Pointer RectGridGeom::deepCopy(bool forceNoAllocate)
   FloatArrayType::Pointer xBounds = std::dynamic_pointer_cast<FloatArrayType>((getXBounds().get() == nullptr) ? nullptr : getXBounds()->deepCopy(forceNoAllocate));
   FloatArrayType::Pointer yBounds = std::dynamic_pointer_cast<FloatArrayType>((getYBounds().get() == nullptr) ? nullptr : getYBounds()->deepCopy(forceNoAllocate));
   FloatArrayType::Pointer zBounds = std::dynamic_pointer_cast<FloatArrayType>((getZBounds().get() == nullptr) ? nullptr : getZBounds()->deepCopy(forceNoAllocate));
-  FloatArrayType::Pointer elementSizes = std::dynamic_pointer_cast<FloatArrayType>((getElementSizes().get() == nullptr) ? nullptr : getElementSizes()->deepCopy(forceNoAllocate));
 
   RectGridGeom::Pointer copy = RectGridGeom::CreateGeometry(getName());
 
@@ -1114,7 +1247,15 @@ IGeometry::Pointer RectGridGeom::deepCopy(bool forceNoAllocate)
   copy->setXBounds(xBounds);
   copy->setYBounds(yBounds);
   copy->setZBounds(zBounds);
-  copy->setElementSizes(elementSizes);
+  if(hasGeneratedElementSizes())
+  {
+    copy->findElementSizes();
+  }
+  else
+  {
+    FloatArrayType::Pointer elementSizes = std::dynamic_pointer_cast<FloatArrayType>((getElementSizes().get() == nullptr) ? nullptr : getElementSizes()->deepCopy(forceNoAllocate));
+    copy->setElementSizes(elementSizes);
+  }
   copy->setSpatialDimensionality(getSpatialDimensionality());
 
   return copy;
@@ -1155,6 +1296,10 @@ int RectGridGeom::gatherMetaData(hid_t parentId, size_t volDims[3], bool preflig
   setYBounds(yBnds);
   setZBounds(zBnds);
   setElementSizes(voxelSizes);
+  if(nullptr == voxelSizes.get() && QH5Lite::findAttribute(parentId, SIMPL::Geometry::GeneratedElementSizes) == 1)
+  {
+    findElementSizes();
+  }
 
   return err;
 }
@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <QtCore/QMutex>
+
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Geometry/IGeometryGrid.h"
 
@@ -65,6 +67,22 @@ class SIMPLib_EXPORT RectGridGeom : public IGeometryGrid
     inline FloatArrayType::Pointer getYBounds() { return m_yBounds; }
     inline FloatArrayType::Pointer getZBounds() { return m_zBounds; }
 
+    /**
+     * @brief getElementSize Returns the size of a cell straight from the bounds, without
+     * creating the element sizes array
+     * @param idx
+     * @return 0 if any of the bounds lists is not set
+     */
+    float getElementSize(size_t idx);
+
+    /**
+     * @brief hasGeneratedElementSizes Returns true if the element sizes were found with findElementSizes().
+     * Generated sizes are only stored in memory once getElementSizes() is called and are written to
+     * HDF5 as a flag that recreates them from the bounds when the file is read.
+     * @return
+     */
+    bool hasGeneratedElementSizes();
+
 // -----------------------------------------------------------------------------
 // Inherited from IGeometry
 // -----------------------------------------------------------------------------
@@ -168,6 +186,13 @@ class SIMPLib_EXPORT RectGridGeom : public IGeometryGrid
      */
     void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr) override;
 
+    /**
+     * @brief findCell
+     * @param coords
+     * @return
+     */
+    int64_t findCell(const float coords[3]) override;
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -179,9 +204,10 @@ class SIMPLib_EXPORT RectGridGeom : public IGeometryGrid
      * @brief writeGeometryToHDF5
      * @param parentId
      * @param writeXdmf
+     * @param policy The chunking/compression policy used for the geometry lists
      * @return
      */
-    int writeGeometryToHDF5(hid_t parentId, bool writeXdmf) override;
+    int writeGeometryToHDF5(hid_t parentId, bool writeXdmf, const H5DatasetCreationPolicy& policy = H5DatasetCreationPolicy()) override;
 
     /**
      * @brief writeXdmf
@@ -279,6 +305,26 @@ class SIMPLib_EXPORT RectGridGeom : public IGeometryGrid
     FloatArrayType::Pointer m_yBounds;
     FloatArrayType::Pointer m_zBounds;
     FloatArrayType::Pointer m_VoxelSizes;
+    bool m_GeneratedElementSizes;
+    QMutex m_ElementSizesMutex;
+
+    /**
+     * @brief hasIncreasingBounds Returns true if every cell has a positive extent along each axis
+     * @return
+     */
+    bool hasIncreasingBounds();
+
+    /**
+     * @brief generateElementSizes Creates the element sizes array from the current bounds. Each size
+     * is the product of the 1-D spacings of its row, column and plane.
+     * @return
+     */
+    FloatArrayType::Pointer generateElementSizes();
+
+    /**
+     * @brief releaseGeneratedElementSizes Drops the stored copy of generated element sizes after the bounds change
+     */
+    void releaseGeneratedElementSizes();
 
     friend class FindRectGridDerivativesImpl;
 
@@ -49,6 +49,7 @@ SharedEdgeList::Pointer GEOM_CLASS_NAME::CreateSharedEdgeList(int64_t numEdges,
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::resizeEdgeList(int64_t newNumEdges)
 {
+  deleteElementSpatialIndex();
   m_EdgeList->resize(newNumEdges);
 }
 
@@ -57,6 +58,7 @@ void GEOM_CLASS_NAME::resizeEdgeList(int64_t newNumEdges)
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setEdges(SharedEdgeList::Pointer edges)
 {
+  deleteElementSpatialIndex();
   if(edges.get() != nullptr)
   {
     if(edges->getName().compare(SIMPL::Geometry::SharedEdgeList) != 0)
@@ -80,6 +82,7 @@ SharedEdgeList::Pointer GEOM_CLASS_NAME::getEdges()
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setVertsAtEdge(int64_t edgeId, int64_t verts[2])
 {
+  deleteElementSpatialIndex();
   int64_t* Edge = m_EdgeList->getTuplePointer(edgeId);
   Edge[0] = verts[0];
   Edge[1] = verts[1];
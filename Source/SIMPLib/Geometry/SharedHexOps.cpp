@@ -14,6 +14,7 @@ SharedHexList::Pointer GEOM_CLASS_NAME::CreateSharedHexList(int64_t numHexas, bo
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::resizeHexList(int64_t newNumHexas)
 {
+  deleteElementSpatialIndex();
   m_HexList->resize(newNumHexas);
 }
 
@@ -22,6 +23,7 @@ void GEOM_CLASS_NAME::resizeHexList(int64_t newNumHexas)
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setHexahedra(SharedHexList::Pointer hexas)
 {
+  deleteElementSpatialIndex();
   if(hexas.get() != nullptr)
   {
     if(hexas->getName().compare(SIMPL::Geometry::SharedHexList) != 0)
@@ -45,6 +47,7 @@ SharedHexList::Pointer GEOM_CLASS_NAME::getHexahedra()
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setVertsAtHex(int64_t hexId, int64_t verts[8])
 {
+  deleteElementSpatialIndex();
   int64_t* hex = m_HexList->getTuplePointer(hexId);
   hex[0] = verts[0];
   hex[1] = verts[1];
@@ -49,6 +49,7 @@ SharedQuadList::Pointer GEOM_CLASS_NAME::CreateSharedQuadList(int64_t numQuads,
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::resizeQuadList(int64_t newNumQuads)
 {
+  deleteElementSpatialIndex();
   m_QuadList->resize(newNumQuads);
 }
 
@@ -57,6 +58,7 @@ void GEOM_CLASS_NAME::resizeQuadList(int64_t newNumQuads)
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setQuads(SharedQuadList::Pointer quads)
 {
+  deleteElementSpatialIndex();
   if(quads.get() != nullptr)
   {
     if(quads->getName().compare(SIMPL::Geometry::SharedQuadList) != 0)
@@ -80,6 +82,7 @@ SharedQuadList::Pointer GEOM_CLASS_NAME::getQuads()
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setVertsAtQuad(int64_t quadId, int64_t verts[4])
 {
+  deleteElementSpatialIndex();
   int64_t* Quad = m_QuadList->getTuplePointer(quadId);
   Quad[0] = verts[0];
   Quad[1] = verts[1];
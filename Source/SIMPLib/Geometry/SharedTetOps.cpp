@@ -49,6 +49,7 @@ SharedTetList::Pointer GEOM_CLASS_NAME::CreateSharedTetList(int64_t numTets, boo
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::resizeTetList(int64_t newNumTets)
 {
+  deleteElementSpatialIndex();
   m_TetList->resize(newNumTets);
 }
 
@@ -57,6 +58,7 @@ void GEOM_CLASS_NAME::resizeTetList(int64_t newNumTets)
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setTetrahedra(SharedTetList::Pointer tets)
 {
+  deleteElementSpatialIndex();
   if(tets.get() != nullptr)
   {
     if(tets->getName().compare(SIMPL::Geometry::SharedTetList) != 0)
@@ -80,6 +82,7 @@ SharedTetList::Pointer GEOM_CLASS_NAME::getTetrahedra()
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setVertsAtTet(int64_t tetId, int64_t verts[4])
 {
+  deleteElementSpatialIndex();
   int64_t* tet = m_TetList->getTuplePointer(tetId);
   tet[0] = verts[0];
   tet[1] = verts[1];
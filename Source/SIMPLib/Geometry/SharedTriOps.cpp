@@ -49,6 +49,7 @@ SharedTriList::Pointer GEOM_CLASS_NAME::CreateSharedTriList(int64_t numTris, boo
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::resizeTriList(int64_t newNumTris)
 {
+  deleteElementSpatialIndex();
   m_TriList->resize(newNumTris);
 }
 
@@ -57,6 +58,7 @@ void GEOM_CLASS_NAME::resizeTriList(int64_t newNumTris)
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setTriangles(SharedTriList::Pointer triangles)
 {
+  deleteElementSpatialIndex();
   if(triangles.get() != nullptr)
   {
     if(triangles->getName().compare(SIMPL::Geometry::SharedTriList) != 0)
@@ -80,6 +82,7 @@ SharedTriList::Pointer GEOM_CLASS_NAME::getTriangles()
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setVertsAtTri(int64_t triId, int64_t verts[3])
 {
+  deleteElementSpatialIndex();
   int64_t* Tri = m_TriList->getTuplePointer(triId);
   Tri[0] = verts[0];
   Tri[1] = verts[1];
@@ -49,6 +49,7 @@ SharedVertexList::Pointer GEOM_CLASS_NAME::CreateSharedVertexList(int64_t numVer
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::resizeVertexList(int64_t newNumVertices)
 {
+  deleteElementSpatialIndex();
   m_VertexList->resize(newNumVertices);
 }
 
@@ -57,6 +58,7 @@ void GEOM_CLASS_NAME::resizeVertexList(int64_t newNumVertices)
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setVertices(SharedVertexList::Pointer vertices)
 {
+  deleteElementSpatialIndex();
   if(vertices.get() != nullptr)
   {
     if(vertices->getName().compare(SIMPL::Geometry::SharedVertexList) != 0)
@@ -80,6 +82,7 @@ SharedVertexList::Pointer GEOM_CLASS_NAME::getVertices()
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setCoords(int64_t vertId, float coords[3])
 {
+  deleteElementSpatialIndex();
   float* Vert = m_VertexList->getTuplePointer(vertId);
   Vert[0] = coords[0];
   Vert[1] = coords[1];
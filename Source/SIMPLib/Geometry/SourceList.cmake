@@ -5,6 +5,7 @@ set(SUBDIR_NAME Geometry)
 set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/Geometry/CompositeTransformContainer.h
   ${SIMPLib_SOURCE_DIR}/Geometry/EdgeGeom.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/ElementSpatialIndex.h
   ${SIMPLib_SOURCE_DIR}/Geometry/GeometryHelpers.h
   ${SIMPLib_SOURCE_DIR}/Geometry/HexahedralGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry.h
@@ -32,6 +33,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
 set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/Geometry/CompositeTransformContainer.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/EdgeGeom.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/ElementSpatialIndex.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/GeometryHelpers.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/HexahedralGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry.cpp
@@ -0,0 +1,235 @@
+
+#include <stdlib.h>
+
+#include <iostream>
+#include <vector>
+
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/RectGridGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class FindCellTest
+{
+public:
+  FindCellTest() = default;
+
+  virtual ~FindCellTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestImageGeom()
+  {
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry("Test Geometry");
+    geom->setDimensions(10, 20, 30);
+    geom->setResolution(0.5f, 2.0f, 1.0f);
+    geom->setOrigin(-1.0f, 6.0f, 10.0f);
+
+    float coords[3] = {0.25f, 9.0f, 12.5f};
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(coords), 2 + 1 * 10 + 2 * 200)
+
+    // The upper boundary belongs to the last cell
+    coords[0] = 4.0f;
+    coords[1] = 46.0f;
+    coords[2] = 40.0f;
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(coords), 5999)
+
+    coords[0] = -1.5f;
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(coords), -1)
+    coords[0] = 4.5f;
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(coords), -1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRectGridGeom()
+  {
+    RectGridGeom::Pointer geom = RectGridGeom::CreateGeometry("Test Geometry");
+    QVector<size_t> cDims(1, 1);
+    float bounds[3][4] = {{0.0f, 1.0f, 3.0f, 7.0f}, {-2.0f, -1.0f, 0.0f, 0.0f}, {5.0f, 6.0f, 0.0f, 0.0f}};
+    size_t numBounds[3] = {4, 3, 2};
+    FloatArrayType::Pointer arrays[3];
+    for(size_t i = 0; i < 3; i++)
+    {
+      arrays[i] = FloatArrayType::CreateArray(numBounds[i], cDims, "Bounds", true);
+      for(size_t j = 0; j < numBounds[i]; j++)
+      {
+        arrays[i]->setValue(j, bounds[i][j]);
+      }
+    }
+    geom->setXBounds(arrays[0]);
+    geom->setYBounds(arrays[1]);
+    geom->setZBounds(arrays[2]);
+    geom->setDimensions(3, 2, 1);
+
+    float coords[3] = {2.0f, -0.5f, 5.5f};
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(coords), 1 + 1 * 3)
+    coords[0] = 7.0f;
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(coords), 2 + 1 * 3)
+    coords[0] = 1.0f;
+    coords[1] = -2.0f;
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(coords), 1)
+    coords[2] = 6.5f;
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(coords), -1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTriangleGeom()
+  {
+    // A 4 x 4 grid of unit squares in the z = 1 plane, each split into two triangles
+    int64_t n = 4;
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList((n + 1) * (n + 1));
+    for(int64_t y = 0; y <= n; y++)
+    {
+      for(int64_t x = 0; x <= n; x++)
+      {
+        float* vert = vertices->getTuplePointer(y * (n + 1) + x);
+        vert[0] = static_cast<float>(x);
+        vert[1] = static_cast<float>(y);
+        vert[2] = 1.0f;
+      }
+    }
+    TriangleGeom::Pointer geom = TriangleGeom::CreateGeometry(2 * n * n, vertices, "Test Geometry");
+    for(int64_t y = 0; y < n; y++)
+    {
+      for(int64_t x = 0; x < n; x++)
+      {
+        int64_t v0 = y * (n + 1) + x;
+        int64_t lower[3] = {v0, v0 + 1, v0 + n + 2};
+        int64_t upper[3] = {v0, v0 + n + 2, v0 + n + 1};
+        geom->setVertsAtTri(2 * (y * n + x), lower);
+        geom->setVertsAtTri(2 * (y * n + x) + 1, upper);
+      }
+    }
+
+    std::vector<float> points = {2.75f, 1.25f, 1.0f, 2.25f, 1.75f, 1.0f, 0.5f, 0.5f, 1.5f, 5.0f, 1.0f, 1.0f};
+    std::vector<int64_t> cellIds(4, 0);
+    geom->findCells(points.data(), 4, cellIds.data());
+    DREAM3D_REQUIRE_EQUAL(cellIds[0], 12)
+    DREAM3D_REQUIRE_EQUAL(cellIds[1], 13)
+    DREAM3D_REQUIRE_EQUAL(cellIds[2], -1)
+    DREAM3D_REQUIRE_EQUAL(cellIds[3], -1)
+
+    // Moving the mesh drops the cached index
+    float coords[3] = {2.75f, 1.25f, 3.0f};
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(coords), -1)
+    for(int64_t i = 0; i < geom->getNumberOfVertices(); i++)
+    {
+      float vert[3] = {0.0f, 0.0f, 0.0f};
+      geom->getCoords(i, vert);
+      vert[2] = 3.0f;
+      geom->setCoords(i, vert);
+    }
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(coords), 12)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTetrahedralGeom()
+  {
+    // A unit cube split into five tetrahedra
+    float cube[8][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}};
+    SharedVertexList::Pointer vertices = TetrahedralGeom::CreateSharedVertexList(8);
+    for(int64_t i = 0; i < 8; i++)
+    {
+      vertices->setTuple(i, cube[i]);
+    }
+    int64_t tets[5][4] = {{1, 3, 4, 6}, {0, 1, 3, 4}, {1, 2, 3, 6}, {1, 4, 5, 6}, {3, 4, 6, 7}};
+    TetrahedralGeom::Pointer geom = TetrahedralGeom::CreateGeometry(5, vertices, "Test Geometry");
+    for(int64_t i = 0; i < 5; i++)
+    {
+      geom->setVertsAtTet(i, tets[i]);
+    }
+
+    float center[3] = {0.5f, 0.5f, 0.5f};
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(center), 0)
+    float corners[4][3] = {{0.1f, 0.1f, 0.1f}, {0.9f, 0.9f, 0.1f}, {0.9f, 0.1f, 0.9f}, {0.1f, 0.9f, 0.9f}};
+    for(int64_t i = 0; i < 4; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(geom->findCell(corners[i]), i + 1)
+    }
+    float outside[3] = {0.5f, 0.5f, 1.01f};
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(outside), -1)
+
+    // Every point of the cube is found, including the ones on the shared faces
+    size_t n = 10;
+    std::vector<float> points;
+    for(size_t z = 0; z <= n; z++)
+    {
+      for(size_t y = 0; y <= n; y++)
+      {
+        for(size_t x = 0; x <= n; x++)
+        {
+          points.push_back(static_cast<float>(x) / n);
+          points.push_back(static_cast<float>(y) / n);
+          points.push_back(static_cast<float>(z) / n);
+        }
+      }
+    }
+    size_t numPoints = points.size() / 3;
+    std::vector<int64_t> cellIds(numPoints, -1);
+    geom->findCells(points.data(), numPoints, cellIds.data());
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      DREAM3D_REQUIRE(cellIds[i] >= 0 && cellIds[i] < 5)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestVertexGeom()
+  {
+    VertexGeom::Pointer geom = VertexGeom::CreateGeometry(100, "Test Geometry");
+    float* verts = geom->getVertexPointer(0);
+    for(int64_t i = 0; i < 100; i++)
+    {
+      verts[3 * i] = static_cast<float>(i % 10);
+      verts[3 * i + 1] = static_cast<float>(i / 10);
+      verts[3 * i + 2] = 0.0f;
+    }
+
+    float coords[3] = {3.0f, 4.0f, 0.0f};
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(coords), 43)
+    coords[0] = 3.5f;
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(coords), -1)
+
+    // Moving a vertex through setCoords() drops the cached index
+    float moved[3] = {50.0f, 50.0f, 50.0f};
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(moved), -1)
+    geom->setCoords(42, moved);
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(moved), 42)
+
+    geom->resizeVertexList(20);
+    coords[0] = 3.0f;
+    DREAM3D_REQUIRE_EQUAL(geom->findCell(coords), -1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### FindCellTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestImageGeom());
+    DREAM3D_REGISTER_TEST(TestRectGridGeom());
+    DREAM3D_REGISTER_TEST(TestTriangleGeom());
+    DREAM3D_REGISTER_TEST(TestTetrahedralGeom());
+    DREAM3D_REGISTER_TEST(TestVertexGeom());
+  }
+
+private:
+  FindCellTest(const FindCellTest&) = delete;    // Copy Constructor Not Implemented
+  void operator=(const FindCellTest&) = delete; // Move assignment Not Implemented
+};
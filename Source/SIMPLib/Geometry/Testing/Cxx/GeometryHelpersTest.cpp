@@ -0,0 +1,193 @@
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class GeometryHelpersTest
+{
+public:
+  GeometryHelpersTest() = default;
+
+  virtual ~GeometryHelpersTest() = default;
+
+  // More elements than fit in one gathered block so the partial tail block is exercised
+  static const size_t k_NumElements = 150;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer createVertices(const std::vector<float>& coords)
+  {
+    QVector<size_t> cDims(1, 3);
+    FloatArrayType::Pointer vertices = FloatArrayType::CreateArray(coords.size() / 3, cDims, "Vertices", true);
+    std::copy(coords.begin(), coords.end(), vertices->getPointer(0));
+    return vertices;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  Int64ArrayType::Pointer createElements(const std::vector<int64_t>& elem, size_t numVertsPerElem)
+  {
+    QVector<size_t> cDims(1, numVertsPerElem);
+    Int64ArrayType::Pointer elems = Int64ArrayType::CreateArray(k_NumElements, cDims, "Elements", true);
+    for(size_t i = 0; i < k_NumElements; i++)
+    {
+      std::copy(elem.begin(), elem.end(), elems->getTuplePointer(i));
+    }
+    return elems;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHexVolumes()
+  {
+    std::vector<float> coords = {0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 3.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f, 0.0f, 4.0f, 2.0f, 0.0f, 4.0f, 2.0f, 3.0f, 4.0f, 0.0f, 3.0f, 4.0f};
+    FloatArrayType::Pointer vertices = createVertices(coords);
+    Int64ArrayType::Pointer hexas = createElements({0, 1, 2, 3, 4, 5, 6, 7}, 8);
+    FloatArrayType::Pointer volumes = FloatArrayType::CreateArray(k_NumElements, "Volumes", true);
+
+    GeometryHelpers::Topology::FindHexVolumes<int64_t>(hexas, vertices, volumes);
+    for(size_t i = 0; i < k_NumElements; i++)
+    {
+      DREAM3D_REQUIRE(std::fabs(volumes->getValue(i) - 24.0f) < 1.0e-4f)
+    }
+
+    // Shear the top face; the volume of a parallelepiped does not change
+    for(size_t v = 4; v < 8; v++)
+    {
+      vertices->getPointer(3 * v)[0] += 1.5f;
+    }
+    GeometryHelpers::Topology::FindHexVolumes<int64_t>(hexas, vertices, volumes);
+    for(size_t i = 0; i < k_NumElements; i++)
+    {
+      DREAM3D_REQUIRE(std::fabs(volumes->getValue(i) - 24.0f) < 1.0e-4f)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTetMeasures()
+  {
+    FloatArrayType::Pointer vertices = createVertices({0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f});
+    Int64ArrayType::Pointer tets = createElements({0, 1, 2, 3}, 4);
+    FloatArrayType::Pointer volumes = FloatArrayType::CreateArray(k_NumElements, "Volumes", true);
+    FloatArrayType::Pointer jacobians = FloatArrayType::CreateArray(k_NumElements, "Jacobians", true);
+    FloatArrayType::Pointer minAngles = FloatArrayType::CreateArray(k_NumElements, "MinDihedralAngles", true);
+
+    GeometryHelpers::Topology::FindTetVolumes<int64_t>(tets, vertices, volumes);
+    GeometryHelpers::Topology::FindTetJacobians<int64_t>(tets, vertices, jacobians);
+    GeometryHelpers::Topology::FindTetMinDihedralAngles<int64_t>(tets, vertices, minAngles);
+    for(size_t i = 0; i < k_NumElements; i++)
+    {
+      DREAM3D_REQUIRE(std::fabs(volumes->getValue(i) - 8.0f / 6.0f) < 1.0e-5f)
+      DREAM3D_REQUIRE(std::fabs(jacobians->getValue(i) - 8.0f) < 1.0e-5f)
+      DREAM3D_REQUIRE_EQUAL(minAngles->getValue(i), minAngles->getValue(0))
+    }
+    DREAM3D_REQUIRE(minAngles->getValue(0) > 0.0f && minAngles->getValue(0) < 180.0f)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAreasAndCentroids()
+  {
+    FloatArrayType::Pointer vertices = createVertices({0.0f, 0.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f, 3.0f, 1.0f, 0.0f, 3.0f, 1.0f});
+    Int64ArrayType::Pointer tris = createElements({0, 1, 3}, 3);
+    Int64ArrayType::Pointer quads = createElements({0, 1, 2, 3}, 4);
+    FloatArrayType::Pointer areas = FloatArrayType::CreateArray(k_NumElements, "Areas", true);
+    QVector<size_t> cDims(1, 3);
+    FloatArrayType::Pointer centroids = FloatArrayType::CreateArray(k_NumElements, cDims, "Centroids", true);
+
+    GeometryHelpers::Topology::Find2DElementAreas<int64_t>(tris, vertices, areas);
+    for(size_t i = 0; i < k_NumElements; i++)
+    {
+      DREAM3D_REQUIRE(std::fabs(areas->getValue(i) - 3.0f) < 1.0e-5f)
+    }
+
+    GeometryHelpers::Topology::Find2DElementAreas<int64_t>(quads, vertices, areas);
+    GeometryHelpers::Topology::FindElementCentroids<int64_t>(quads, vertices, centroids);
+    for(size_t i = 0; i < k_NumElements; i++)
+    {
+      DREAM3D_REQUIRE(std::fabs(areas->getValue(i) - 6.0f) < 1.0e-5f)
+      float* centroid = centroids->getTuplePointer(i);
+      DREAM3D_REQUIRE(std::fabs(centroid[0] - 1.0f) < 1.0e-6f)
+      DREAM3D_REQUIRE(std::fabs(centroid[1] - 1.5f) < 1.0e-6f)
+      DREAM3D_REQUIRE(std::fabs(centroid[2] - 1.0f) < 1.0e-6f)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAverages()
+  {
+    FloatArrayType::Pointer vertices = createVertices({0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 2.0f, 0.0f, 0.0f, 2.0f, 0.0f, 4.0f, 0.0f, 0.0f, 4.0f, 2.0f, 0.0f});
+    QVector<size_t> cDims(1, 4);
+    Int64ArrayType::Pointer quads = Int64ArrayType::CreateArray(2, cDims, "Quads", true);
+    int64_t quadVerts[8] = {0, 1, 2, 3, 1, 4, 5, 2};
+    std::copy(quadVerts, quadVerts + 8, quads->getPointer(0));
+
+    cDims[0] = 2;
+    DoubleArrayType::Pointer vertValues = DoubleArrayType::CreateArray(6, cDims, "VertexValues", true);
+    for(size_t i = 0; i < 6; i++)
+    {
+      vertValues->setComponent(i, 0, static_cast<double>(i));
+      vertValues->setComponent(i, 1, 1.0);
+    }
+    FloatArrayType::Pointer elemValues = FloatArrayType::CreateArray(2, cDims, "ElementValues", true);
+
+    GeometryHelpers::Generic::AverageVertexArrayValues<int64_t, double>(quads, vertValues, elemValues);
+    DREAM3D_REQUIRE(std::fabs(elemValues->getComponent(0, 0) - 1.5f) < 1.0e-6f)
+    DREAM3D_REQUIRE(std::fabs(elemValues->getComponent(1, 0) - 3.0f) < 1.0e-6f)
+    DREAM3D_REQUIRE(std::fabs(elemValues->getComponent(1, 1) - 1.0f) < 1.0e-6f)
+
+    // Every vertex of a square is equally far from its centroid, so the weights cancel
+    cDims[0] = 3;
+    FloatArrayType::Pointer centroids = FloatArrayType::CreateArray(2, cDims, "Centroids", true);
+    GeometryHelpers::Topology::FindElementCentroids<int64_t>(quads, vertices, centroids);
+    GeometryHelpers::Generic::WeightedAverageVertexArrayValues<int64_t, double>(quads, vertices, centroids, vertValues, elemValues);
+    DREAM3D_REQUIRE(std::fabs(elemValues->getComponent(0, 0) - 1.5f) < 1.0e-5f)
+    DREAM3D_REQUIRE(std::fabs(elemValues->getComponent(1, 0) - 3.0f) < 1.0e-5f)
+    DREAM3D_REQUIRE(std::fabs(elemValues->getComponent(1, 1) - 1.0f) < 1.0e-5f)
+
+    ElementDynamicList::Pointer quadsContainingVert = ElementDynamicList::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t>(quads, quadsContainingVert, 6);
+    cDims[0] = 2;
+    DoubleArrayType::Pointer averaged = DoubleArrayType::CreateArray(6, cDims, "Averaged", true);
+    GeometryHelpers::Generic::AverageCellArrayValues<int64_t, float, uint16_t, double>(quadsContainingVert, vertices, elemValues, averaged);
+    DREAM3D_REQUIRE(std::fabs(averaged->getComponent(0, 0) - 1.5) < 1.0e-5)
+    DREAM3D_REQUIRE(std::fabs(averaged->getComponent(1, 0) - 2.25) < 1.0e-5)
+    DREAM3D_REQUIRE(std::fabs(averaged->getComponent(4, 0) - 3.0) < 1.0e-5)
+    DREAM3D_REQUIRE(std::fabs(averaged->getComponent(2, 1) - 1.0) < 1.0e-5)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### GeometryHelpersTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestHexVolumes());
+    DREAM3D_REGISTER_TEST(TestTetMeasures());
+    DREAM3D_REGISTER_TEST(TestAreasAndCentroids());
+    DREAM3D_REGISTER_TEST(TestAverages());
+  }
+
+private:
+  GeometryHelpersTest(const GeometryHelpersTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const GeometryHelpersTest&) = delete;     // Move assignment Not Implemented
+};
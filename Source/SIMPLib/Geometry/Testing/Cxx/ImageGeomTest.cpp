@@ -91,6 +91,46 @@ public:
     DREAM3D_REQUIRE(err == ImageGeom::ErrorType::ZOutOfBoundsHigh)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestGeneratedElementSizes()
+  {
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry("Test Geometry");
+    geom->setDimensions(4, 5, 6);
+    geom->setResolution(0.5f, 2.0f, 3.0f);
+
+    DREAM3D_REQUIRE(geom->findElementSizes() > 0)
+    DREAM3D_REQUIRE(geom->hasGeneratedElementSizes())
+    DREAM3D_REQUIRE_EQUAL(geom->getElementSize(17), 3.0f)
+
+    FloatArrayType::Pointer sizes = geom->getElementSizes();
+    DREAM3D_REQUIRE_VALID_POINTER(sizes.get())
+    DREAM3D_REQUIRE_EQUAL(sizes->getNumberOfTuples(), static_cast<size_t>(120))
+    DREAM3D_REQUIRE_EQUAL(sizes->getValue(119), 3.0f)
+
+    // Changing the resolution recreates the generated sizes
+    geom->setResolution(1.0f, 1.0f, 1.0f);
+    sizes = geom->getElementSizes();
+    DREAM3D_REQUIRE_EQUAL(sizes->getValue(0), 1.0f)
+
+    ImageGeom::Pointer copy = std::dynamic_pointer_cast<ImageGeom>(geom->deepCopy(false));
+    DREAM3D_REQUIRE(copy->hasGeneratedElementSizes())
+
+    // Explicit sizes are stored as given
+    geom->setElementSizes(FloatArrayType::CreateArray(120, "Sizes", true));
+    DREAM3D_REQUIRE(geom->hasGeneratedElementSizes() == false)
+    geom->deleteElementSizes();
+    DREAM3D_REQUIRE(geom->getElementSizes().get() == nullptr)
+
+    // A failed search drops sizes that were generated before
+    DREAM3D_REQUIRE(geom->findElementSizes() > 0)
+    geom->setResolution(0.0f, 1.0f, 1.0f);
+    DREAM3D_REQUIRE(geom->findElementSizes() < 0)
+    DREAM3D_REQUIRE(geom->hasGeneratedElementSizes() == false)
+    DREAM3D_REQUIRE(geom->getElementSizes().get() == nullptr)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -101,6 +141,7 @@ public:
 
     // Use this to register a specific function that will run a test
     DREAM3D_REGISTER_TEST(TestIndexCalculation());
+    DREAM3D_REGISTER_TEST(TestGeneratedElementSizes());
     DREAM3D_REGISTER_TEST(RemoveTestFiles());
   }
 
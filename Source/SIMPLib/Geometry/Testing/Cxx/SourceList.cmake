@@ -1,5 +1,7 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
+  FindCellTest
+  GeometryHelpersTest
   ImageGeomTest
 )
 
@@ -602,13 +602,43 @@ void TetrahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArra
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int TetrahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf))
+int64_t TetrahedralGeom::findCell(const float coords[3])
+{
+  ElementSpatialIndex::Pointer index = getElementSpatialIndex();
+  if(nullptr == index.get())
+  {
+    return -1;
+  }
+  const float* vertices = m_VertexList->getConstPointer(0);
+  const int64_t* tets = m_TetList->getConstPointer(0);
+  return index->findElement(coords, [&](int64_t tetId) {
+    const int64_t* tet = tets + 4 * tetId;
+    return GeometryHelpers::Search::PointInTet(coords, vertices + 3 * tet[0], vertices + 3 * tet[1], vertices + 3 * tet[2], vertices + 3 * tet[3]);
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementSpatialIndex::Pointer TetrahedralGeom::createElementSpatialIndex()
+{
+  if(nullptr == m_VertexList.get() || nullptr == m_TetList.get())
+  {
+    return ElementSpatialIndex::NullPointer();
+  }
+  return ElementSpatialIndex::New(m_VertexList, m_TetList);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TetrahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf), const H5DatasetCreationPolicy& policy)
 {
   herr_t err = 0;
 
   if(m_VertexList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VertexList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VertexList, policy);
     if(err < 0)
     {
       return err;
@@ -617,7 +647,7 @@ int TetrahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(wri
 
   if(m_EdgeList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_EdgeList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_EdgeList, policy);
     if(err < 0)
     {
       return err;
@@ -626,7 +656,7 @@ int TetrahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(wri
 
   if(m_TriList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TriList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TriList, policy);
     if(err < 0)
     {
       return err;
@@ -635,7 +665,7 @@ int TetrahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(wri
 
   if(m_TetList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TetList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TetList, policy);
     if(err < 0)
     {
       return err;
@@ -644,7 +674,7 @@ int TetrahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(wri
 
   if(m_UnsharedEdgeList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedEdgeList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedEdgeList, policy);
     if(err < 0)
     {
       return err;
@@ -653,7 +683,7 @@ int TetrahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(wri
 
   if(m_UnsharedTriList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedTriList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedTriList, policy);
     if(err < 0)
     {
       return err;
@@ -662,7 +692,7 @@ int TetrahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(wri
 
   if(m_TetCentroids.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TetCentroids);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TetCentroids, policy);
     if(err < 0)
     {
       return err;
@@ -671,7 +701,7 @@ int TetrahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(wri
 
   if(m_TetSizes.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TetSizes);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TetSizes, policy);
     if(err < 0)
     {
       return err;
@@ -681,7 +711,7 @@ int TetrahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(wri
   if(m_TetNeighbors.get() != nullptr)
   {
     size_t numTets = getNumberOfTets();
-    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_TetNeighbors, numTets, SIMPL::StringConstants::TetNeighbors);
+    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_TetNeighbors, numTets, SIMPL::StringConstants::TetNeighbors, policy);
     if(err < 0)
     {
       return err;
@@ -691,7 +721,7 @@ int TetrahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(wri
   if(m_TetsContainingVert.get() != nullptr)
   {
     size_t numVerts = getNumberOfVertices();
-    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_TetsContainingVert, numVerts, SIMPL::StringConstants::TetsContainingVert);
+    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_TetsContainingVert, numVerts, SIMPL::StringConstants::TetsContainingVert, policy);
     if(err < 0)
     {
       return err;
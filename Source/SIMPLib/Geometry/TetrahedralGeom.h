@@ -324,6 +324,13 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
      */
     void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr) override;
 
+    /**
+     * @brief findCell
+     * @param coords
+     * @return
+     */
+    int64_t findCell(const float coords[3]) override;
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -335,9 +342,10 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
      * @brief writeGeometryToHDF5
      * @param parentId
      * @param writeXdmf
+     * @param policy The chunking/compression policy used for the geometry lists
      * @return
      */
-    int writeGeometryToHDF5(hid_t parentId, bool writeXdmf) override;
+    int writeGeometryToHDF5(hid_t parentId, bool writeXdmf, const H5DatasetCreationPolicy& policy = H5DatasetCreationPolicy()) override;
 
     /**
      * @brief writeXdmf
@@ -521,6 +529,12 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
 
     TetrahedralGeom();
 
+    /**
+     * @brief createElementSpatialIndex
+     * @return
+     */
+    ElementSpatialIndex::Pointer createElementSpatialIndex() override;
+
     /**
      * @brief setElementsContainingVert
      * @param elementsContainingVert
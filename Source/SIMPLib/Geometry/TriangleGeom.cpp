@@ -524,13 +524,44 @@ void TriangleGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int TriangleGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf))
+int64_t TriangleGeom::findCell(const float coords[3])
+{
+  ElementSpatialIndex::Pointer index = getElementSpatialIndex();
+  if(nullptr == index.get())
+  {
+    return -1;
+  }
+  const float* vertices = m_VertexList->getConstPointer(0);
+  const int64_t* tris = m_TriList->getConstPointer(0);
+  float tolerance = index->getTolerance();
+  return index->findElement(coords, [&](int64_t triId) {
+    const int64_t* tri = tris + 3 * triId;
+    return GeometryHelpers::Search::PointInTriangle(coords, vertices + 3 * tri[0], vertices + 3 * tri[1], vertices + 3 * tri[2], tolerance);
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementSpatialIndex::Pointer TriangleGeom::createElementSpatialIndex()
+{
+  if(nullptr == m_VertexList.get() || nullptr == m_TriList.get())
+  {
+    return ElementSpatialIndex::NullPointer();
+  }
+  return ElementSpatialIndex::New(m_VertexList, m_TriList);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TriangleGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf), const H5DatasetCreationPolicy& policy)
 {
   herr_t err = 0;
 
   if(m_VertexList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VertexList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VertexList, policy);
     if(err < 0)
     {
       return err;
@@ -539,7 +570,7 @@ int TriangleGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeX
 
   if(m_EdgeList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_EdgeList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_EdgeList, policy);
     if(err < 0)
     {
       return err;
@@ -548,7 +579,7 @@ int TriangleGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeX
 
   if(m_TriList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TriList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TriList, policy);
     if(err < 0)
     {
       return err;
@@ -557,7 +588,7 @@ int TriangleGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeX
 
   if(m_UnsharedEdgeList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedEdgeList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedEdgeList, policy);
     if(err < 0)
     {
       return err;
@@ -566,7 +597,7 @@ int TriangleGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeX
 
   if(m_TriangleCentroids.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TriangleCentroids);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TriangleCentroids, policy);
     if(err < 0)
     {
       return err;
@@ -575,7 +606,7 @@ int TriangleGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeX
 
   if(m_TriangleSizes.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TriangleSizes);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TriangleSizes, policy);
     if(err < 0)
     {
       return err;
@@ -586,7 +617,7 @@ int TriangleGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeX
   if(m_TriangleNeighbors.get() != nullptr)
   {
     size_t numTris = getNumberOfTris();
-    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_TriangleNeighbors, numTris, SIMPL::StringConstants::TriangleNeighbors);
+    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_TriangleNeighbors, numTris, SIMPL::StringConstants::TriangleNeighbors, policy);
     if(err < 0)
     {
       return err;
@@ -596,7 +627,7 @@ int TriangleGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeX
   if(m_TrianglesContainingVert.get() != nullptr)
   {
     size_t numVerts = getNumberOfVertices();
-    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_TrianglesContainingVert, numVerts, SIMPL::StringConstants::TrianglesContainingVert);
+    err = GeometryHelpers::GeomIO::WriteDynamicListToHDF5<uint16_t, int64_t>(parentId, m_TrianglesContainingVert, numVerts, SIMPL::StringConstants::TrianglesContainingVert, policy);
     if(err < 0)
     {
       return err;
@@ -259,6 +259,13 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
      */
     void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr) override;
 
+    /**
+     * @brief findCell
+     * @param coords
+     * @return
+     */
+    int64_t findCell(const float coords[3]) override;
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -270,9 +277,10 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
      * @brief writeGeometryToHDF5
      * @param parentId
      * @param writeXdmf
+     * @param policy The chunking/compression policy used for the geometry lists
      * @return
      */
-    int writeGeometryToHDF5(hid_t parentId, bool writeXdmf) override;
+    int writeGeometryToHDF5(hid_t parentId, bool writeXdmf, const H5DatasetCreationPolicy& policy = H5DatasetCreationPolicy()) override;
 
     /**
      * @brief writeXdmf
@@ -429,6 +437,12 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
 
     TriangleGeom();
 
+    /**
+     * @brief createElementSpatialIndex
+     * @return
+     */
+    ElementSpatialIndex::Pointer createElementSpatialIndex() override;
+
     /**
      * @brief setElementsContainingVert
      * @param elementsContainingVert
@@ -308,34 +308,57 @@ void VertexGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int VertexGeom::writeGeometryToHDF5(hid_t parentId, bool writeXdmf)
+int64_t VertexGeom::findCell(const float coords[3])
+{
+  ElementSpatialIndex::Pointer index = getElementSpatialIndex();
+  if(nullptr == index.get())
+  {
+    return -1;
+  }
+  const float* vertices = m_VertexList->getConstPointer(0);
+  float tol2 = index->getTolerance() * index->getTolerance();
+  return index->findElement(coords, [&](int64_t vertId) {
+    const float* vert = vertices + 3 * vertId;
+    float dist2 = (coords[0] - vert[0]) * (coords[0] - vert[0]) + (coords[1] - vert[1]) * (coords[1] - vert[1]) + (coords[2] - vert[2]) * (coords[2] - vert[2]);
+    return dist2 <= tol2;
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ElementSpatialIndex::Pointer VertexGeom::createElementSpatialIndex()
+{
+  if(nullptr == m_VertexList.get())
+  {
+    return ElementSpatialIndex::NullPointer();
+  }
+  return ElementSpatialIndex::New(m_VertexList, Int64ArrayType::NullPointer());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VertexGeom::writeGeometryToHDF5(hid_t parentId, bool writeXdmf, const H5DatasetCreationPolicy& policy)
 {
   herr_t err = 0;
-  QVector<size_t> tDims(1, 0);
 
   if(m_VertexList.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VertexList);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VertexList, policy);
     if(err < 0)
     {
       return err;
     }
     if(writeXdmf == true)
     {
-      QVector<size_t> cDims(1, 1);
-      DataArray<int64_t>::Pointer vertsPtr = DataArray<int64_t>::CreateArray(getNumberOfVertices(), cDims, SIMPL::StringConstants::VertsName);
-      int64_t* verts = vertsPtr->getPointer(0);
-      for(size_t i = 0; i < vertsPtr->getNumberOfTuples(); i++)
-      {
-        verts[i] = i;
-      }
-      tDims[0] = vertsPtr->getNumberOfTuples();
-      err = vertsPtr->writeH5Data(parentId, tDims);
+      // The Xdmf polyvertex topology needs the vertex ids, which are generated while they are written
+      err = GeometryHelpers::GeomIO::WriteIdentityListToHDF5(parentId, SIMPL::StringConstants::VertsName, static_cast<size_t>(getNumberOfVertices()), policy);
     }
   }
   if(m_VertexSizes.get() != nullptr)
   {
-    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VertexSizes);
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_VertexSizes, policy);
     if(err < 0)
     {
       return err;
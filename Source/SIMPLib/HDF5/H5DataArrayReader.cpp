@@ -394,6 +394,37 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
   return ptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer H5DataArrayReader::ReadIDataArraySubVolume(hid_t gid, const QString& name, const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount, bool metaDataOnly)
+{
+  // Create the correctly typed (but unallocated) array from the meta data
+  IDataArray::Pointer ptr = ReadIDataArray(gid, name, true);
+  if(nullptr == ptr.get())
+  {
+    return ptr;
+  }
+
+  if(metaDataOnly)
+  {
+    size_t numTuples = 1;
+    for(const auto& count : tupleCount)
+    {
+      numTuples *= count;
+    }
+    return ptr->createNewArray(numTuples, ptr->getComponentDimensions(), ptr->getName(), false);
+  }
+
+  int err = ptr->readH5DataSubVolume(gid, tupleOffset, tupleCount);
+  if(err < 0)
+  {
+    qDebug() << "readH5DataSubVolume read error: " << __FILE__ << "(" << __LINE__ << ")";
+    ptr = IDataArray::NullPointer();
+  }
+  return ptr;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
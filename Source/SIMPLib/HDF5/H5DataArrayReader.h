@@ -76,6 +76,18 @@ class SIMPLib_EXPORT H5DataArrayReader
      */
     static IDataArray::Pointer ReadIDataArray(hid_t gid, const QString& name, bool metaDataOnly = false);
 
+    /**
+     * @brief ReadIDataArraySubVolume Reads a rectangular block of tuples of an IDataArray
+     * subclass from the HDF5 file. Only the selected block is read from the file.
+     * @param gid The HDF5 Group to read the data array from
+     * @param name The name of the data set
+     * @param tupleOffset The first tuple index along each tuple dimension (XYZ order)
+     * @param tupleCount The number of tuples along each tuple dimension (XYZ order)
+     * @param metaDataOnly Read just the meta data about the DataArray or actually read all the data
+     * @return
+     */
+    static IDataArray::Pointer ReadIDataArraySubVolume(hid_t gid, const QString& name, const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount, bool metaDataOnly = false);
+
     /**
      * @brief ReadNeighborListData
      * @param gid The HDF5 Group to read the data array from
@@ -40,9 +40,11 @@
 #include <QtCore/QString>
 
 #include "H5Support/QH5Lite.h"
+#include "H5Support/H5ScopedSentinel.h"
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/HDF5/H5DatasetCreationPolicy.h"
 //#include "SIMPLib/DataArrays/DataArray.hpp"
 
 
@@ -113,10 +115,11 @@ class H5DataArrayWriter
      * @param gid
      * @param dataArray
      * @param tDims
+     * @param policy The dataset creation policy (chunking/compression) used if the dataset is created
      * @return
      */
     template<class T>
-    static int writeDataArray(hid_t gid, T* dataArray, QVector<size_t> tDims)
+    static int writeDataArray(hid_t gid, T* dataArray, QVector<size_t> tDims, const H5DatasetCreationPolicy& policy = H5DatasetCreationPolicy())
     {
       int err = 0;
 
@@ -163,9 +166,11 @@ class H5DataArrayWriter
         h5Dims[i + tDims.size()] = cDims[i];
       }
 #endif
+      hid_t dcpl = policy.createPropertyList(dataArray->getName(), static_cast<int32_t>(h5Rank), h5Dims.data(), dataArray->getTypeSize());
+      H5PropertyListAutoCloser dcplCloser(&dcpl);
       if (QH5Lite::datasetExists(gid, dataArray->getName()) == false)
       {
-        err = QH5Lite::writePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getPointer(0));
+        err = QH5Lite::writePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getConstPointer(0), dcpl);
         if(err < 0)
         {
           return err;
@@ -173,7 +178,7 @@ class H5DataArrayWriter
       }
       else
       {
-        err = QH5Lite::replacePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getPointer(0));
+        err = QH5Lite::replacePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getConstPointer(0), dcpl);
         if(err < 0)
         {
           return err;
@@ -0,0 +1,223 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "H5DatasetCreationPolicy.h"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5DatasetCreationPolicy::H5DatasetCreationPolicy() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5DatasetCreationPolicy::H5DatasetCreationPolicy(const Settings& defaults)
+: m_Defaults(defaults)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5DatasetCreationPolicy::~H5DatasetCreationPolicy() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5DatasetCreationPolicy H5DatasetCreationPolicy::Compressed(int deflateLevel)
+{
+  Settings settings;
+  settings.chunked = true;
+  settings.deflateLevel = deflateLevel;
+  return H5DatasetCreationPolicy(settings);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5DatasetCreationPolicy::setDefaults(const Settings& settings)
+{
+  m_Defaults = settings;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5DatasetCreationPolicy::Settings H5DatasetCreationPolicy::getDefaults() const
+{
+  return m_Defaults;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5DatasetCreationPolicy::setOverride(const QString& arrayName, const Settings& settings)
+{
+  m_Overrides[arrayName] = settings;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5DatasetCreationPolicy::removeOverride(const QString& arrayName)
+{
+  m_Overrides.remove(arrayName);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5DatasetCreationPolicy::Settings H5DatasetCreationPolicy::getSettings(const QString& arrayName) const
+{
+  return m_Overrides.value(arrayName, m_Defaults);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5DatasetCreationPolicy::isEnabled() const
+{
+  if(m_Defaults.chunked || m_Defaults.deflateLevel > 0)
+  {
+    return true;
+  }
+  for(const Settings& settings : m_Overrides)
+  {
+    if(settings.chunked || settings.deflateLevel > 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5DatasetCreationPolicy::ComputeChunkDimensions(int32_t rank, const hsize_t* dims, size_t typeSize, size_t chunkBytes, hsize_t* chunkDims)
+{
+  if(rank <= 0 || nullptr == dims || nullptr == chunkDims)
+  {
+    return false;
+  }
+  for(int32_t i = 0; i < rank; i++)
+  {
+    if(dims[i] == 0)
+    {
+      return false;
+    }
+  }
+
+  if(typeSize == 0)
+  {
+    typeSize = 1;
+  }
+  // The number of elements that we can still place into the chunk
+  hsize_t budget = static_cast<hsize_t>(chunkBytes / typeSize);
+  if(budget == 0)
+  {
+    budget = 1;
+  }
+
+  // HDF5 dimensions are ordered slowest to fastest so we fill the chunk starting
+  // from the last dimension. This keeps the components of a tuple together and
+  // then grows the chunk along X, then Y and then Z.
+  for(int32_t i = rank - 1; i >= 0; i--)
+  {
+    if(budget <= 1)
+    {
+      chunkDims[i] = 1;
+      continue;
+    }
+    chunkDims[i] = (dims[i] < budget) ? dims[i] : budget;
+    budget = budget / chunkDims[i];
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+hid_t H5DatasetCreationPolicy::createPropertyList(const QString& arrayName, int32_t rank, const hsize_t* dims, size_t typeSize) const
+{
+  Settings settings = getSettings(arrayName);
+  bool useDeflate = (settings.deflateLevel > 0);
+  if(!settings.chunked && !useDeflate)
+  {
+    return H5P_DEFAULT;
+  }
+
+  hsize_t totalBytes = static_cast<hsize_t>(typeSize);
+  for(int32_t i = 0; i < rank; i++)
+  {
+    totalBytes *= dims[i];
+  }
+  if(totalBytes < static_cast<hsize_t>(settings.minimumBytes))
+  {
+    return H5P_DEFAULT;
+  }
+
+  std::vector<hsize_t> chunkDims(static_cast<size_t>(rank), 1);
+  if(!ComputeChunkDimensions(rank, dims, typeSize, settings.chunkBytes, chunkDims.data()))
+  {
+    return H5P_DEFAULT;
+  }
+
+  hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+  if(dcpl < 0)
+  {
+    return H5P_DEFAULT;
+  }
+  if(H5Pset_chunk(dcpl, rank, chunkDims.data()) < 0)
+  {
+    H5Pclose(dcpl);
+    return H5P_DEFAULT;
+  }
+
+  if(useDeflate && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0)
+  {
+    // The shuffle filter groups the bytes of each element together which lets
+    // deflate find far more redundancy in multi-byte numeric data.
+    if(settings.shuffle && typeSize > 1)
+    {
+      H5Pset_shuffle(dcpl);
+    }
+    int level = (settings.deflateLevel > 9) ? 9 : settings.deflateLevel;
+    H5Pset_deflate(dcpl, static_cast<unsigned>(level));
+  }
+  return dcpl;
+}
@@ -0,0 +1,153 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <hdf5.h>
+
+#include <QtCore/QMap>
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @class H5DatasetCreationPolicy H5DatasetCreationPolicy.h SIMPLib/HDF5/H5DatasetCreationPolicy.h
+ * @brief This class describes how HDF5 datasets should be laid out on disk when they
+ * are created (contiguous vs. chunked, deflate level, shuffle filter). A default set
+ * of settings applies to every dataset and individual arrays can be given their own
+ * settings by name. The default constructed policy produces contiguous, uncompressed
+ * datasets which is identical to what H5P_DEFAULT would produce.
+ *
+ * The chunk shape is derived from the dimensions of the dataset: the component
+ * dimensions are kept whole and the tuple dimensions are added from the fastest
+ * moving dimension outward until the chunk reaches the requested chunk size.
+ */
+class SIMPLib_EXPORT H5DatasetCreationPolicy
+{
+  public:
+    /**
+     * @brief The Settings struct holds the creation settings for a single dataset
+     */
+    struct Settings
+    {
+      bool chunked = false;
+      int deflateLevel = 0;
+      bool shuffle = true;
+      size_t chunkBytes = 1048576;
+      size_t minimumBytes = 65536;
+    };
+
+    H5DatasetCreationPolicy();
+    explicit H5DatasetCreationPolicy(const Settings& defaults);
+    ~H5DatasetCreationPolicy();
+
+    H5DatasetCreationPolicy(const H5DatasetCreationPolicy&) = default;
+    H5DatasetCreationPolicy& operator=(const H5DatasetCreationPolicy&) = default;
+
+    /**
+     * @brief Creates a policy that chunks every dataset and compresses it with the
+     * given deflate level (0-9).
+     * @param deflateLevel
+     * @return
+     */
+    static H5DatasetCreationPolicy Compressed(int deflateLevel);
+
+    /**
+     * @brief setDefaults Sets the settings used for any array without an override
+     * @param settings
+     */
+    void setDefaults(const Settings& settings);
+
+    /**
+     * @brief getDefaults
+     * @return
+     */
+    Settings getDefaults() const;
+
+    /**
+     * @brief setOverride Sets the creation settings for the array with the given name
+     * @param arrayName
+     * @param settings
+     */
+    void setOverride(const QString& arrayName, const Settings& settings);
+
+    /**
+     * @brief removeOverride
+     * @param arrayName
+     */
+    void removeOverride(const QString& arrayName);
+
+    /**
+     * @brief getSettings Returns the override for the named array or the default settings
+     * @param arrayName
+     * @return
+     */
+    Settings getSettings(const QString& arrayName) const;
+
+    /**
+     * @brief isEnabled Returns true if any dataset written with this policy could be chunked
+     * @return
+     */
+    bool isEnabled() const;
+
+    /**
+     * @brief ComputeChunkDimensions Computes a chunk shape for a dataset with the given
+     * HDF5 ordered (slowest to fastest) dimensions.
+     * @param rank The rank of the dataset
+     * @param dims The dimensions of the dataset
+     * @param typeSize Number of bytes of a single element
+     * @param chunkBytes The target number of bytes in a single chunk
+     * @param chunkDims Output array of size rank
+     * @return false if the dataset can not be chunked (such as a zero length dimension)
+     */
+    static bool ComputeChunkDimensions(int32_t rank, const hsize_t* dims, size_t typeSize, size_t chunkBytes, hsize_t* chunkDims);
+
+    /**
+     * @brief createPropertyList Creates the dataset creation property list that should be
+     * used for the named dataset. If the dataset should be written contiguously (or is
+     * too small to benefit from chunking) H5P_DEFAULT is returned. Any other value
+     * returned must be closed by the caller (see H5PropertyListAutoCloser).
+     * @param arrayName The name of the dataset
+     * @param rank The rank of the dataset
+     * @param dims The HDF5 ordered dimensions of the dataset
+     * @param typeSize Number of bytes of a single element
+     * @return
+     */
+    hid_t createPropertyList(const QString& arrayName, int32_t rank, const hsize_t* dims, size_t typeSize) const;
+
+  private:
+    Settings m_Defaults;
+    QMap<QString, Settings> m_Overrides;
+};
@@ -0,0 +1,169 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "H5LazyDataSource.h"
+
+#include "H5Support/QH5Utilities.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5LazyFileHandle::H5LazyFileHandle(hid_t fileId, const QString& filePath)
+: m_FileId(fileId)
+, m_FilePath(filePath)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5LazyFileHandle::~H5LazyFileHandle()
+{
+  if(m_FileId >= 0)
+  {
+    // The last array holding the file may be released while another filter is reading
+    std::lock_guard<std::mutex> lock(GetHDF5Mutex());
+    QH5Utilities::closeFile(m_FileId);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5LazyFileHandle::Pointer H5LazyFileHandle::Open(const QString& filePath)
+{
+  hid_t fileId = -1;
+  {
+    std::lock_guard<std::mutex> lock(GetHDF5Mutex());
+    fileId = QH5Utilities::openFile(filePath, true);
+  }
+  if(fileId < 0)
+  {
+    return NullPointer();
+  }
+  return Pointer(new H5LazyFileHandle(fileId, filePath));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+hid_t H5LazyFileHandle::getFileId() const
+{
+  return m_FileId;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString H5LazyFileHandle::getFilePath() const
+{
+  return m_FilePath;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::mutex& H5LazyFileHandle::getMutex()
+{
+  return GetHDF5Mutex();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::mutex& H5LazyFileHandle::GetHDF5Mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5LazyDataSource::H5LazyDataSource(const H5LazyFileHandle::Pointer& file, const QString& groupPath, const QString& datasetName)
+: m_File(file)
+, m_GroupPath(groupPath)
+, m_DatasetName(datasetName)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5LazyDataSource::~H5LazyDataSource() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5LazyDataSource::Pointer H5LazyDataSource::New(const H5LazyFileHandle::Pointer& file, const QString& groupPath, const QString& datasetName)
+{
+  if(nullptr == file.get())
+  {
+    return NullPointer();
+  }
+  return Pointer(new H5LazyDataSource(file, groupPath, datasetName));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5LazyFileHandle::Pointer H5LazyDataSource::getFile() const
+{
+  return m_File;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString H5LazyDataSource::getGroupPath() const
+{
+  return m_GroupPath;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString H5LazyDataSource::getDatasetName() const
+{
+  return m_DatasetName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::mutex& H5LazyDataSource::getMutex()
+{
+  return m_File->getMutex();
+}
@@ -0,0 +1,184 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include <hdf5.h>
+
+#include <QtCore/QString>
+
+#include "H5Support/QH5Lite.h"
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+
+/**
+ * @class H5LazyFileHandle H5LazyDataSource.h SIMPLib/HDF5/H5LazyDataSource.h
+ * @brief Keeps an HDF5 file open (read only) for as long as any lazily loaded array
+ * still refers to it. The file is closed when the last reference goes away. Lazy reads
+ * happen inside whatever filter first touches an array, so with dataflow execution they
+ * can run on several threads at once and against several files. The HDF5 library is not
+ * thread safe, so opening, reading and closing through any handle is serialized with one
+ * mutex shared by all of them.
+ */
+class SIMPLib_EXPORT H5LazyFileHandle
+{
+  public:
+    SIMPL_SHARED_POINTERS(H5LazyFileHandle)
+
+    /**
+     * @brief Open Opens the file read only
+     * @param filePath
+     * @return A NullPointer if the file could not be opened
+     */
+    static Pointer Open(const QString& filePath);
+
+    virtual ~H5LazyFileHandle();
+
+    /**
+     * @brief getFileId
+     * @return
+     */
+    hid_t getFileId() const;
+
+    /**
+     * @brief getFilePath
+     * @return
+     */
+    QString getFilePath() const;
+
+    /**
+     * @brief getMutex Returns the mutex that must be held while reading from the file. It is
+     * the same mutex for every handle.
+     * @return
+     */
+    std::mutex& getMutex();
+
+    /**
+     * @brief GetHDF5Mutex Returns the mutex that serializes the HDF5 calls of all handles
+     * @return
+     */
+    static std::mutex& GetHDF5Mutex();
+
+  protected:
+    H5LazyFileHandle(hid_t fileId, const QString& filePath);
+
+  private:
+    hid_t m_FileId = -1;
+    QString m_FilePath;
+
+    H5LazyFileHandle(const H5LazyFileHandle&) = delete; // Copy Constructor Not Implemented
+    void operator=(const H5LazyFileHandle&) = delete;   // Move assignment Not Implemented
+};
+
+/**
+ * @class H5LazyDataSource H5LazyDataSource.h SIMPLib/HDF5/H5LazyDataSource.h
+ * @brief Remembers where the values of an array live in an open HDF5 file so that an
+ * array created from the meta data alone can read its values the first time they are
+ * accessed, and read them again after they have been evicted from memory.
+ */
+class SIMPLib_EXPORT H5LazyDataSource
+{
+  public:
+    SIMPL_SHARED_POINTERS(H5LazyDataSource)
+
+    /**
+     * @brief New
+     * @param file The shared open file
+     * @param groupPath The absolute path of the group that holds the dataset
+     * @param datasetName The name of the dataset inside the group
+     * @return
+     */
+    static Pointer New(const H5LazyFileHandle::Pointer& file, const QString& groupPath, const QString& datasetName);
+
+    virtual ~H5LazyDataSource();
+
+    /**
+     * @brief getFile
+     * @return
+     */
+    H5LazyFileHandle::Pointer getFile() const;
+
+    /**
+     * @brief getGroupPath
+     * @return
+     */
+    QString getGroupPath() const;
+
+    /**
+     * @brief getDatasetName
+     * @return
+     */
+    QString getDatasetName() const;
+
+    /**
+     * @brief getMutex Returns the mutex shared by all lazily read files
+     * @return
+     */
+    std::mutex& getMutex();
+
+    /**
+     * @brief readDataset Reads the whole dataset into the preallocated array. The caller
+     * must hold the lock returned by getMutex().
+     * @param data
+     * @return Negative value on error
+     */
+    template <typename T>
+    int readDataset(T* data)
+    {
+      hid_t gid = H5Gopen(m_File->getFileId(), m_GroupPath.toLatin1().data(), H5P_DEFAULT);
+      if(gid < 0)
+      {
+        return -1;
+      }
+      int err = QH5Lite::readPointerDataset(gid, m_DatasetName, data);
+      H5Gclose(gid);
+      return err;
+    }
+
+  protected:
+    H5LazyDataSource(const H5LazyFileHandle::Pointer& file, const QString& groupPath, const QString& datasetName);
+
+  private:
+    H5LazyFileHandle::Pointer m_File;
+    QString m_GroupPath;
+    QString m_DatasetName;
+
+    H5LazyDataSource(const H5LazyDataSource&) = delete; // Copy Constructor Not Implemented
+    void operator=(const H5LazyDataSource&) = delete;   // Move assignment Not Implemented
+};
@@ -0,0 +1,191 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
+#include "H5Support/H5ScopedSentinel.h"
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5DatasetCreationPolicy.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class H5DatasetCreationPolicyTest
+{
+public:
+  H5DatasetCreationPolicyTest() = default;
+  virtual ~H5DatasetCreationPolicyTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::H5DatasetCreationPolicyTest::TestFile);
+    QDir tempDir(UnitTest::H5DatasetCreationPolicyTest::TestDir);
+    tempDir.removeRecursively();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  H5D_layout_t GetLayout(hid_t fileId, const QString& name)
+  {
+    hid_t did = H5Dopen(fileId, name.toLatin1().data(), H5P_DEFAULT);
+    DREAM3D_REQUIRE(did > 0)
+    hid_t dcpl = H5Dget_create_plist(did);
+    H5D_layout_t layout = H5Pget_layout(dcpl);
+    H5Pclose(dcpl);
+    H5Dclose(did);
+    return layout;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestChunkDimensions()
+  {
+    // Z, Y, X, Components
+    hsize_t dims[4] = {100, 200, 300, 3};
+    hsize_t chunk[4] = {0, 0, 0, 0};
+
+    // 1 MB of floats is 262144 elements. All 3 components and all 300 X values fit,
+    // leaving room for 291 rows of Y which is clamped to 200.
+    bool ok = H5DatasetCreationPolicy::ComputeChunkDimensions(4, dims, sizeof(float), 1048576, chunk);
+    DREAM3D_REQUIRE_EQUAL(ok, true)
+    DREAM3D_REQUIRE_EQUAL(chunk[3], 3)
+    DREAM3D_REQUIRE_EQUAL(chunk[2], 300)
+    DREAM3D_REQUIRE_EQUAL(chunk[1], 200)
+    DREAM3D_REQUIRE_EQUAL(chunk[0], 1)
+
+    // A chunk can never be larger than the dataset
+    hsize_t smallDims[1] = {10};
+    hsize_t smallChunk[1] = {0};
+    ok = H5DatasetCreationPolicy::ComputeChunkDimensions(1, smallDims, sizeof(double), 1048576, smallChunk);
+    DREAM3D_REQUIRE_EQUAL(ok, true)
+    DREAM3D_REQUIRE_EQUAL(smallChunk[0], 10)
+
+    // Zero length dimensions can not be chunked
+    hsize_t zeroDims[2] = {0, 3};
+    ok = H5DatasetCreationPolicy::ComputeChunkDimensions(2, zeroDims, sizeof(float), 1048576, chunk);
+    DREAM3D_REQUIRE_EQUAL(ok, false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCompressedWrite()
+  {
+    QDir dir(UnitTest::H5DatasetCreationPolicyTest::TestDir);
+    dir.mkpath(".");
+
+    QVector<size_t> tDims = {64, 64, 16};
+    QVector<size_t> cDims(1, 1);
+    Int32ArrayType::Pointer compressed = Int32ArrayType::CreateArray(tDims, cDims, "Compressed", true);
+    Int32ArrayType::Pointer contiguous = Int32ArrayType::CreateArray(tDims, cDims, "Contiguous", true);
+    Int32ArrayType::Pointer tiny = Int32ArrayType::CreateArray(10, "Tiny", true);
+    for(size_t i = 0; i < compressed->getNumberOfTuples(); i++)
+    {
+      compressed->setValue(i, static_cast<int32_t>(i / 100));
+      contiguous->setValue(i, static_cast<int32_t>(i / 100));
+    }
+    tiny->initializeWithZeros();
+
+    H5DatasetCreationPolicy policy = H5DatasetCreationPolicy::Compressed(5);
+    // The per array override keeps the "Contiguous" array un-chunked
+    policy.setOverride("Contiguous", H5DatasetCreationPolicy::Settings());
+
+    hid_t fileId = QH5Utilities::createFile(UnitTest::H5DatasetCreationPolicyTest::TestFile);
+    DREAM3D_REQUIRE(fileId > 0)
+    {
+      H5ScopedFileSentinel sentinel(&fileId, false);
+      int err = compressed->writeH5Data(fileId, tDims, policy);
+      DREAM3D_REQUIRE(err >= 0)
+      err = contiguous->writeH5Data(fileId, tDims, policy);
+      DREAM3D_REQUIRE(err >= 0)
+      QVector<size_t> tinyDims(1, 10);
+      err = tiny->writeH5Data(fileId, tinyDims, policy);
+      DREAM3D_REQUIRE(err >= 0)
+
+      DREAM3D_REQUIRE_EQUAL(GetLayout(fileId, "Compressed"), H5D_CHUNKED)
+      DREAM3D_REQUIRE_EQUAL(GetLayout(fileId, "Contiguous"), H5D_CONTIGUOUS)
+      // Datasets below the minimum size are never chunked
+      DREAM3D_REQUIRE_EQUAL(GetLayout(fileId, "Tiny"), H5D_CONTIGUOUS)
+
+      // The compressed data must read back exactly
+      IDataArray::Pointer readBack = H5DataArrayReader::ReadIDataArray(fileId, "Compressed");
+      DREAM3D_REQUIRE_VALID_POINTER(readBack.get())
+      Int32ArrayType::Pointer readInts = std::dynamic_pointer_cast<Int32ArrayType>(readBack);
+      DREAM3D_REQUIRE_VALID_POINTER(readInts.get())
+      DREAM3D_REQUIRE_EQUAL(readInts->getNumberOfTuples(), compressed->getNumberOfTuples())
+      for(size_t i = 0; i < readInts->getNumberOfTuples(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(readInts->getValue(i), compressed->getValue(i))
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "#### H5DatasetCreationPolicyTest Starting ####" << std::endl;
+#if !REMOVE_TEST_FILES
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+#endif
+    DREAM3D_REGISTER_TEST(TestChunkDimensions())
+    DREAM3D_REGISTER_TEST(TestCompressedWrite())
+
+#if REMOVE_TEST_FILES
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+#endif
+  }
+
+private:
+  H5DatasetCreationPolicyTest(const H5DatasetCreationPolicyTest&); // Copy Constructor Not Implemented
+  void operator=(const H5DatasetCreationPolicyTest&);              // Move assignment Not Implemented
+};
@@ -0,0 +1,190 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <itkStreamingImageFilter.h>
+
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/ITK/itkInPlaceDream3DDataToImageFilter.h"
+#include "SIMPLib/ITK/itkInPlaceImageToDream3DDataFilter.h"
+
+class itkInPlaceDream3DDataStreamingTest
+{
+
+public:
+  itkInPlaceDream3DDataStreamingTest() = default;
+  virtual ~itkInPlaceDream3DDataStreamingTest() = default;
+
+  using ImageType = itk::Dream3DImage<float, 3>;
+  using ToImageType = itk::InPlaceDream3DDataToImageFilter<float, 3>;
+  using ToDream3DType = itk::InPlaceImageToDream3DDataFilter<float, 3>;
+
+  const size_t k_Dims[3] = {7, 5, 11};
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainer::Pointer CreateDataContainer(const QString& name)
+  {
+    DataContainer::Pointer dc = DataContainer::New(name);
+    ImageGeom::Pointer imageGeom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    imageGeom->setDimensions(k_Dims[0], k_Dims[1], k_Dims[2]);
+    dc->setGeometry(imageGeom);
+    return dc;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer AddInputArray(const DataContainer::Pointer& dc)
+  {
+    QVector<size_t> tDims = {k_Dims[0], k_Dims[1], k_Dims[2]};
+    AttributeMatrix::Pointer attrMat = dc->createAndAddAttributeMatrix(tDims, SIMPL::Defaults::CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+    FloatArrayType::Pointer data = FloatArrayType::CreateArray(k_Dims[0] * k_Dims[1] * k_Dims[2], QVector<size_t>(1, 1), "Input", true);
+    for(size_t i = 0; i < data->getNumberOfTuples(); i++)
+    {
+      data->setValue(i, static_cast<float>(i));
+    }
+    attrMat->addAttributeArray(data->getName(), data);
+    return data;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestSlabViews()
+  {
+    DataContainer::Pointer dc = CreateDataContainer("Input");
+    FloatArrayType::Pointer data = AddInputArray(dc);
+
+    ToImageType::Pointer toImage = ToImageType::New();
+    toImage->SetInput(dc);
+    toImage->SetAttributeMatrixArrayName(SIMPL::Defaults::CellAttributeMatrixName.toStdString());
+    toImage->SetDataArrayName("Input");
+    toImage->SetInPlace(true);
+    toImage->UpdateOutputInformation();
+
+    // Ask for a few pixels in the middle. The filter must widen that to whole Z-slabs
+    // and expose them without copying.
+    ImageType::RegionType requested;
+    requested.SetIndex(0, 2);
+    requested.SetIndex(1, 1);
+    requested.SetIndex(2, 4);
+    requested.SetSize(0, 2);
+    requested.SetSize(1, 2);
+    requested.SetSize(2, 3);
+    ImageType::Pointer image = toImage->GetOutput();
+    image->SetRequestedRegion(requested);
+    image->Update();
+
+    ImageType::RegionType buffered = image->GetBufferedRegion();
+    DREAM3D_REQUIRE_EQUAL(buffered.GetIndex(0), 0)
+    DREAM3D_REQUIRE_EQUAL(buffered.GetIndex(1), 0)
+    DREAM3D_REQUIRE_EQUAL(buffered.GetIndex(2), 4)
+    DREAM3D_REQUIRE_EQUAL(buffered.GetSize(0), k_Dims[0])
+    DREAM3D_REQUIRE_EQUAL(buffered.GetSize(1), k_Dims[1])
+    DREAM3D_REQUIRE_EQUAL(buffered.GetSize(2), static_cast<size_t>(3))
+    DREAM3D_REQUIRE(image->GetBufferPointer() == data->getPointer(4 * k_Dims[0] * k_Dims[1]))
+
+    ImageType::IndexType index;
+    index[0] = 3;
+    index[1] = 2;
+    index[2] = 5;
+    DREAM3D_REQUIRE_EQUAL(image->GetPixel(index), static_cast<float>((5 * k_Dims[1] + 2) * k_Dims[0] + 3))
+
+    // The view keeps the DataArray alive on its own
+    FloatArrayType* rawData = data.get();
+    data.reset();
+    dc->getAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName)->removeAttributeArray("Input");
+    DREAM3D_REQUIRE(image->GetPixelContainer()->GetBufferOwner().get() == static_cast<void*>(static_cast<IDataArray*>(rawData)))
+    DREAM3D_REQUIRE_EQUAL(image->GetPixel(index), static_cast<float>((5 * k_Dims[1] + 2) * k_Dims[0] + 3))
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestStreamedRoundTrip()
+  {
+    DataContainer::Pointer dc = CreateDataContainer("Input");
+    FloatArrayType::Pointer data = AddInputArray(dc);
+    DataContainer::Pointer outputDc = CreateDataContainer("Output");
+
+    for(bool inPlace : {true, false})
+    {
+      ToImageType::Pointer toImage = ToImageType::New();
+      toImage->SetInput(dc);
+      toImage->SetAttributeMatrixArrayName(SIMPL::Defaults::CellAttributeMatrixName.toStdString());
+      toImage->SetDataArrayName("Input");
+      toImage->SetInPlace(inPlace);
+
+      using StreamerType = itk::StreamingImageFilter<ImageType, ImageType>;
+      StreamerType::Pointer streamer = StreamerType::New();
+      streamer->SetInput(toImage->GetOutput());
+      streamer->SetNumberOfStreamDivisions(4);
+
+      ToDream3DType::Pointer toDream3D = ToDream3DType::New();
+      toDream3D->SetInput(streamer->GetOutput());
+      toDream3D->SetAttributeMatrixArrayName(SIMPL::Defaults::CellAttributeMatrixName.toStdString());
+      toDream3D->SetDataArrayName("Output");
+      toDream3D->SetDataContainer(outputDc);
+      toDream3D->SetNumberOfStreamDivisions(3);
+      toDream3D->Update();
+
+      FloatArrayType::Pointer output = outputDc->getAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName)->getAttributeArrayAs<FloatArrayType>("Output");
+      DREAM3D_REQUIRE_VALID_POINTER(output.get())
+      DREAM3D_REQUIRE_EQUAL(output->getNumberOfTuples(), data->getNumberOfTuples())
+      DREAM3D_REQUIRE(output->getPointer(0) != data->getPointer(0))
+      for(size_t i = 0; i < data->getNumberOfTuples(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(output->getValue(i), data->getValue(i))
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "#### itkInPlaceDream3DDataStreamingTest Starting ####" << std::endl;
+    DREAM3D_REGISTER_TEST(TestSlabViews());
+    DREAM3D_REGISTER_TEST(TestStreamedRoundTrip());
+  }
+
+private:
+  itkInPlaceDream3DDataStreamingTest(const itkInPlaceDream3DDataStreamingTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const itkInPlaceDream3DDataStreamingTest&) = delete;                     // Move assignment Not Implemented
+};
@@ -17,6 +17,8 @@
  *=========================================================================*/
 #pragma once
 
+#include <memory>
+
 #include "itkImportImageContainer.h"
 
 namespace itk
@@ -62,6 +64,20 @@ public:
   /** Standard part of every itk Object. */
   itkTypeMacro(ImportDream3DImageContainer, ImportImageContainer);
 
+  /** Keeps the object that owns an imported, non-managed buffer alive for as
+   * long as this container points into it. This allows the container to be a
+   * shared view of memory held by someone else (e.g. a DREAM3D DataArray)
+   * without copying it. The reference is dropped as soon as the container
+   * releases its import pointer. Call this after SetImportPointer(). */
+  void SetBufferOwner(const std::shared_ptr<void>& owner)
+  {
+    m_BufferOwner = owner;
+  }
+  const std::shared_ptr<void>& GetBufferOwner() const
+  {
+    return m_BufferOwner;
+  }
+
 protected:
   ImportDream3DImageContainer();
   virtual ~ImportDream3DImageContainer();
@@ -83,6 +99,8 @@ protected:
 private:
   ImportDream3DImageContainer(const Self&) = delete;
   void operator=(const Self&) = delete;
+
+  std::shared_ptr<void> m_BufferOwner;
 };
 } // end namespace itk
 
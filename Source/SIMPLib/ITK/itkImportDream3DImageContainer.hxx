@@ -91,6 +91,7 @@ ImportDream3DImageContainer<TElementIdentifier, TElement>
     free(data);
     this->SetImportPointer(nullptr);
   }
+  m_BufferOwner.reset();
   Superclass::DeallocateManagedMemory();
 }
 
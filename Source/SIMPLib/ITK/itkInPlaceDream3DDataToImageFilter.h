@@ -25,6 +25,7 @@ public:
   typedef typename ::DataArray<ValueType> DataArrayPixelType;
   typedef typename itk::ImageSource<ImageType> Superclass;
   typedef typename itk::SizeValueType SizeValueType;
+  typedef typename ImageType::RegionType RegionType;
 
   /** Method for creation through the object factory. */
   itkNewMacro(Self);
@@ -52,7 +53,24 @@ protected:
   virtual void VerifyPreconditions() override;
 
   virtual void GenerateOutputInformation() override;
+
+  /** The DataArray stores the image with the last dimension varying slowest, so
+   * any range of Z-slabs (rows in 2D) is one contiguous block of memory. The
+   * requested region is therefore enlarged to span the full extent of every other
+   * dimension, which lets downstream filters stream the image while this filter
+   * hands out views into the DataArray instead of copies. */
+  virtual void EnlargeOutputRequestedRegion(DataObject* output) override;
+
+  /** Exposes the requested slabs of the DataArray as the output buffer. When
+   * InPlace is on, the output is a non-owning view that keeps the DataArray
+   * alive; the buffer is only handed over to ITK if PixelContainerWillOwnTheBuffer
+   * is set and the whole image is requested. Otherwise only the requested slabs
+   * are copied. */
   virtual void GenerateData() override;
+
+  /** Returns the region made of the slabs of 'largest' that intersect 'requested' */
+  static RegionType ComputeSlabRegion(const RegionType& largest, const RegionType& requested);
+
   DataContainer::Pointer m_DataContainer;
 
 private:
@@ -63,7 +81,7 @@ private:
   std::string m_AttributeMatrixArrayName;
   typename ImportImageContainerType::Pointer m_ImportImageContainer;
   bool m_InPlace;                        // enable the possibility of in-place
-  bool m_PixelContainerWillOwnTheBuffer; // By default, this filter does not take data ownership
+  bool m_PixelContainerWillOwnTheBuffer; // By default, this filter does not take data ownership. Only honored when the whole image is requested
 };
 } // namespace itk
 
@@ -113,6 +113,39 @@ InPlaceDream3DDataToImageFilter< PixelType, VDimension >
 }
 
 
+template< typename PixelType, unsigned int VDimension>
+typename InPlaceDream3DDataToImageFilter< PixelType, VDimension >::RegionType
+InPlaceDream3DDataToImageFilter< PixelType, VDimension >
+::ComputeSlabRegion(const RegionType& largest, const RegionType& requested)
+{
+  RegionType clipped = requested;
+  if(!clipped.Crop(largest))
+  {
+    return largest;
+  }
+  const unsigned int slabDimension = VDimension - 1;
+  typename RegionType::IndexType index = largest.GetIndex();
+  typename RegionType::SizeType size = largest.GetSize();
+  index[slabDimension] = clipped.GetIndex()[slabDimension];
+  size[slabDimension] = clipped.GetSize()[slabDimension];
+  return RegionType(index, size);
+}
+
+
+template< typename PixelType, unsigned int VDimension>
+void
+InPlaceDream3DDataToImageFilter< PixelType, VDimension >
+::EnlargeOutputRequestedRegion(DataObject* output)
+{
+  Superclass::EnlargeOutputRequestedRegion(output);
+  ImageType* outputPtr = dynamic_cast<ImageType*>(output);
+  if(outputPtr)
+  {
+    outputPtr->SetRequestedRegion(ComputeSlabRegion(outputPtr->GetLargestPossibleRegion(), outputPtr->GetRequestedRegion()));
+  }
+}
+
+
 template< typename PixelType, unsigned int VDimension>
 void
 InPlaceDream3DDataToImageFilter< PixelType, VDimension >
@@ -121,31 +154,50 @@ InPlaceDream3DDataToImageFilter< PixelType, VDimension >
   // Get data pointer
   AttributeMatrix::Pointer ma = m_DataContainer->getAttributeMatrix(m_AttributeMatrixArrayName.c_str());
   IDataArray::Pointer dataArray = ma->getAttributeArray(m_DataArrayName.c_str());
-  size_t size = dataArray->getSize();
-  PixelType *buffer;
+  // get pointer to the output
+  ImagePointer outputPtr = this->GetOutput();
+  const RegionType largestRegion = outputPtr->GetLargestPossibleRegion();
+  const RegionType region = ComputeSlabRegion(largestRegion, outputPtr->GetRequestedRegion());
+  if(dataArray->getNumberOfTuples() < largestRegion.GetNumberOfPixels())
+  {
+    itkExceptionMacro("Attribute array (" + m_DataArrayName + ") has fewer tuples than the image has pixels");
+  }
+  // Pixels of the slabs in front of the region. The last dimension varies slowest.
+  SizeValueType offset = region.GetIndex()[VDimension - 1] - largestRegion.GetIndex()[VDimension - 1];
+  for(unsigned int i = 0; i < VDimension - 1; i++)
+  {
+    offset *= largestRegion.GetSize()[i];
+  }
+  const SizeValueType numberOfPixels = region.GetNumberOfPixels();
+  const bool wholeImage = (region == largestRegion);
+
   if(m_InPlace)
   {
-    if (m_PixelContainerWillOwnTheBuffer)
+    const bool containerOwnsBuffer = m_PixelContainerWillOwnTheBuffer && wholeImage;
+    if (containerOwnsBuffer)
     {
       dataArray->releaseOwnership();
     }
-    buffer = static_cast<PixelType*>(dataArray->getVoidPointer( 0 ));
+    PixelType* buffer = static_cast<PixelType*>(dataArray->getVoidPointer( 0 )) + offset;
+    if( !m_ImportImageContainer || buffer != m_ImportImageContainer->GetImportPointer() || numberOfPixels != m_ImportImageContainer->Size() )
+    {
+      m_ImportImageContainer = ImportImageContainerType::New();
+      m_ImportImageContainer->SetImportPointer( buffer, numberOfPixels, containerOwnsBuffer );
+      if(!containerOwnsBuffer)
+      {
+        // The image is a view of the DataArray and must not outlive it
+        m_ImportImageContainer->SetBufferOwner(dataArray);
+      }
+    }
   }
   else
   {
-    m_PixelContainerWillOwnTheBuffer = true;
-    buffer = new PixelType[size];
-    ::memcpy( buffer, static_cast<PixelType*>(dataArray->getVoidPointer( 0 )), size * sizeof( PixelType ) );
-  }
-  if( !m_ImportImageContainer || buffer != m_ImportImageContainer->GetImportPointer() )
-  {
+    // Only the requested slabs are copied. Reserve() allocates with malloc() like the rest of Dream3DImage
     m_ImportImageContainer = ImportImageContainerType::New();
-    m_ImportImageContainer->SetImportPointer( buffer,
-        size, m_PixelContainerWillOwnTheBuffer);
+    m_ImportImageContainer->Reserve(numberOfPixels);
+    ::memcpy( m_ImportImageContainer->GetBufferPointer(), static_cast<PixelType*>(dataArray->getVoidPointer( 0 )) + offset, numberOfPixels * sizeof( PixelType ) );
   }
-  // get pointer to the output
-  ImagePointer outputPtr = this->GetOutput();
-  outputPtr->SetBufferedRegion( outputPtr->GetLargestPossibleRegion() );
+  outputPtr->SetBufferedRegion( region );
   outputPtr->SetPixelContainer( m_ImportImageContainer );
  }
 
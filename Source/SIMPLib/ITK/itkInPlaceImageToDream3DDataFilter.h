@@ -25,6 +25,7 @@ public:
 
   typedef typename itk::Dream3DImage<PixelType, VDimension> ImageType;
   typedef typename ImageType::Pointer ImagePointer;
+  typedef typename ImageType::RegionType RegionType;
   typedef typename itk::NumericTraits<PixelType>::ValueType ValueType;
   typedef typename ::DataArray<ValueType> DataArrayPixelType;
   typedef typename itk::SimpleDataObjectDecorator<DataContainer::Pointer> DecoratorType;
@@ -50,6 +51,15 @@ public:
 
   itkBooleanMacro(InPlace);
 
+  /** Number of Z-slabs (rows for 2D images) the input is requested in. With more
+   * than one division the upstream pipeline only ever has to hold one slab in
+   * memory; each slab is copied into the DataArray as soon as it is produced. An
+   * existing DataArray of the right type and size is filled directly. The input
+   * buffer can not be handed over to the DataArray in that case, so InPlace only
+   * applies when a single division is used. */
+  itkSetClampMacro(NumberOfStreamDivisions, unsigned int, 1, NumericTraits<unsigned int>::max());
+  itkGetConstMacro(NumberOfStreamDivisions, unsigned int);
+
 protected:
   InPlaceImageToDream3DDataFilter();
   virtual ~InPlaceImageToDream3DDataFilter();
@@ -59,6 +69,11 @@ protected:
 
   virtual void GenerateData() override;
   virtual void GenerateOutputInformation() override;
+  virtual void GenerateInputRequestedRegion() override;
+
+  /** Returns the slabs of 'largest' that make up stream division 'piece' out of 'numberOfPieces' */
+  static RegionType ComputeStreamRegion(const RegionType& largest, unsigned int piece, unsigned int numberOfPieces);
+  unsigned int ComputeNumberOfPieces(const RegionType& largest) const;
 
   void CheckValidArrayPathComponentName(std::string var);
 
@@ -69,6 +84,7 @@ private:
   std::string m_DataArrayName;
   std::string m_AttributeMatrixArrayName;
   bool m_InPlace; // enable the possibility of in-place
+  unsigned int m_NumberOfStreamDivisions;
 };                // end of class InPlaceImageToDream3DDataFilter
 } // namespace itk
 
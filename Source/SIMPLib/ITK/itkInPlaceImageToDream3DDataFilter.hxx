@@ -23,6 +23,7 @@ InPlaceImageToDream3DDataFilter<PixelType,VDimension>
   this->SetNumberOfRequiredInputs(1);
   this->SetDataContainer(DataContainer::NullPointer());
   m_InPlace = true;
+  m_NumberOfStreamDivisions = 1;
 }
 
 
@@ -161,8 +162,10 @@ InPlaceImageToDream3DDataFilter<PixelType, VDimension>
 	  }
   }
   typename DataArrayPixelType::Pointer data;
-  inputPtr->SetBufferedRegion( inputPtr->GetLargestPossibleRegion() );
-  if( m_InPlace )
+  const RegionType largestRegion = inputPtr->GetLargestPossibleRegion();
+  const unsigned int numberOfPieces = ComputeNumberOfPieces(largestRegion);
+  // The buffer can only be handed over if it holds the whole image
+  if( m_InPlace && numberOfPieces == 1 && inputPtr->GetBufferedRegion() == largestRegion )
   {
     inputPtr->GetPixelContainer()->SetContainerManageMemory( false );
     data = DataArrayPixelType::WrapPointer( reinterpret_cast<ValueType*>(inputPtr->GetBufferPointer()),
@@ -172,15 +175,82 @@ InPlaceImageToDream3DDataFilter<PixelType, VDimension>
   {
     data = DataArrayPixelType::CreateArray(imageGeom->getNumberOfElements(), cDims,
               m_DataArrayName.c_str(), true);
-    if (nullptr != data.get())
+    if (nullptr == data.get())
     {
-      ::memcpy(data->getPointer(0), reinterpret_cast<ValueType*>(inputPtr->GetBufferPointer()), imageGeom->getNumberOfElements() * sizeof(ValueType));
+      itkExceptionMacro("Could not allocate attribute array (" + m_DataArrayName + ")");
+    }
+    // Slabs are contiguous in both the image buffer and the DataArray
+    const unsigned int slabDimension = VDimension - 1;
+    itk::SizeValueType pixelsPerSlab = 1;
+    for (unsigned int i = 0; i < slabDimension; i++)
+    {
+      pixelsPerSlab *= largestRegion.GetSize()[i];
+    }
+    PixelType* destination = reinterpret_cast<PixelType*>(data->getPointer(0));
+    for (unsigned int piece = 0; piece < numberOfPieces; piece++)
+    {
+      const RegionType streamRegion = ComputeStreamRegion(largestRegion, piece, numberOfPieces);
+      // The first piece was brought up to date by the pipeline before GenerateData() was called
+      if (!inputPtr->GetBufferedRegion().IsInside(streamRegion))
+      {
+        inputPtr->SetRequestedRegion(streamRegion);
+        inputPtr->PropagateRequestedRegion();
+        inputPtr->UpdateOutputData();
+      }
+      const itk::SizeValueType destinationOffset = (streamRegion.GetIndex()[slabDimension] - largestRegion.GetIndex()[slabDimension]) * pixelsPerSlab;
+      const PixelType* source = inputPtr->GetBufferPointer() + inputPtr->ComputeOffset(streamRegion.GetIndex());
+      ::memcpy(destination + destinationOffset, source, streamRegion.GetNumberOfPixels() * sizeof(PixelType));
+      this->UpdateProgress(static_cast<float>(piece + 1) / static_cast<float>(numberOfPieces));
     }
   }
   attrMat->addAttributeArray(m_DataArrayName.c_str(), data);
   outputPtr->Set(dataContainer);
 }
 
+template<typename PixelType, unsigned int VDimension>
+void
+InPlaceImageToDream3DDataFilter<PixelType, VDimension>
+::GenerateInputRequestedRegion()
+{
+  Superclass::GenerateInputRequestedRegion();
+  // Only the first stream division is requested up front. GenerateData() pulls the others.
+  ImageType* inputPtr = dynamic_cast<ImageType*>(this->GetInput(0));
+  if (inputPtr)
+  {
+    const RegionType largestRegion = inputPtr->GetLargestPossibleRegion();
+    inputPtr->SetRequestedRegion(ComputeStreamRegion(largestRegion, 0, ComputeNumberOfPieces(largestRegion)));
+  }
+}
+
+template<typename PixelType, unsigned int VDimension>
+typename InPlaceImageToDream3DDataFilter<PixelType, VDimension>::RegionType
+InPlaceImageToDream3DDataFilter<PixelType, VDimension>
+::ComputeStreamRegion(const RegionType& largest, unsigned int piece, unsigned int numberOfPieces)
+{
+  const unsigned int slabDimension = VDimension - 1;
+  const itk::SizeValueType numberOfSlabs = largest.GetSize()[slabDimension];
+  const itk::SizeValueType begin = numberOfSlabs * piece / numberOfPieces;
+  const itk::SizeValueType end = numberOfSlabs * (piece + 1) / numberOfPieces;
+  typename RegionType::IndexType index = largest.GetIndex();
+  typename RegionType::SizeType size = largest.GetSize();
+  index[slabDimension] += static_cast<typename RegionType::IndexValueType>(begin);
+  size[slabDimension] = end - begin;
+  return RegionType(index, size);
+}
+
+template<typename PixelType, unsigned int VDimension>
+unsigned int
+InPlaceImageToDream3DDataFilter<PixelType, VDimension>
+::ComputeNumberOfPieces(const RegionType& largest) const
+{
+  const itk::SizeValueType numberOfSlabs = largest.GetSize()[VDimension - 1];
+  if (numberOfSlabs < m_NumberOfStreamDivisions)
+  {
+    return numberOfSlabs > 0 ? static_cast<unsigned int>(numberOfSlabs) : 1;
+  }
+  return m_NumberOfStreamDivisions;
+}
+
 // Check that names has been initialized correctly
 template<typename PixelType, unsigned int VDimension>
 void
@@ -35,15 +35,63 @@
 
 #include "GeometryMath.h"
 
-#include <chrono>
+#include <algorithm>
 #include <random>
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
 #include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/Math/PolyhedronBVH.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 //#include "SIMPLib/Math/SIMPLibRandom.h"
 
+namespace
+{
+/**
+ * @brief The PointsInPolyhedronImpl class classifies a range of points against a face hierarchy
+ */
+class PointsInPolyhedronImpl
+{
+public:
+  PointsInPolyhedronImpl(const PolyhedronBVH& bvh, const float* points, char* codes, uint64_t seed)
+  : m_Bvh(bvh)
+  , m_Points(points)
+  , m_Codes(codes)
+  , m_Seed(seed)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    // Every range gets its own generator so the threads never share random state
+    std::mt19937_64 generator(m_Seed ^ (static_cast<uint64_t>(start) * 0x9E3779B97F4A7C15ULL));
+    for(size_t i = start; i < end; i++)
+    {
+      m_Codes[i] = GeometryMath::PointInPolyhedron(m_Bvh, m_Points + 3 * i, generator);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const PolyhedronBVH& m_Bvh;
+  const float* m_Points;
+  char* m_Codes;
+  uint64_t m_Seed;
+};
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -278,13 +326,19 @@ float GeometryMath::LengthOfRayInBox(const float* p, const float* q, const float
 //
 // -----------------------------------------------------------------------------
 void GeometryMath::GenerateRandomRay(float length, float ray[3])
+{
+  // Seeding a generator is far more expensive than drawing from it, so each thread seeds its own once
+  static thread_local std::mt19937_64 generator(std::random_device{}());
+  GenerateRandomRay(generator, length, ray);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GeometryMath::GenerateRandomRay(std::mt19937_64& generator, float length, float ray[3])
 {
   float w, t;
 
-  std::random_device randomDevice;           // Will be used to obtain a seed for the random number engine
-  std::mt19937_64 generator(randomDevice()); // Standard mersenne_twister_engine seeded with rd()
-  std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-  generator.seed(seed);
   std::uniform_real_distribution<> distribution(0.0, 1.0);
 
   ray[2] = (2.0f * distribution(generator)) - 1.0f;
@@ -1190,3 +1244,76 @@ LOOP:
     return 'o';
   }
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+char GeometryMath::PointInPolyhedron(const PolyhedronBVH& bvh, const float* q, std::mt19937_64& generator)
+{
+  float ray[3] = {0.0f, 0.0f, 0.0f}; /* Ray */
+  float r[3] = {0.0f, 0.0f, 0.0f};   /* Ray endpoint. */
+  float ll[3] = {0.0f, 0.0f, 0.0f};
+  float ur[3] = {0.0f, 0.0f, 0.0f};
+  int crossings = 0;
+
+  //* If query point is outside bounding box, finished. */
+  bvh.getBounds(ll, ur);
+  if(bvh.getNumberOfFaces() == 0 || PointInBox(q, ll, ur) == false)
+  {
+    return 'o';
+  }
+
+  float radius = bvh.getRayLength();
+  size_t numFaces = bvh.getNumberOfFaces();
+  for(size_t k = 0; k < numFaces; k++)
+  {
+    // Generate and add ray to point to find other end
+    GenerateRandomRay(generator, radius, ray);
+    r[0] = q[0] + ray[0];
+    r[1] = q[1] + ray[1];
+    r[2] = q[2] + ray[2];
+
+    char code = bvh.countCrossings(q, r, crossings);
+
+    /* If query endpoint q sits on a V/E/F, return that code. */
+    if(code == 'V' || code == 'E' || code == 'F')
+    {
+      return code;
+    }
+
+    /* No degeneracies encountered: ray is generic, so finished. */
+    if(code == '0')
+    {
+      break;
+    }
+  }
+
+  /* q strictly interior to polyhedron if an odd number of crossings. */
+  if((crossings % 2) == 1)
+  {
+    return 'i';
+  }
+  else
+  {
+    return 'o';
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GeometryMath::PointsInPolyhedron(const PolyhedronBVH& bvh, const float* points, size_t numPoints, char* codes, uint64_t seed)
+{
+  PointsInPolyhedronImpl impl(bvh, points, codes, seed);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  bool doParallel = true;
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numPoints), impl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    impl.compute(0, numPoints);
+  }
+}
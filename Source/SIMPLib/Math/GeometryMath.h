@@ -36,6 +36,7 @@
 
 #pragma once
 
+#include <random>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
@@ -43,6 +44,7 @@
 
 class VertexGeom;
 class TriangleGeom;
+class PolyhedronBVH;
 
 /*
  * @class GeometryMath GeometryMath.h DREAM3DLib/Common/GeometryMath.h
@@ -211,6 +213,30 @@ class SIMPLib_EXPORT GeometryMath
                                   float radius,
                                   float& distToBoundary);
 
+    /**
+     * @brief Determines if a point is inside of the polyhedron whose faces are held by the hierarchy.
+     * Only the faces near each test ray are checked, so the cost grows with log(numFaces). The
+     * hierarchy is only read and the random rays come from the caller's generator, so this may be
+     * called from several threads at once as long as each thread uses its own generator.
+     * @param bvh
+     * @param q
+     * @param generator
+     * @return 'i' or 'o' for points inside or outside and 'V', 'E' or 'F' for points on the surface
+     */
+    static char PointInPolyhedron(const PolyhedronBVH& bvh, const float* q, std::mt19937_64& generator);
+
+    /**
+     * @brief Classifies a batch of points against the polyhedron whose faces are held by the hierarchy.
+     * The points are split into chunks that are classified in parallel, each chunk with its own random
+     * generator derived from the seed.
+     * @param bvh
+     * @param points 3 coordinates per point
+     * @param numPoints
+     * @param codes Receives one PointInPolyhedron() code per point
+     * @param seed
+     */
+    static void PointsInPolyhedron(const PolyhedronBVH& bvh, const float* points, size_t numPoints, char* codes, uint64_t seed = std::mt19937_64::default_seed);
+
     /**
        * @brief Determines if a point is inside of a triangle defined by 3 points
        * @param a
@@ -260,6 +286,15 @@ class SIMPLib_EXPORT GeometryMath
      */
     static void GenerateRandomRay(float length, float ray[3]);
 
+    /**
+     * @brief Creates a randomly oriented ray of given length using the supplied generator
+     * @param generator
+     * @param length float
+     * @param ray 1x3 Vector
+     * @return
+     */
+    static void GenerateRandomRay(std::mt19937_64& generator, float length, float ray[3]);
+
     /**
      * @brief Determines the bounding box defined by the lower left and upper right corners of a set of vertices
      * @param verts pointer to vertex array
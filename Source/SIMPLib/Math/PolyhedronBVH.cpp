@@ -0,0 +1,342 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PolyhedronBVH.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Math/GeometryMath.h"
+
+namespace
+{
+const int32_t k_LeafSize = 4;
+const int32_t k_MaxStackSize = 64;
+
+/**
+ * @brief Clips the segment from q to r against the box. Touching the box counts as an intersection.
+ * @param q
+ * @param r
+ * @param ll
+ * @param ur
+ * @return
+ */
+bool SegmentIntersectsBox(const float* q, const float* r, const float* ll, const float* ur)
+{
+  float tMin = 0.0f;
+  float tMax = 1.0f;
+  for(int i = 0; i < 3; i++)
+  {
+    float delta = r[i] - q[i];
+    if(delta == 0.0f)
+    {
+      if(q[i] < ll[i] || q[i] > ur[i])
+      {
+        return false;
+      }
+      continue;
+    }
+    float t0 = (ll[i] - q[i]) / delta;
+    float t1 = (ur[i] - q[i]) / delta;
+    if(t0 > t1)
+    {
+      std::swap(t0, t1);
+    }
+    tMin = std::max(tMin, t0);
+    tMax = std::min(tMax, t1);
+    if(tMin > tMax)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PolyhedronBVH::PolyhedronBVH()
+: m_RayLength(1.0f)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PolyhedronBVH::~PolyhedronBVH() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PolyhedronBVH::Pointer PolyhedronBVH::New(TriangleGeom* faces, const Int32Int32DynamicListArray::ElementList& faceIds)
+{
+  if(nullptr == faces)
+  {
+    return NullPointer();
+  }
+  std::vector<int64_t> ids(faceIds.cells, faceIds.cells + faceIds.ncells);
+  Pointer sharedPtr(new PolyhedronBVH());
+  sharedPtr->build(faces, ids);
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PolyhedronBVH::Pointer PolyhedronBVH::New(TriangleGeom* faces)
+{
+  if(nullptr == faces)
+  {
+    return NullPointer();
+  }
+  std::vector<int64_t> ids(static_cast<size_t>(faces->getNumberOfTris()));
+  std::iota(ids.begin(), ids.end(), 0);
+  Pointer sharedPtr(new PolyhedronBVH());
+  sharedPtr->build(faces, ids);
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PolyhedronBVH::getNumberOfFaces() const
+{
+  return m_Coords.size() / 9;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PolyhedronBVH::getBounds(float* ll, float* ur) const
+{
+  if(m_Nodes.empty())
+  {
+    std::fill(ll, ll + 3, 0.0f);
+    std::fill(ur, ur + 3, 0.0f);
+    return;
+  }
+  std::copy(m_Nodes[0].ll, m_Nodes[0].ll + 3, ll);
+  std::copy(m_Nodes[0].ur, m_Nodes[0].ur + 3, ur);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float PolyhedronBVH::getRayLength() const
+{
+  return m_RayLength;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PolyhedronBVH::build(TriangleGeom* faces, const std::vector<int64_t>& faceIds)
+{
+  int32_t numFaces = static_cast<int32_t>(faceIds.size());
+  std::vector<float> coords(9 * faceIds.size());
+  std::vector<float> boxes(6 * faceIds.size());
+  std::vector<float> centroids(3 * faceIds.size());
+  for(int32_t i = 0; i < numFaces; i++)
+  {
+    float* a = coords.data() + 9 * i;
+    faces->getVertCoordsAtTri(faceIds[i], a, a + 3, a + 6);
+    float* box = boxes.data() + 6 * i;
+    for(int j = 0; j < 3; j++)
+    {
+      box[j] = std::min(std::min(a[j], a[j + 3]), a[j + 6]);
+      box[j + 3] = std::max(std::max(a[j], a[j + 3]), a[j + 6]);
+      centroids[3 * i + j] = (a[j] + a[j + 3] + a[j + 6]) / 3.0f;
+    }
+  }
+
+  m_Nodes.clear();
+  m_Coords.clear();
+  if(numFaces == 0)
+  {
+    return;
+  }
+
+  // Every box is padded by the same small fraction of the overall size so round off in the
+  // clipping never misses a face that lies on the surface of its box
+  float ll[3] = {boxes[0], boxes[1], boxes[2]};
+  float ur[3] = {boxes[3], boxes[4], boxes[5]};
+  for(int32_t i = 1; i < numFaces; i++)
+  {
+    for(int j = 0; j < 3; j++)
+    {
+      ll[j] = std::min(ll[j], boxes[6 * i + j]);
+      ur[j] = std::max(ur[j], boxes[6 * i + j + 3]);
+    }
+  }
+  float pad = 1.0e-4f * std::max(std::max(ur[0] - ll[0], ur[1] - ll[1]), ur[2] - ll[2]) + 1.0e-6f;
+
+  std::vector<int32_t> order(faceIds.size());
+  std::iota(order.begin(), order.end(), 0);
+  m_Nodes.reserve(2 * faceIds.size() / k_LeafSize + 1);
+  buildNode(order, boxes, centroids, pad, 0, numFaces);
+
+  // Store the triangles in the order the leaves reference them
+  m_Coords.resize(coords.size());
+  for(int32_t i = 0; i < numFaces; i++)
+  {
+    std::copy(coords.data() + 9 * order[i], coords.data() + 9 * order[i] + 9, m_Coords.data() + 9 * i);
+  }
+
+  float diagonal = 0.0f;
+  for(int j = 0; j < 3; j++)
+  {
+    float extent = m_Nodes[0].ur[j] - m_Nodes[0].ll[j];
+    diagonal += extent * extent;
+  }
+  diagonal = sqrtf(diagonal);
+  m_RayLength = (diagonal > 0.0f) ? 2.0f * diagonal : 1.0f;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PolyhedronBVH::buildNode(std::vector<int32_t>& order, const std::vector<float>& boxes, const std::vector<float>& centroids, float pad, int32_t first, int32_t count)
+{
+  // m_Nodes grows while the children are built, so the node is only referenced by index
+  int32_t index = static_cast<int32_t>(m_Nodes.size());
+  m_Nodes.push_back(Node());
+
+  float ll[3] = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+  float ur[3] = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+  float cll[3] = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+  float cur[3] = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+  for(int32_t i = first; i < first + count; i++)
+  {
+    const float* box = boxes.data() + 6 * order[i];
+    const float* centroid = centroids.data() + 3 * order[i];
+    for(int j = 0; j < 3; j++)
+    {
+      ll[j] = std::min(ll[j], box[j]);
+      ur[j] = std::max(ur[j], box[j + 3]);
+      cll[j] = std::min(cll[j], centroid[j]);
+      cur[j] = std::max(cur[j], centroid[j]);
+    }
+  }
+
+  Node& node = m_Nodes[index];
+  for(int j = 0; j < 3; j++)
+  {
+    node.ll[j] = ll[j] - pad;
+    node.ur[j] = ur[j] + pad;
+  }
+  node.first = first;
+  node.count = count;
+  node.right = -1;
+
+  int axis = 0;
+  for(int j = 1; j < 3; j++)
+  {
+    if(cur[j] - cll[j] > cur[axis] - cll[axis])
+    {
+      axis = j;
+    }
+  }
+  if(count <= k_LeafSize || cur[axis] <= cll[axis])
+  {
+    return;
+  }
+
+  // Split at the median centroid along the longest axis
+  int32_t mid = first + count / 2;
+  std::nth_element(order.begin() + first, order.begin() + mid, order.begin() + first + count,
+                   [&centroids, axis](int32_t a, int32_t b) { return centroids[3 * a + axis] < centroids[3 * b + axis]; });
+  m_Nodes[index].count = 0;
+  buildNode(order, boxes, centroids, pad, first, mid - first);
+  m_Nodes[index].right = static_cast<int32_t>(m_Nodes.size());
+  buildNode(order, boxes, centroids, pad, mid, first + count - mid);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+char PolyhedronBVH::countCrossings(const float* q, const float* r, int& crossings) const
+{
+  crossings = 0;
+  if(m_Nodes.empty())
+  {
+    return '0';
+  }
+
+  float p[3] = {0.0f, 0.0f, 0.0f}; /* Intersection point; not used. */
+  int32_t stack[k_MaxStackSize];
+  int32_t top = 0;
+  stack[top++] = 0;
+  while(top > 0)
+  {
+    int32_t index = stack[--top];
+    const Node& node = m_Nodes[index];
+    if(SegmentIntersectsBox(q, r, node.ll, node.ur) == false)
+    {
+      continue;
+    }
+    if(node.count == 0)
+    {
+      stack[top++] = node.right;
+      stack[top++] = index + 1;
+      continue;
+    }
+    for(int32_t f = node.first; f < node.first + node.count; f++)
+    {
+      const float* a = m_Coords.data() + 9 * f;
+      char code = GeometryMath::RayIntersectsTriangle(a, a + 3, a + 6, q, r, p);
+
+      /* If ray is degenerate, then the caller has to generate another. */
+      if(code == 'p' || code == 'v' || code == 'e' || code == '?')
+      {
+        return code;
+      }
+      /* If ray hits face at interior point, increment crossings. */
+      else if(code == 'f')
+      {
+        crossings++;
+      }
+      /* If query endpoint q sits on a V/E/F, return that code. */
+      else if(code == 'V' || code == 'E' || code == 'F')
+      {
+        return code;
+      }
+    }
+  }
+  return '0';
+}
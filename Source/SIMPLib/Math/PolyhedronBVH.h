@@ -0,0 +1,145 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DynamicListArray.hpp"
+
+class TriangleGeom;
+
+/**
+ * @class PolyhedronBVH PolyhedronBVH.h SIMPLib/Math/PolyhedronBVH.h
+ * @brief A bounding volume hierarchy over the triangles of a closed surface. The hierarchy is
+ * built once and then only read, so any number of threads may query it at the same time. The
+ * coordinates of the triangles are copied into the hierarchy in traversal order, which keeps
+ * the faces that are tested together next to each other in memory.
+ */
+class SIMPLib_EXPORT PolyhedronBVH
+{
+  public:
+    SIMPL_SHARED_POINTERS(PolyhedronBVH)
+    SIMPL_TYPE_MACRO(PolyhedronBVH)
+
+    /**
+     * @brief New Builds the hierarchy over a subset of the triangles, typically the faces
+     * bounding one feature
+     * @param faces
+     * @param faceIds
+     * @return
+     */
+    static Pointer New(TriangleGeom* faces, const Int32Int32DynamicListArray::ElementList& faceIds);
+
+    /**
+     * @brief New Builds the hierarchy over all the triangles of the geometry
+     * @param faces
+     * @return
+     */
+    static Pointer New(TriangleGeom* faces);
+
+    virtual ~PolyhedronBVH();
+
+    /**
+     * @brief getNumberOfFaces
+     * @return
+     */
+    size_t getNumberOfFaces() const;
+
+    /**
+     * @brief getBounds Returns the bounding box of all the faces
+     * @param ll
+     * @param ur
+     */
+    void getBounds(float* ll, float* ur) const;
+
+    /**
+     * @brief getRayLength
+     * @return A length that takes a ray starting inside the bounding box past every face
+     */
+    float getRayLength() const;
+
+    /**
+     * @brief Counts the faces crossed by the segment from q to r. Only the faces whose bounding
+     * boxes the segment passes through are tested.
+     * @param q
+     * @param r
+     * @param crossings Number of faces crossed at an interior point
+     * @return '0' if the count is valid, 'V', 'E' or 'F' if q lies on a face and 'p', 'v', 'e'
+     * or '?' if the segment hits a face in a degenerate way and another one should be tried
+     */
+    char countCrossings(const float* q, const float* r, int& crossings) const;
+
+  protected:
+    PolyhedronBVH();
+
+  private:
+    struct Node
+    {
+      float ll[3];
+      float ur[3];
+      int32_t first;
+      int32_t count;
+      int32_t right;
+    };
+
+    std::vector<Node> m_Nodes;
+    std::vector<float> m_Coords;
+    float m_RayLength;
+
+    /**
+     * @brief build Copies the triangles and builds the node tree over them
+     * @param faces
+     * @param faceIds
+     */
+    void build(TriangleGeom* faces, const std::vector<int64_t>& faceIds);
+
+    /**
+     * @brief buildNode Creates the node holding the faces order[first, first + count) and its children
+     * @param order
+     * @param boxes
+     * @param centroids
+     * @param pad Distance the box of the node is grown by on every side
+     * @param first
+     * @param count
+     */
+    void buildNode(std::vector<int32_t>& order, const std::vector<float>& boxes, const std::vector<float>& centroids, float pad, int32_t first, int32_t count);
+
+    PolyhedronBVH(const PolyhedronBVH&) = delete;   // Copy Constructor Not Implemented
+    void operator=(const PolyhedronBVH&) = delete; // Move assignment Not Implemented
+};
+
@@ -5,6 +5,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ArrayHelpers.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/GeometryMath.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MatrixMath.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PolyhedronBVH.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/QuaternionMath.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/RadialDistributionFunction.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibMath.h
@@ -13,6 +14,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
 set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/GeometryMath.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MatrixMath.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PolyhedronBVH.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/RadialDistributionFunction.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibMath.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibRandom.cpp
@@ -0,0 +1,191 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <vector>
+
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Math/GeometryMath.h"
+#include "SIMPLib/Math/PolyhedronBVH.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class PolyhedronBVHTest
+{
+public:
+  PolyhedronBVHTest() = default;
+  virtual ~PolyhedronBVHTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Creates the surface of the unit cube with every side split into n x n squares of two triangles
+  // -----------------------------------------------------------------------------
+  TriangleGeom::Pointer CreateCube(int n)
+  {
+    int64_t numTris = 6 * 2 * n * n;
+    SharedVertexList::Pointer verts = TriangleGeom::CreateSharedVertexList(numTris * 3);
+    TriangleGeom::Pointer cube = TriangleGeom::CreateGeometry(numTris, verts, "Cube");
+    float* coords = verts->getPointer(0);
+    int64_t* tris = cube->getTriangles()->getPointer(0);
+
+    int64_t v = 0;
+    for(int axis = 0; axis < 3; axis++)
+    {
+      for(int side = 0; side < 2; side++)
+      {
+        for(int i = 0; i < n; i++)
+        {
+          for(int j = 0; j < n; j++)
+          {
+            float corners[4][3];
+            for(int c = 0; c < 4; c++)
+            {
+              corners[c][axis] = static_cast<float>(side);
+              corners[c][(axis + 1) % 3] = static_cast<float>(i + c / 2) / n;
+              corners[c][(axis + 2) % 3] = static_cast<float>(j + c % 2) / n;
+            }
+            int order[6] = {0, 1, 3, 0, 3, 2};
+            for(int k = 0; k < 6; k++)
+            {
+              std::copy(corners[order[k]], corners[order[k]] + 3, coords + 3 * v);
+              tris[v] = v;
+              v++;
+            }
+          }
+        }
+      }
+    }
+    return cube;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPointInPolyhedron()
+  {
+    TriangleGeom::Pointer cube = CreateCube(1);
+    PolyhedronBVH::Pointer bvh = PolyhedronBVH::New(cube.get());
+    DREAM3D_REQUIRE_VALID_POINTER(bvh.get())
+    DREAM3D_REQUIRE_EQUAL(bvh->getNumberOfFaces(), static_cast<size_t>(12))
+
+    float ll[3] = {0.0f, 0.0f, 0.0f};
+    float ur[3] = {0.0f, 0.0f, 0.0f};
+    bvh->getBounds(ll, ur);
+    DREAM3D_REQUIRE(ll[0] <= 0.0f && ll[1] <= 0.0f && ll[2] <= 0.0f)
+    DREAM3D_REQUIRE(ur[0] >= 1.0f && ur[1] >= 1.0f && ur[2] >= 1.0f)
+
+    std::mt19937_64 generator;
+    float inside[3] = {0.5f, 0.3f, 0.7f};
+    float outside[3] = {1.5f, 0.5f, 0.5f};
+    float beside[3] = {0.5f, 0.5f, 1.0001f};
+    float onFace[3] = {0.25f, 0.5f, 1.0f};
+    float onCorner[3] = {1.0f, 1.0f, 1.0f};
+    DREAM3D_REQUIRE_EQUAL(GeometryMath::PointInPolyhedron(*bvh, inside, generator), 'i')
+    DREAM3D_REQUIRE_EQUAL(GeometryMath::PointInPolyhedron(*bvh, outside, generator), 'o')
+    DREAM3D_REQUIRE_EQUAL(GeometryMath::PointInPolyhedron(*bvh, beside, generator), 'o')
+    DREAM3D_REQUIRE_EQUAL(GeometryMath::PointInPolyhedron(*bvh, onFace, generator), 'F')
+    DREAM3D_REQUIRE_EQUAL(GeometryMath::PointInPolyhedron(*bvh, onCorner, generator), 'V')
+
+    // A hierarchy over some of the faces only sees those faces
+    std::vector<int32_t> ids = {0, 1, 2, 3};
+    Int32Int32DynamicListArray::ElementList faceIds;
+    faceIds.ncells = static_cast<int32_t>(ids.size());
+    faceIds.cells = ids.data();
+    PolyhedronBVH::Pointer subset = PolyhedronBVH::New(cube.get(), faceIds);
+    DREAM3D_REQUIRE_EQUAL(subset->getNumberOfFaces(), ids.size())
+
+    PolyhedronBVH::Pointer empty = PolyhedronBVH::New(nullptr);
+    DREAM3D_REQUIRE_EQUAL(empty.get() == nullptr, true)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPointsInPolyhedron()
+  {
+    TriangleGeom::Pointer cube = CreateCube(16);
+    PolyhedronBVH::Pointer bvh = PolyhedronBVH::New(cube.get());
+    DREAM3D_REQUIRE_EQUAL(bvh->getNumberOfFaces(), static_cast<size_t>(6 * 2 * 16 * 16))
+
+    // A lattice of points that never touches the surface of the cube
+    size_t dim = 40;
+    std::vector<float> points(3 * dim * dim * dim);
+    std::vector<bool> expected(dim * dim * dim);
+    size_t index = 0;
+    for(size_t z = 0; z < dim; z++)
+    {
+      for(size_t y = 0; y < dim; y++)
+      {
+        for(size_t x = 0; x < dim; x++)
+        {
+          float coord[3] = {-0.4871f + 0.0513f * x, -0.4863f + 0.0511f * y, -0.4857f + 0.0517f * z};
+          std::copy(coord, coord + 3, points.data() + 3 * index);
+          expected[index] = coord[0] > 0.0f && coord[0] < 1.0f && coord[1] > 0.0f && coord[1] < 1.0f && coord[2] > 0.0f && coord[2] < 1.0f;
+          index++;
+        }
+      }
+    }
+
+    std::vector<char> codes(expected.size(), '?');
+    GeometryMath::PointsInPolyhedron(*bvh, points.data(), expected.size(), codes.data());
+    size_t numInside = 0;
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+      bool isInside = expected[i];
+      DREAM3D_REQUIRE_EQUAL(codes[i] == 'i', isInside)
+      if(isInside)
+      {
+        numInside++;
+      }
+    }
+    DREAM3D_REQUIRE(numInside > 0 && numInside < expected.size())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### PolyhedronBVHTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestPointInPolyhedron())
+    DREAM3D_REGISTER_TEST(TestPointsInPolyhedron())
+  }
+
+private:
+  PolyhedronBVHTest(const PolyhedronBVHTest&); // Copy Constructor Not Implemented
+  void operator=(const PolyhedronBVHTest&);    // Move assignment Not Implemented
+};
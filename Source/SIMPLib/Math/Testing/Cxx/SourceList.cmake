@@ -1,6 +1,7 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
   MatrixMathTest
+  PolyhedronBVHTest
   QuaternionMathTest
 )
 
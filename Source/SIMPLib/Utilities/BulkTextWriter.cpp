@@ -0,0 +1,243 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "BulkTextWriter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> bool CreateDataArrayFormatter(const IDataArray::Pointer& array, int precision, BulkTextWriter::TupleFunction& function)
+{
+  typename DataArray<T>::Pointer typedArray = std::dynamic_pointer_cast<DataArray<T>>(array);
+  if(nullptr == typedArray.get())
+  {
+    return false;
+  }
+  // Resolves any pending lazy read before the threads start
+  const T* data = typedArray->getPointer(0);
+  int numComps = typedArray->getNumberOfComponents();
+  function = [data, numComps, precision](QByteArray& buffer, size_t tuple, char delimiter) {
+    BulkTextWriter::AppendTuple(buffer, data + tuple * numComps, numComps, delimiter, precision);
+  };
+  return true;
+}
+} // namespace
+
+/**
+ * @brief The FormatTextChunksImpl class formats each chunk of rows into its own buffer
+ */
+class FormatTextChunksImpl
+{
+  const BulkTextWriter::FormatFunction& m_Format;
+  QByteArray* m_Buffers;
+  size_t m_FirstChunk;
+  size_t m_Count;
+
+public:
+  FormatTextChunksImpl(const BulkTextWriter::FormatFunction& format, QByteArray* buffers, size_t firstChunk, size_t count)
+  : m_Format(format)
+  , m_Buffers(buffers)
+  , m_FirstChunk(firstChunk)
+  , m_Count(count)
+  {
+  }
+
+  virtual ~FormatTextChunksImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t chunk = start; chunk < end; chunk++)
+    {
+      size_t firstRow = chunk * BulkTextWriter::k_RowsPerChunk;
+      size_t lastRow = std::min(firstRow + BulkTextWriter::k_RowsPerChunk, m_Count);
+      QByteArray& buffer = m_Buffers[chunk - m_FirstChunk];
+      // Reserving the current capacity keeps the allocation of the previous batch through the resize
+      buffer.reserve(buffer.capacity());
+      buffer.resize(0);
+      m_Format(firstRow, lastRow, buffer);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BulkTextWriter::AppendValue(QByteArray& buffer, double value, int precision)
+{
+  // Spelled the way QTextStream writes them
+  if(std::isnan(value))
+  {
+    buffer.append("nan");
+    return;
+  }
+  if(std::isinf(value))
+  {
+    buffer.append(value < 0.0 ? "-inf" : "inf");
+    return;
+  }
+
+  char text[64];
+  int length = std::snprintf(text, sizeof(text), "%.*g", precision, value);
+  for(int i = 0; i < length; i++)
+  {
+    char c = text[i];
+    if((c < '0' || c > '9') && c != '-' && c != '+' && c != 'e' && c != '.')
+    {
+      // The C locale was changed to one with another decimal point. QTextStream always uses '.'
+      buffer.append(QByteArray::number(value, 'g', precision));
+      return;
+    }
+  }
+  buffer.append(text, length);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BulkTextWriter::AppendValue(QByteArray& buffer, float value, int precision)
+{
+  // QTextStream also widens floats to double before formatting them
+  AppendValue(buffer, static_cast<double>(value), precision);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BulkTextWriter::AppendValue(QByteArray& buffer, const QString& value, int /* precision */)
+{
+  buffer.append(value.toUtf8());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BulkTextWriter::TupleFunction BulkTextWriter::CreateTupleFormatter(const IDataArray::Pointer& array, int floatPrecision, int doublePrecision)
+{
+  TupleFunction function;
+
+  StringDataArray::Pointer stringArray = std::dynamic_pointer_cast<StringDataArray>(array);
+  if(nullptr != stringArray.get())
+  {
+    StringDataArray* strings = stringArray.get();
+    function = [strings](QByteArray& buffer, size_t tuple, char /* delimiter */) { AppendValue(buffer, strings->getValue(tuple)); };
+    return function;
+  }
+
+  if(CreateDataArrayFormatter<int8_t>(array, k_DefaultPrecision, function) || CreateDataArrayFormatter<uint8_t>(array, k_DefaultPrecision, function) ||
+     CreateDataArrayFormatter<int16_t>(array, k_DefaultPrecision, function) || CreateDataArrayFormatter<uint16_t>(array, k_DefaultPrecision, function) ||
+     CreateDataArrayFormatter<int32_t>(array, k_DefaultPrecision, function) || CreateDataArrayFormatter<uint32_t>(array, k_DefaultPrecision, function) ||
+     CreateDataArrayFormatter<int64_t>(array, k_DefaultPrecision, function) || CreateDataArrayFormatter<uint64_t>(array, k_DefaultPrecision, function) ||
+     CreateDataArrayFormatter<bool>(array, k_DefaultPrecision, function) || CreateDataArrayFormatter<float>(array, floatPrecision, function) ||
+     CreateDataArrayFormatter<double>(array, doublePrecision, function))
+  {
+    return function;
+  }
+
+  return TupleFunction();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BulkTextWriter::WriteChunks(QIODevice& device, size_t count, const FormatFunction& format, bool parallel, const ProgressFunction& progress)
+{
+  size_t numChunks = (count + k_RowsPerChunk - 1) / k_RowsPerChunk;
+
+  // A few chunks per thread are formatted before the batch is written out
+  size_t batchSize = 1;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(parallel)
+  {
+    batchSize = 4 * std::max<size_t>(1, std::thread::hardware_concurrency());
+  }
+#endif
+  std::vector<QByteArray> buffers(std::min(batchSize, std::max<size_t>(numChunks, 1)));
+
+  for(size_t batchStart = 0; batchStart < numChunks; batchStart += batchSize)
+  {
+    size_t batchEnd = std::min(batchStart + batchSize, numChunks);
+    FormatTextChunksImpl impl(format, buffers.data(), batchStart, count);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(parallel && batchEnd - batchStart > 1)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(batchStart, batchEnd, 1), impl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      impl.compute(batchStart, batchEnd);
+    }
+
+    for(size_t chunk = batchStart; chunk < batchEnd; chunk++)
+    {
+      const QByteArray& buffer = buffers[chunk - batchStart];
+      if(device.write(buffer) != buffer.size())
+      {
+        return false;
+      }
+    }
+
+    if(progress)
+    {
+      progress(std::min(batchEnd * k_RowsPerChunk, count));
+    }
+  }
+  return true;
+}
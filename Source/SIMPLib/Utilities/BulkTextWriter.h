@@ -0,0 +1,168 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QIODevice>
+#include <QtCore/QString>
+
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The BulkTextWriter class formats large amounts of numeric data as text. Values are
+ * appended to byte buffers without going through QTextStream, chunks of rows are formatted
+ * on several threads and the buffers are written to the device in order. The text is the
+ * same QTextStream would produce with its default settings.
+ */
+class SIMPLib_EXPORT BulkTextWriter
+{
+public:
+  /**
+   * @brief Appends the rows [start, end) to the buffer
+   */
+  using FormatFunction = std::function<void(size_t start, size_t end, QByteArray& buffer)>;
+
+  /**
+   * @brief Appends one tuple of an array to the buffer, components separated by the delimiter
+   */
+  using TupleFunction = std::function<void(QByteArray& buffer, size_t tuple, char delimiter)>;
+
+  /**
+   * @brief Called after each batch of chunks was written with the number of rows written so far
+   */
+  using ProgressFunction = std::function<void(size_t rowsWritten)>;
+
+  static const int k_DefaultPrecision = 6;
+  static const size_t k_RowsPerChunk = 1 << 16;
+
+  /**
+   * @brief Appends an integer or bool value. 8 bit integers and bools are written as numbers.
+   * @param buffer
+   * @param value
+   */
+  template <typename T> static typename std::enable_if<std::is_integral<T>::value>::type AppendValue(QByteArray& buffer, T value, int /* precision */ = k_DefaultPrecision)
+  {
+    using WideType = typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type;
+    WideType wide = static_cast<WideType>(value);
+    bool negative = std::is_signed<T>::value && wide < 0;
+    uint64_t magnitude = negative ? (0 - static_cast<uint64_t>(wide)) : static_cast<uint64_t>(wide);
+
+    char text[24];
+    char* end = text + sizeof(text);
+    char* ptr = end;
+    do
+    {
+      *--ptr = static_cast<char>('0' + magnitude % 10);
+      magnitude /= 10;
+    } while(magnitude != 0);
+    if(negative)
+    {
+      *--ptr = '-';
+    }
+    buffer.append(ptr, static_cast<int>(end - ptr));
+  }
+
+  /**
+   * @brief Appends a floating point value using the shorter of fixed and scientific notation
+   * with the given number of significant digits.
+   * @param buffer
+   * @param value
+   * @param precision
+   */
+  static void AppendValue(QByteArray& buffer, double value, int precision = k_DefaultPrecision);
+  static void AppendValue(QByteArray& buffer, float value, int precision = k_DefaultPrecision);
+
+  /**
+   * @brief Appends the UTF-8 encoding of the string
+   * @param buffer
+   * @param value
+   */
+  static void AppendValue(QByteArray& buffer, const QString& value, int precision = k_DefaultPrecision);
+
+  /**
+   * @brief Appends the components of one tuple separated by the delimiter
+   * @param buffer
+   * @param values Pointer to the first component of the tuple
+   * @param numComps
+   * @param delimiter
+   * @param precision Significant digits used for floating point values
+   */
+  template <typename T> static void AppendTuple(QByteArray& buffer, const T* values, int numComps, char delimiter, int precision = k_DefaultPrecision)
+  {
+    for(int j = 0; j < numComps; j++)
+    {
+      if(j != 0)
+      {
+        buffer.append(delimiter);
+      }
+      AppendValue(buffer, values[j], precision);
+    }
+  }
+
+  /**
+   * @brief Creates a function that appends one tuple of the array. Numeric arrays and string
+   * arrays are supported; an empty function is returned for any other array type.
+   * @param array
+   * @param floatPrecision Significant digits used for float arrays
+   * @param doublePrecision Significant digits used for double arrays
+   * @return
+   */
+  static TupleFunction CreateTupleFormatter(const IDataArray::Pointer& array, int floatPrecision = k_DefaultPrecision, int doublePrecision = k_DefaultPrecision);
+
+  /**
+   * @brief Writes count rows to the device. The rows are split into chunks that are formatted
+   * into separate buffers, in parallel when allowed, and the buffers are written in row order.
+   * Only a limited number of chunks is held in memory at any time.
+   * @param device Open device to write to
+   * @param count Number of rows
+   * @param format Function that formats a range of rows
+   * @param parallel False if the format function may not be called from several threads
+   * @param progress Optional progress callback
+   * @return False if writing to the device failed
+   */
+  static bool WriteChunks(QIODevice& device, size_t count, const FormatFunction& format, bool parallel = true, const ProgressFunction& progress = ProgressFunction());
+
+public:
+  BulkTextWriter(const BulkTextWriter&) = delete;            // Copy Constructor Not Implemented
+  BulkTextWriter(BulkTextWriter&&) = delete;                 // Move Constructor Not Implemented
+  BulkTextWriter& operator=(const BulkTextWriter&) = delete; // Copy Assignment Not Implemented
+  BulkTextWriter& operator=(BulkTextWriter&&) = delete;      // Move Assignment Not Implemented
+};
@@ -105,6 +105,22 @@ bool SIMPLH5DataReader::closeFile()
   return true;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLH5DataReader::setLoadArraysOnDemand(bool value)
+{
+  m_LoadArraysOnDemand = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLH5DataReader::getLoadArraysOnDemand() const
+{
+  return m_LoadArraysOnDemand;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -157,7 +173,21 @@ DataContainerArray::Pointer SIMPLH5DataReader::readSIMPLDataUsingProxy(const Dat
     return DataContainerArray::NullPointer();
   }
 
-  err = dca->readDataContainersFromHDF5(preflight, dcaGid, proxy, this);
+  // The arrays hold their own handle on the file so that it stays open after this reader is closed
+  H5LazyFileHandle::Pointer lazyFile = H5LazyFileHandle::NullPointer();
+  if(m_LoadArraysOnDemand && !preflight)
+  {
+    lazyFile = H5LazyFileHandle::Open(m_CurrentFilePath);
+    if(nullptr == lazyFile.get())
+    {
+      QString ss = QObject::tr("Error opening the file '%1' for on demand reading of the arrays").arg(m_CurrentFilePath);
+      emit errorGenerated(Title, ss, -253);
+      H5Gclose(dcaGid);
+      return DataContainerArray::NullPointer();
+    }
+  }
+
+  err = dca->readDataContainersFromHDF5(preflight, dcaGid, proxy, this, lazyFile);
   if(err < 0)
   {
     QString ss = QObject::tr("Error trying to read the DataContainers from the file '%1'").arg(m_CurrentFilePath);
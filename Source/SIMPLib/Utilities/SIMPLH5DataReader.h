@@ -101,6 +101,20 @@ class SIMPLib_EXPORT SIMPLH5DataReader : public Observable
      */
     bool readPipelineJson(QString &json);
 
+    /**
+     * @brief setLoadArraysOnDemand When true the DataArrays are only read from the file
+     * the first time their values are accessed. The file stays open (read only) until all
+     * of those arrays have been read or destroyed.
+     * @param value
+     */
+    void setLoadArraysOnDemand(bool value);
+
+    /**
+     * @brief getLoadArraysOnDemand
+     * @return
+     */
+    bool getLoadArraysOnDemand() const;
+
     /**
      * @brief notifyErrorMessage
      * @param humanLabel
@@ -115,6 +129,7 @@ class SIMPLib_EXPORT SIMPLH5DataReader : public Observable
   private:
     QString                           m_CurrentFilePath = "";
     hid_t                             m_FileId = -1;
+    bool                              m_LoadArraysOnDemand = false;
 
     /**
      * @brief readDataContainerBundles
@@ -16,6 +16,7 @@ set_source_files_properties( ${SIMPLib_${SUBDIR_NAME}_Generated_MOC_SRCS} PROPER
 
 
 set(SIMPLib_Utilities_HDRS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/BulkTextWriter.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ColorTable.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ColorUtilities.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilePathGenerator.h
@@ -28,6 +29,7 @@ set(SIMPLib_Utilities_HDRS
 )
 
 set(SIMPLib_Utilities_SRCS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/BulkTextWriter.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ColorTable.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ColorUtilities.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilePathGenerator.cpp
@@ -0,0 +1,165 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cmath>
+#include <limits>
+
+#include <QtCore/QBuffer>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Utilities/BulkTextWriter.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+/**
+ * @brief The BulkTextWriterTest class
+ */
+class BulkTextWriterTest
+{
+public:
+  BulkTextWriterTest() = default;
+  virtual ~BulkTextWriterTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> void CompareWithTextStream(T value, int precision = BulkTextWriter::k_DefaultPrecision)
+  {
+    QString expected;
+    QTextStream stream(&expected);
+    stream.setRealNumberPrecision(precision);
+    stream << value;
+    stream.flush();
+
+    QByteArray buffer;
+    BulkTextWriter::AppendValue(buffer, value, precision);
+    DREAM3D_REQUIRE_EQUAL(QString::fromUtf8(buffer), expected)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAppendValue()
+  {
+    CompareWithTextStream<int8_t>(-128);
+    CompareWithTextStream<uint8_t>(255);
+    CompareWithTextStream<int16_t>(-12345);
+    CompareWithTextStream<uint16_t>(0);
+    CompareWithTextStream<int32_t>(std::numeric_limits<int32_t>::min());
+    CompareWithTextStream<uint32_t>(std::numeric_limits<uint32_t>::max());
+    CompareWithTextStream<int64_t>(std::numeric_limits<int64_t>::min());
+    CompareWithTextStream<uint64_t>(std::numeric_limits<uint64_t>::max());
+
+    const double doubles[] = {0.0, -0.0, 1.0, 0.1, -2.5, 1.0 / 3.0, 123456.0, 1234567.0, 0.0001, 0.00001, 6.02214076e23, -1.6e-19, 0.785398163397};
+    for(double value : doubles)
+    {
+      CompareWithTextStream(value);
+      CompareWithTextStream(value, 16);
+      CompareWithTextStream(static_cast<float>(value));
+      CompareWithTextStream(static_cast<float>(value), 8);
+    }
+    CompareWithTextStream(std::numeric_limits<double>::infinity());
+    CompareWithTextStream(-std::numeric_limits<double>::infinity());
+    CompareWithTextStream(std::numeric_limits<double>::quiet_NaN());
+
+    QByteArray buffer;
+    BulkTextWriter::AppendValue(buffer, true);
+    BulkTextWriter::AppendValue(buffer, false);
+    DREAM3D_REQUIRE_EQUAL(QString::fromUtf8(buffer), QString("10"))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestWriteChunks()
+  {
+    // Enough rows for several chunks and a partial last chunk
+    const size_t numTuples = 3 * BulkTextWriter::k_RowsPerChunk + 17;
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(numTuples, QVector<size_t>(1, 3), "Values", true);
+    for(size_t i = 0; i < array->getSize(); i++)
+    {
+      array->setValue(i, static_cast<float>(i) * 0.37f);
+    }
+
+    QString expected;
+    QTextStream stream(&expected);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      array->printTuple(stream, i, ',');
+      stream << "\n";
+    }
+    stream.flush();
+
+    BulkTextWriter::TupleFunction formatter = BulkTextWriter::CreateTupleFormatter(array, 8, 16);
+    DREAM3D_REQUIRE(static_cast<bool>(formatter))
+
+    QBuffer device;
+    device.open(QIODevice::WriteOnly);
+    size_t lastProgress = 0;
+    bool ok = BulkTextWriter::WriteChunks(device, numTuples,
+                                          [&formatter](size_t start, size_t end, QByteArray& buffer) {
+                                            for(size_t i = start; i < end; i++)
+                                            {
+                                              formatter(buffer, i, ',');
+                                              buffer.append('\n');
+                                            }
+                                          },
+                                          true, [&lastProgress](size_t rowsWritten) { lastProgress = rowsWritten; });
+    device.close();
+
+    DREAM3D_REQUIRE_EQUAL(ok, true)
+    DREAM3D_REQUIRE_EQUAL(lastProgress, numTuples)
+    DREAM3D_REQUIRE(QString::fromUtf8(device.data()) == expected)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### BulkTextWriterTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestAppendValue());
+    DREAM3D_REGISTER_TEST(TestWriteChunks());
+  }
+
+private:
+  BulkTextWriterTest(const BulkTextWriterTest&); // Copy Constructor Not Implemented
+  void operator=(const BulkTextWriterTest&);     // Move assignment Not Implemented
+};
@@ -85,5 +85,14 @@ namespace SIMPLView
       OnStatusAndError = 2
     };
   }
+
+  namespace PipelineExecutionSettings
+  {
+    const QString GroupName("PipelineExecutionSettings");
+    const QString DataflowExecutionKey("Run Independent Filters Concurrently");
+    const QString ProfileExecutionKey("Profile Filter Execution");
+    const QString MappedFileThresholdKey("Scratch File Threshold (MB)");
+    const QString ScratchDirectoryKey("Scratch File Directory");
+  }
 }
 
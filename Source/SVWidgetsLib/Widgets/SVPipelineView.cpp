@@ -45,8 +45,10 @@
 #include <QtCore/QSharedPointer>
 #include <QtCore/QSignalMapper>
 #include <QtCore/QTemporaryFile>
+#include <QtCore/QTextStream>
 #include <QtCore/QThread>
 #include <QtCore/QUrl>
+#include <QtConcurrent/QtConcurrentRun>
 
 #include <QtGui/QClipboard>
 #include <QtGui/QDrag>
@@ -70,6 +72,7 @@
 #include "SIMPLib/Common/PipelineMessage.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/CoreFilters/Breakpoint.h"
+#include "SIMPLib/DataArrays/DataArrayStorage.h"
 #include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/JsonFilterParametersWriter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
@@ -77,6 +80,7 @@
 #include "SIMPLib/SIMPLib.h"
 
 #include "SVWidgetsLib/QtSupport/QtSDroppableScrollArea.h"
+#include "SVWidgetsLib/QtSupport/QtSSettings.h"
 
 #include "SVWidgetsLib/Animations/PipelineItemHeightAnimation.h"
 #include "SVWidgetsLib/Animations/PipelineItemSlideAnimation.h"
@@ -107,7 +111,11 @@
 SVPipelineView::SVPipelineView(QWidget* parent)
 : QListView(parent)
 , m_PipelineState(PipelineViewState::Idle)
+, m_PreflightCancel(false)
 {
+  m_PreflightWatcher = new QFutureWatcher<int>(this);
+  connect(m_PreflightWatcher, &QFutureWatcher<int>::finished, this, &SVPipelineView::preflightWorkerFinished);
+
   setupGui();
 }
 
@@ -116,6 +124,9 @@ SVPipelineView::SVPipelineView(QWidget* parent)
 // -----------------------------------------------------------------------------
 SVPipelineView::~SVPipelineView()
 {
+  // The worker preflight only touches copies of the filters, but those are owned here
+  m_PreflightCancel = true;
+  m_PreflightWatcher->waitForFinished();
   delete m_WorkerThread;
   delete m_ActionEnableFilter;
 }
@@ -174,6 +185,118 @@ void SVPipelineView::connectSignalsSlots()
   connect(m_ActionClearPipeline, &QAction::triggered, this, &SVPipelineView::listenClearPipelineTriggered);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SVPipelineView::GetDataflowExecutionSetting()
+{
+  QSharedPointer<QtSSettings> prefs = QSharedPointer<QtSSettings>(new QtSSettings());
+  prefs->beginGroup(SIMPLView::PipelineExecutionSettings::GroupName);
+
+  bool value = prefs->value(SIMPLView::PipelineExecutionSettings::DataflowExecutionKey, QVariant(false)).toBool();
+
+  prefs->endGroup();
+
+  return value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::SetDataflowExecutionSetting(bool value)
+{
+  QSharedPointer<QtSSettings> prefs = QSharedPointer<QtSSettings>(new QtSSettings());
+  prefs->beginGroup(SIMPLView::PipelineExecutionSettings::GroupName);
+
+  prefs->setValue(SIMPLView::PipelineExecutionSettings::DataflowExecutionKey, QVariant(value));
+
+  prefs->endGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SVPipelineView::GetProfileExecutionSetting()
+{
+  QSharedPointer<QtSSettings> prefs = QSharedPointer<QtSSettings>(new QtSSettings());
+  prefs->beginGroup(SIMPLView::PipelineExecutionSettings::GroupName);
+
+  bool value = prefs->value(SIMPLView::PipelineExecutionSettings::ProfileExecutionKey, QVariant(false)).toBool();
+
+  prefs->endGroup();
+
+  return value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::SetProfileExecutionSetting(bool value)
+{
+  QSharedPointer<QtSSettings> prefs = QSharedPointer<QtSSettings>(new QtSSettings());
+  prefs->beginGroup(SIMPLView::PipelineExecutionSettings::GroupName);
+
+  prefs->setValue(SIMPLView::PipelineExecutionSettings::ProfileExecutionKey, QVariant(value));
+
+  prefs->endGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SVPipelineView::GetMappedFileThresholdSetting()
+{
+  QSharedPointer<QtSSettings> prefs = QSharedPointer<QtSSettings>(new QtSSettings());
+  prefs->beginGroup(SIMPLView::PipelineExecutionSettings::GroupName);
+
+  int value = prefs->value(SIMPLView::PipelineExecutionSettings::MappedFileThresholdKey, QVariant(0)).toInt();
+
+  prefs->endGroup();
+
+  return value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::SetMappedFileThresholdSetting(int value)
+{
+  QSharedPointer<QtSSettings> prefs = QSharedPointer<QtSSettings>(new QtSSettings());
+  prefs->beginGroup(SIMPLView::PipelineExecutionSettings::GroupName);
+
+  prefs->setValue(SIMPLView::PipelineExecutionSettings::MappedFileThresholdKey, QVariant(value));
+
+  prefs->endGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString SVPipelineView::GetScratchDirectorySetting()
+{
+  QSharedPointer<QtSSettings> prefs = QSharedPointer<QtSSettings>(new QtSSettings());
+  prefs->beginGroup(SIMPLView::PipelineExecutionSettings::GroupName);
+
+  QString value = prefs->value(SIMPLView::PipelineExecutionSettings::ScratchDirectoryKey, QVariant(QString())).toString();
+
+  prefs->endGroup();
+
+  return value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::SetScratchDirectorySetting(const QString& value)
+{
+  QSharedPointer<QtSSettings> prefs = QSharedPointer<QtSSettings>(new QtSSettings());
+  prefs->beginGroup(SIMPLView::PipelineExecutionSettings::GroupName);
+
+  prefs->setValue(SIMPLView::PipelineExecutionSettings::ScratchDirectoryKey, QVariant(value));
+
+  prefs->endGroup();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -324,62 +447,153 @@ void SVPipelineView::preflightPipeline()
   {
     return;
   }
-  qDebug() << "----------- SVPipelineView::preflightPipeline Begin --------------";
-  emit clearIssuesTriggered();
 
-  PipelineModel* model = getPipelineModel();
+  m_PreflightGeneration++;
+  if(m_PreflightWatcher->isRunning())
+  {
+    // Abandon the stale preflight; the latest state is picked up once the worker returns
+    m_PreflightCancel = true;
+    m_PreflightRestartPending = true;
+    return;
+  }
 
-  // Create a Pipeline Object and fill it with the filters from this View
-  FilterPipeline::Pointer pipeline = getFilterPipeline();
+  startPreflightWorker();
+}
 
-  qDebug() << "Prepping Filters for preflight... ";
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::startPreflightWorker()
+{
+  qDebug() << "----------- SVPipelineView::preflightPipeline Begin --------------";
 
+  FilterPipeline::Pointer pipeline = getFilterPipeline();
   FilterPipeline::FilterContainerType filters = pipeline->getFilterContainer();
+
+  // Let the filter parameter widgets push their current values into the filters, then
+  // bring the worker's copies up to date. A copy is replaced whenever its filter was
+  // edited so the preflight cache only reuses results of unchanged filters.
+  QHash<AbstractFilter*, QPair<AbstractFilter::WeakPointer, AbstractFilter::Pointer>> preflightFilters;
+  FilterPipeline::Pointer preflightPipeline = FilterPipeline::New();
   for(int i = 0; i < filters.size(); i++)
   {
-    filters.at(i)->setErrorCondition(0);
-    filters.at(i)->setCancel(false);
+    AbstractFilter::Pointer filter = filters.at(i);
+    emit filter->preflightAboutToExecute();
+    emit filter->updateFilterParameters(filter.get());
 
-    QModelIndex childIndex = model->index(i, PipelineItem::Contents);
-    if(childIndex.isValid())
+    QJsonObject json = filter->toJson();
+    AbstractFilter::Pointer copy;
+    auto iter = m_PreflightFilters.find(filter.get());
+    if(iter != m_PreflightFilters.end() && iter.value().first.lock() == filter)
     {
-      model->setData(childIndex, static_cast<int>(PipelineItem::ErrorState::Ok), PipelineModel::ErrorStateRole);
-      AbstractFilter::Pointer filter = model->filter(childIndex);
-      if(filter->getEnabled() == true)
-      {
-        model->setData(childIndex, static_cast<int>(PipelineItem::WidgetState::Ready), PipelineModel::WidgetStateRole);
-      }
+      copy = iter.value().second;
+    }
+    if(nullptr == copy || copy->getEnabled() != filter->getEnabled() || copy->toJson() != json)
+    {
+      copy = filter->newFilterInstance(false);
+      copy->readFilterParameters(json);
+      copy->setEnabled(filter->getEnabled());
     }
+    preflightFilters.insert(filter.get(), qMakePair(AbstractFilter::WeakPointer(filter), copy));
+    preflightPipeline->pushBack(copy);
   }
-
-  //  QSharedPointer<ProgressDialog> progressDialog(new ProgressDialog());
-  //  progressDialog->setWindowTitle("Pipeline Preflighting");
-  //  QString msg = QString("Please wait for %1 filters to preflight...").arg(pipeline->getFilterContainer().count());
-  //  progressDialog->setLabelText(msg);
-  //  progressDialog->show();
-  //  progressDialog->raise();
-  //  progressDialog->activateWindow();
+  m_PreflightFilters = preflightFilters;
+  m_PreflightPipeline = preflightPipeline;
 
   // Preflight the pipeline
-  qDebug() << "Preflight the Pipeline ... ";
+  m_PreflightCancel = false;
+  m_PreflightRunningGeneration = m_PreflightGeneration;
+  FilterPipeline::PreflightCache* cache = &m_PreflightCache;
+  std::atomic<bool>* cancel = &m_PreflightCancel;
+  m_PreflightWatcher->setFuture(QtConcurrent::run([preflightPipeline, cache, cancel]() { return preflightPipeline->incrementalPreflightPipeline(*cache, cancel); }));
+}
 
-  int err = pipeline->preflightPipeline();
-  if(err < 0)
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::preflightWorkerFinished()
+{
+  if(m_PreflightRestartPending)
+  {
+    m_PreflightRestartPending = false;
+    startPreflightWorker();
+    return;
+  }
+
+  // Another preflight was requested (or the pipeline started executing) since this one began
+  if(m_PreflightRunningGeneration != m_PreflightGeneration || m_PreflightCancel)
   {
-    // FIXME: Implement error handling.
+    return;
+  }
+
+  applyPreflightResults(m_PreflightWatcher->result());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::applyPreflightResults(int err)
+{
+  PipelineModel* model = getPipelineModel();
+  FilterPipeline::Pointer pipeline = getFilterPipeline();
+  FilterPipeline::FilterContainerType filters = pipeline->getFilterContainer();
+  FilterPipeline::FilterContainerType preflightFilters = m_PreflightPipeline->getFilterContainer();
+
+  // The view was edited without requesting a preflight; the results no longer line up
+  bool matches = (filters.size() == preflightFilters.size() && m_PreflightCache.size() == filters.size());
+  for(int i = 0; i < filters.size() && matches; i++)
+  {
+    matches = (m_PreflightFilters.value(filters.at(i).get()).second == preflightFilters.at(i) && m_PreflightCache.at(i).filter.lock() == preflightFilters.at(i));
+  }
+  if(!matches)
+  {
+    preflightPipeline();
+    return;
+  }
+
+  emit clearIssuesTriggered();
+
+  for(int i = 0; i < filters.size(); i++)
+  {
+    AbstractFilter::Pointer filter = filters.at(i);
+    const FilterPipeline::PreflightSnapshot& snapshot = m_PreflightCache.at(i);
+
+    filter->setErrorCondition(snapshot.errorCondition);
+    filter->setWarningCondition(snapshot.warningCondition);
+    filter->setCancel(false);
+    filter->setDataContainerArray(snapshot.dca->deepCopy(false));
+
+    // Pick up paths that were renamed by upstream filters during the preflight
+    QJsonObject json = preflightFilters.at(i)->toJson();
+    if(json != filter->toJson())
+    {
+      filter->readFilterParameters(json);
+    }
+
+    pipeline->connectFilterNotifications(filter.get());
+    for(const PipelineMessage& msg : snapshot.messages)
+    {
+      filter->broadcastPipelineMessage(msg);
+    }
+    pipeline->disconnectFilterNotifications(filter.get());
+    emit filter->preflightExecuted();
   }
 
   qDebug() << "Checking for Filters with Errors or Warnings ... ";
 
-  int count = pipeline->getFilterContainer().size();
   // Now that the preflight has been executed loop through the filters and check their error condition and set the
   // outline on the filter widget if there were errors or warnings
-  for(qint32 i = 0; i < count; ++i)
+  for(qint32 i = 0; i < filters.size(); ++i)
   {
     QModelIndex childIndex = model->index(i, PipelineItem::Contents);
     if(childIndex.isValid())
     {
+      model->setData(childIndex, static_cast<int>(PipelineItem::ErrorState::Ok), PipelineModel::ErrorStateRole);
       AbstractFilter::Pointer filter = model->filter(childIndex);
+      if(filter->getEnabled() == true)
+      {
+        model->setData(childIndex, static_cast<int>(PipelineItem::WidgetState::Ready), PipelineModel::WidgetStateRole);
+      }
       if(filter->getWarningCondition() < 0)
       {
         model->setData(childIndex, static_cast<int>(PipelineItem::ErrorState::Warning), PipelineModel::ErrorStateRole);
@@ -394,7 +608,6 @@ void SVPipelineView::preflightPipeline()
   emit preflightFinished(pipeline, err);
   updateFilterInputWidgetIndices();
   qDebug() << "----------- SVPipelineView::preflightPipeline End --------------";
-  
 }
 
 // -----------------------------------------------------------------------------
@@ -419,9 +632,21 @@ void SVPipelineView::executePipeline()
   // Create a FilterPipeline Object
   //  m_PipelineInFlight = getCopyOfFilterPipeline();
   m_PipelineInFlight = getFilterPipeline();
+  // Profiling is opt-in; it runs the filters one at a time and walks the DataContainerArray around each one
+  m_PipelineInFlight->setDataflowExecution(GetDataflowExecutionSetting());
+  m_PipelineInFlight->setProfiler(GetProfileExecutionSetting() ? PipelineProfiler::New() : PipelineProfiler::NullPointer());
+  // Arrays at least as large as the threshold are kept in scratch files the operating system can page out
+  int mappedFileThreshold = GetMappedFileThresholdSetting();
+  DataArrayStorage::SetMappedFileThreshold(mappedFileThreshold > 0 ? static_cast<size_t>(mappedFileThreshold) * 1024 * 1024 : 0);
+  DataArrayStorage::SetScratchDirectory(GetScratchDirectorySetting());
 
   emit stdOutMessage("<b>Preflight Pipeline.....</b>");
-  // Give the pipeline one last chance to preflight and get all the latest values from the GUI
+  // Give the pipeline one last chance to preflight and get all the latest values from the GUI.
+  // A worker preflight that is still running must not touch the filters while they execute.
+  m_PreflightGeneration++;
+  m_PreflightCancel = true;
+  m_PreflightRestartPending = false;
+  m_PreflightWatcher->waitForFinished();
   int err = m_PipelineInFlight->preflightPipeline();
   if(err < 0)
   {
@@ -537,6 +762,11 @@ void SVPipelineView::finishPipeline()
     stdOutMessage("<b>*************** PIPELINE FINISHED ***************</b>");
   }
   stdOutMessage("");
+  if(nullptr != m_PipelineInFlight->getProfiler() && !m_PipelineInFlight->getProfiler()->getFilterRecords().isEmpty())
+  {
+    stdOutMessage(createProfileTable(m_PipelineInFlight->getProfiler()));
+    stdOutMessage("");
+  }
 
   // Put back the DataContainerArray for each filter at the conclusion of running
   // the pipeline. this keeps the data browser current and up to date.
@@ -554,6 +784,40 @@ void SVPipelineView::finishPipeline()
   emit pipelineFinished();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString SVPipelineView::createProfileTable(const PipelineProfiler::Pointer& profiler)
+{
+  const double megabyte = 1024.0 * 1024.0;
+  double total = profiler->getTotalWallSeconds();
+
+  QString html;
+  QTextStream out(&html);
+  out << "<b>Filter Timing</b>";
+  out << "<table cellpadding=\"2\" cellspacing=\"0\" border=\"1\">";
+  out << "<tr><th>#</th><th>Filter</th><th>Wall (s)</th><th>CPU (s)</th><th>% Time</th><th>Created (MB)</th><th>Boundary Peak (MB)</th><th>Read (MB)</th><th>Written (MB)</th></tr>";
+  const QVector<PipelineProfiler::FilterRecord>& records = profiler->getFilterRecords();
+  for(const PipelineProfiler::FilterRecord& record : records)
+  {
+    double percent = (total > 0.0) ? record.wallSeconds / total * 100.0 : 0.0;
+    out << "<tr>";
+    out << "<td>" << (record.pipelineIndex + 1) << "</td>";
+    out << "<td>" << record.humanLabel.toHtmlEscaped() << "</td>";
+    out << "<td align=\"right\">" << QString::number(record.wallSeconds, 'f', 3) << "</td>";
+    out << "<td align=\"right\">" << QString::number(record.cpuSeconds, 'f', 3) << "</td>";
+    out << "<td align=\"right\">" << QString::number(percent, 'f', 1) << "</td>";
+    out << "<td align=\"right\">" << QString::number(record.createdBytes / megabyte, 'f', 2) << "</td>";
+    out << "<td align=\"right\">" << QString::number(record.boundaryPeakBytes / megabyte, 'f', 2) << "</td>";
+    out << "<td align=\"right\">" << QString::number(record.bytesRead / megabyte, 'f', 2) << "</td>";
+    out << "<td align=\"right\">" << QString::number(record.bytesWritten / megabyte, 'f', 2) << "</td>";
+    out << "</tr>";
+  }
+  out << "</table>";
+  out << "Total wall time: " << QString::number(total, 'f', 3) << " s";
+  return html;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1799,6 +2063,7 @@ void SVPipelineView::requestFilterItemContextMenu(const QPoint& pos, const QMode
 
   // Error Handling Menu
   requestErrorHandlingContextMenu(menu);
+  requestExecutionContextMenu(menu);
   menu.addSeparator();
 
   QAction* actionLaunchHelp = new QAction("Filter Help", this);
@@ -1832,6 +2097,8 @@ void SVPipelineView::requestPipelineItemContextMenu(const QPoint& pos)
 
   requestErrorHandlingContextMenu(menu);
 
+  requestExecutionContextMenu(menu);
+
   menu.exec(pos);
 }
 
@@ -1925,6 +2192,27 @@ void SVPipelineView::requestErrorHandlingContextMenu(QMenu& menu)
   });
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::requestExecutionContextMenu(QMenu& menu)
+{
+  QMenu* executionMenu = menu.addMenu("Execution");
+
+  QAction* dataflowAction = executionMenu->addAction("Run Independent Filters Concurrently");
+  dataflowAction->setCheckable(true);
+  dataflowAction->setChecked(GetDataflowExecutionSetting());
+  connect(dataflowAction, &QAction::triggered, [=](bool checked) { SetDataflowExecutionSetting(checked); });
+
+  QAction* profileAction = executionMenu->addAction("Profile Filter Execution");
+  profileAction->setCheckable(true);
+  profileAction->setChecked(GetProfileExecutionSetting());
+  profileAction->setToolTip("Records the time and memory of each filter. Filters run one at a time while profiling.");
+  connect(profileAction, &QAction::triggered, [=](bool checked) { SetProfileExecutionSetting(checked); });
+
+  menu.addSeparator();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1935,6 +2223,8 @@ void SVPipelineView::requestDefaultContextMenu(const QPoint& pos)
   menu.addSeparator();
   menu.addAction(m_ActionClearPipeline);
 
+  requestExecutionContextMenu(menu);
+
   menu.exec(pos);
 }
 
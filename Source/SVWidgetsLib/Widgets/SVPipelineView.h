@@ -35,9 +35,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <stack>
 #include <vector>
 
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QHash>
 #include <QtCore/QSharedPointer>
 
 #include <QtGui/QPainter>
@@ -98,6 +101,54 @@ public:
   SVPipelineView(QWidget* parent = nullptr);
   ~SVPipelineView() override;
 
+  /**
+   * @brief GetDataflowExecutionSetting
+   * @return True if filters that do not depend on each other should run concurrently
+   */
+  static bool GetDataflowExecutionSetting();
+
+  /**
+   * @brief SetDataflowExecutionSetting
+   * @param value
+   */
+  static void SetDataflowExecutionSetting(bool value);
+
+  /**
+   * @brief GetProfileExecutionSetting
+   * @return True if the timing and memory of each filter should be recorded while the pipeline executes
+   */
+  static bool GetProfileExecutionSetting();
+
+  /**
+   * @brief SetProfileExecutionSetting
+   * @param value
+   */
+  static void SetProfileExecutionSetting(bool value);
+
+  /**
+   * @brief GetMappedFileThresholdSetting
+   * @return The array size in megabytes from which arrays are kept in memory mapped scratch files, 0 to keep them on the heap
+   */
+  static int GetMappedFileThresholdSetting();
+
+  /**
+   * @brief SetMappedFileThresholdSetting
+   * @param value
+   */
+  static void SetMappedFileThresholdSetting(int value);
+
+  /**
+   * @brief GetScratchDirectorySetting
+   * @return The directory the scratch files are created in, empty for the system temporary directory
+   */
+  static QString GetScratchDirectorySetting();
+
+  /**
+   * @brief SetScratchDirectorySetting
+   * @param value
+   */
+  static void SetScratchDirectorySetting(const QString& value);
+
   /**
    * @brief addPipelineMessageObserver
    * @param pipelineMessageObserver
@@ -273,8 +324,9 @@ public slots:
   void pasteFilters(int insertIndex = -1, bool useAnimationOnFirstRun = true);
 
   /**
-   * @brief preflightPipeline
-   * @param pipelineIndex
+   * @brief Requests a preflight of the pipeline. The preflight runs on a worker thread against
+   * copies of the filters; a request made while one is running cancels it and the latest
+   * request is preflighted once the worker is free. Only the newest result is applied to the view.
    */
   void preflightPipeline();
 
@@ -417,10 +469,23 @@ private slots:
    */
   void processPipelineMessage(const PipelineMessage& msg);
 
+  /**
+   * @brief Called on the GUI thread when the worker preflight completes
+   */
+  void preflightWorkerFinished();
+
 private:
   QThread* m_WorkerThread = nullptr;
   FilterPipeline::Pointer m_PipelineInFlight;
   QVector<DataContainerArray::Pointer> m_PreflightDataContainerArrays;
+  FilterPipeline::PreflightCache m_PreflightCache;
+  FilterPipeline::Pointer m_PreflightPipeline;
+  QHash<AbstractFilter*, QPair<AbstractFilter::WeakPointer, AbstractFilter::Pointer>> m_PreflightFilters;
+  QFutureWatcher<int>* m_PreflightWatcher = nullptr;
+  std::atomic<bool> m_PreflightCancel;
+  quint64 m_PreflightGeneration = 0;
+  quint64 m_PreflightRunningGeneration = 0;
+  bool m_PreflightRestartPending = false;
   QList<QObject*> m_PipelineMessageObservers;
 
   QUndoCommand* m_MoveCommand = nullptr;
@@ -501,6 +566,12 @@ private:
    */
   void requestErrorHandlingContextMenu(QMenu& menu);
 
+  /**
+   * @brief requestExecutionContextMenu
+   * @param menu
+   */
+  void requestExecutionContextMenu(QMenu& menu);
+
   /**
    * @brief requestDefaultContextMenu
    * @param pos
@@ -519,6 +590,25 @@ private:
    */
   void removeDropIndicator();
 
+  /**
+   * @brief Copies the current filter parameters into the worker's filter copies and starts
+   * preflighting them on a worker thread
+   */
+  void startPreflightWorker();
+
+  /**
+   * @brief Transfers the results of the finished worker preflight onto the filters in the view
+   * @param err Error returned by the preflight
+   */
+  void applyPreflightResults(int err);
+
+  /**
+   * @brief Formats the per filter statistics of an executed pipeline as an HTML table for the standard output
+   * @param profiler
+   * @return
+   */
+  QString createProfileTable(const PipelineProfiler::Pointer& profiler);
+
   /**
    * @brief findNextRow
    * @param pos